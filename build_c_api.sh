@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# This file is part of HFPx3D.
+#
+# Created by agent on 10/17/2026.
+# Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+# Geo-Energy Laboratory, 2026.  All rights reserved.
+# See the LICENSE.TXT file for more details.
+#
+
+# Build of the shared library of the C API (src/hfp3d_c_api.h)
+# from the repository root:
+#   IL_INCLUDE_DIR=<il> sh build_c_api.sh [output directory]
+# gives libhfp3d.so (libhfp3d.dylib on macOS, hfp3d.dll on Windows
+# with MinGW) exporting the hfp3d_* functions only.
+# CXX & CXXFLAGS (default "-O2 -fopenmp") are passed to the compiler;
+# optional: HFPX3D_LA=MKL|OPENBLAS|BLIS (dense LU backend,
+# see dense_la.h) with HFPX3D_LA_LIBS="-lmkl_rt" (libraries to link)
+
+if [ -z "$IL_INCLUDE_DIR" ]; then
+    echo "IL_INCLUDE_DIR (the directory containing il/) is not set"
+    exit 2
+fi
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -fopenmp}
+OUT_DIR=${1:-_c_api_build}
+mkdir -p "$OUT_DIR" || exit 2
+
+case "$(uname -s)" in
+    Darwin*) LIB="libhfp3d.dylib" ;;
+    MINGW*|MSYS*|CYGWIN*) LIB="hfp3d.dll" ;;
+    *) LIB="libhfp3d.so" ;;
+esac
+
+DEFS="-DHFPX3D_BUILD_DLL"
+if [ -n "$HFPX3D_LA" ]; then
+    DEFS="$DEFS -DHFPX3D_USE_$(echo "$HFPX3D_LA" | tr a-z A-Z)"
+fi
+
+# the sources the C API depends on
+SRCS=""
+for f in hfp3d_c_api mesh_utilities element_utilities tensor_utilities \
+        h_potential elasticity_kernel_integration congruent_pairs \
+        near_field_cache el2el_cache system_assembly dense_la leak_off \
+        time_stepping; do
+    SRCS="$SRCS src/$f.cpp"
+done
+
+$CXX -std=c++11 $CXXFLAGS -fPIC -fvisibility=hidden -shared $DEFS \
+    -I"$IL_INCLUDE_DIR" -Isrc $SRCS $HFPX3D_LA_LIBS -o "$OUT_DIR/$LIB" \
+    || exit 1
+echo "$OUT_DIR/$LIB"
@@ -0,0 +1,55 @@
+#
+# This file is part of HFPx3D.
+#
+# Created by agent on 10/17/2026.
+# Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+# Geo-Energy Laboratory, 2026.  All rights reserved.
+# See the LICENSE.TXT file for more details.
+#
+
+# Build of the Python module "hfp3d" (src/python_bindings.cpp):
+#   IL_INCLUDE_DIR=<il> pip install .
+# then the smoke test:
+#   python3 tests/test_python_bindings.py
+# Optional: HFPX3D_LA=MKL|OPENBLAS|BLIS (dense LU backend, see dense_la.h)
+# with HFPX3D_LA_LIBS="mkl_rt" (space separated libraries to link)
+
+import os
+import sys
+
+from setuptools import setup
+from pybind11.setup_helpers import Pybind11Extension, build_ext
+
+il_dir = os.environ.get("IL_INCLUDE_DIR")
+if not il_dir:
+    sys.exit("IL_INCLUDE_DIR (the directory containing il/) is not set")
+
+# the sources the module depends on
+sources = ["src/python_bindings.cpp"] + [
+    "src/%s.cpp" % f for f in (
+        "mesh_utilities", "element_utilities", "tensor_utilities",
+        "h_potential", "elasticity_kernel_integration", "congruent_pairs",
+        "near_field_cache", "el2el_cache", "system_assembly",
+        "dense_la", "leak_off", "time_stepping")]
+
+macros = [("HFPX3D_USE_PYTHON", None)]
+la = os.environ.get("HFPX3D_LA")
+if la:
+    macros.append(("HFPX3D_USE_" + la.upper(), None))
+
+ext = Pybind11Extension(
+    "hfp3d",
+    sources,
+    include_dirs=[il_dir, "src"],
+    define_macros=macros,
+    libraries=os.environ.get("HFPX3D_LA_LIBS", "").split(),
+    cxx_std=11,
+)
+
+setup(
+    name="hfp3d",
+    version="0.1",
+    description="3D BEM Volume Control solver for pressurized fractures",
+    ext_modules=[ext],
+    cmdclass={"build_ext": build_ext},
+)
@@ -0,0 +1,92 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Hash map of influence blocks with a bounded number of entries;
+// when it is full, a new block replaces a stored one chosen by
+// the CLOCK (second chance) rule: blocks reused since the last pass
+// of the "hand" are kept
+
+#ifndef INC_HFPX3D_BLOCK_CACHE_H
+#define INC_HFPX3D_BLOCK_CACHE_H
+
+#include <unordered_map>
+#include <il/Array.h>
+
+namespace hfp3d {
+
+    template <typename K, typename V, typename H>
+    class Block_Cache {
+    private:
+        struct Entry_T {
+            V val;
+            bool is_used;
+        };
+        typedef std::unordered_map<K, Entry_T, H> Map_T;
+
+        Map_T map_;
+        // the "hand" is set at the 1st replacement; from then on
+        // the size stays at max_size_ and the map is not re-hashed
+        typename Map_T::iterator hand_;
+        bool is_hand_set_;
+        il::int_t max_size_;
+
+    public:
+        explicit Block_Cache(il::int_t max_size) {
+            is_hand_set_ = false;
+            max_size_ = max_size;
+        }
+
+        il::int_t size() const { return map_.size(); }
+        il::int_t max_size() const { return max_size_; }
+
+        // stored block (marked as used) or nullptr
+        const V *find(const K &key) {
+            auto it = map_.find(key);
+            if (it == map_.end()) {
+                return nullptr;
+            }
+            it->second.is_used = true;
+            return &(it->second.val);
+        }
+
+        void insert(const K &key, const V &val) {
+            if (max_size_ <= 0) {
+                return;
+            }
+            if (static_cast<il::int_t>(map_.size()) >= max_size_) {
+                if (!is_hand_set_) {
+                    hand_ = map_.begin();
+                    is_hand_set_ = true;
+                }
+                // the 1st block not used since the last pass
+                while (true) {
+                    if (hand_ == map_.end()) {
+                        hand_ = map_.begin();
+                    }
+                    if (!hand_->second.is_used) {
+                        break;
+                    }
+                    hand_->second.is_used = false;
+                    ++hand_;
+                }
+                hand_ = map_.erase(hand_);
+            }
+            Entry_T entry{val, false};
+            map_.emplace(key, entry);
+        }
+
+        void clear() {
+            map_.clear();
+            is_hand_set_ = false;
+        }
+    };
+
+}
+
+#endif //INC_HFPX3D_BLOCK_CACHE_H
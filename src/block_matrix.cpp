@@ -0,0 +1,333 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray2D.h>
+#include "block_matrix.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+#include "el2el_cache.h"
+
+namespace hfp3d {
+
+    // y += B * x for an 18*18 column-major block (micro-kernel);
+    // B is double or float, the sum is in double precision
+    template <typename T>
+    inline void blk_gemv_18
+            (const T *b, const double *x, il::io_t, double *y) {
+        const il::int_t n = BSR_Matrix_T::b_size;
+        double y_l[n];
+        for (il::int_t i = 0; i < n; ++i) {
+            y_l[i] = y[i];
+        }
+        for (il::int_t j = 0; j < n; ++j) {
+            const double x_j = x[j];
+            const T *b_j = b + j * n;
+#pragma omp simd
+            for (il::int_t i = 0; i < n; ++i) {
+                y_l[i] += static_cast<double>(b_j[i]) * x_j;
+            }
+        }
+        for (il::int_t i = 0; i < n; ++i) {
+            y[i] = y_l[i];
+        }
+    }
+
+    // Volume Control matrix assembly in BSR format
+    BSR_Matrix_T make_3dbem_matrix_vc_bsr
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl) {
+// This function assembles the Volume Control BEM matrix
+// for the elements having active DoF in dof_hndl
+// as a set of contiguous 18*18 element-to-element blocks;
+// rows & columns corresponding to fixed DoF are zeroed
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        const il::int_t b_size = BSR_Matrix_T::b_size;
+        const il::int_t b_len = b_size * b_size;
+        IL_EXPECT_FAST(ndpe == b_size);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+
+        BSR_Matrix_T bsr;
+        bsr.is_vc = true;
+        bsr.el_list = get_act_el_set(dof_hndl);
+        const il::int_t n_b = bsr.el_list.size();
+        bsr.el_blk = il::Array<il::int_t>{num_ele, -1};
+        for (il::int_t k = 0; k < n_b; ++k) {
+            bsr.el_blk[bsr.el_list[k]] = k;
+        }
+
+        // all element pairs (the BEM matrix is fully populated)
+        bsr.row_ptr = il::Array<il::int_t>{n_b + 1};
+        bsr.col_ind = il::Array<il::int_t>{n_b * n_b};
+        for (il::int_t t_k = 0; t_k <= n_b; ++t_k) {
+            bsr.row_ptr[t_k] = t_k * n_b;
+        }
+        for (il::int_t t_k = 0; t_k < n_b; ++t_k) {
+            for (il::int_t s_k = 0; s_k < n_b; ++s_k) {
+                bsr.col_ind[t_k * n_b + s_k] = s_k;
+            }
+        }
+        bsr.vc_row = il::Array<double>{n_b * b_size, 0.0};
+        bsr.vc_col = il::Array<double>{n_b * b_size, 0.0};
+
+        // element properties
+        il::Array<Element_Struct_T> el_s{n_b};
+        for (il::int_t k = 0; k < n_b; ++k) {
+            el_s[k] = get_mesh_el_struct(mesh, bsr.el_list[k], n_par.beta);
+        }
+
+        // near- & far-field blocks
+        bsr.is_f = il::Array<bool>{n_b * n_b, false};
+        bsr.blk_pos = il::Array<il::int_t>{n_b * n_b};
+        if (n_par.is_ff_float) {
+            // centroids & diameters (longest edges) of the elements
+            il::Array2D<double> el_c{3, n_b, 0.0};
+            il::Array<double> el_d{n_b, 0.0};
+            for (il::int_t k = 0; k < n_b; ++k) {
+                for (int j = 0; j < 3; ++j) {
+                    int m = (j + 1) % 3;
+                    double l2 = 0.0;
+                    for (int i = 0; i < 3; ++i) {
+                        el_c(i, k) += el_s[k].vert(i, j) / 3.0;
+                        double dx = el_s[k].vert(i, m) - el_s[k].vert(i, j);
+                        l2 += dx * dx;
+                    }
+                    el_d[k] = std::fmax(el_d[k], std::sqrt(l2));
+                }
+            }
+            for (il::int_t t_k = 0; t_k < n_b; ++t_k) {
+                for (il::int_t s_k = 0; s_k < n_b; ++s_k) {
+                    double d2 = 0.0;
+                    for (int i = 0; i < 3; ++i) {
+                        double dx = el_c(i, t_k) - el_c(i, s_k);
+                        d2 += dx * dx;
+                    }
+                    double r_f = n_par.ff_eta *
+                                 std::fmax(el_d[t_k], el_d[s_k]);
+                    bsr.is_f[t_k * n_b + s_k] = d2 > r_f * r_f;
+                }
+            }
+        }
+        il::int_t n_near = 0, n_far = 0;
+        for (il::int_t b = 0; b < n_b * n_b; ++b) {
+            bsr.blk_pos[b] = bsr.is_f[b] ? n_far++ : n_near++;
+        }
+        bsr.val = il::Array<double>{n_near * b_len, 0.0};
+        bsr.val_f = il::Array<float>{n_far * b_len, 0.0f};
+
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        // Loop over "source" elements (block columns)
+//#pragma omp parallel for
+        for (il::int_t s_k = 0; s_k < n_b; ++s_k) {
+            il::int_t source_elem = bsr.el_list[s_k];
+            // Loop over "Target" elements (block rows)
+            for (il::int_t t_k = 0; t_k < n_b; ++t_k) {
+                il::int_t target_elem = bsr.el_list[t_k];
+                il::StaticArray2D<double, 18, 18> el2el_infl =
+                        el_cache.el2el(el_s[s_k], el_s[t_k],
+                                       n_par.is_dd_local);
+                const il::int_t b = t_k * n_b + s_k;
+                double *blk = bsr.is_f[b] ? nullptr :
+                              bsr.val.data() + bsr.blk_pos[b] * b_len;
+                float *blk_f = bsr.is_f[b] ?
+                               bsr.val_f.data() + bsr.blk_pos[b] * b_len :
+                               nullptr;
+                for (il::int_t i1 = 0; i1 < b_size; ++i1) {
+                    if (dof_hndl.dof_h(source_elem, i1) < 0) {
+                        continue;
+                    }
+                    for (il::int_t i0 = 0; i0 < b_size; ++i0) {
+                        if (dof_hndl.dof_h(target_elem, i0) < 0) {
+                            continue;
+                        }
+                        if (bsr.is_f[b]) {
+                            blk_f[i1 * b_size + i0] =
+                                    static_cast<float>(el2el_infl(i0, i1));
+                        } else {
+                            blk[i1 * b_size + i0] = el2el_infl(i0, i1);
+                        }
+                    }
+                }
+            }
+            // Volume vs DD & traction vs pressure
+            il::StaticArray2D<double, 2, 18> vc_infl =
+                    make_el_vc_submatrix(el_s[s_k], n_par.is_dd_local);
+            for (il::int_t l = 0; l < b_size; ++l) {
+                if (dof_hndl.dof_h(source_elem, l) >= 0) {
+                    bsr.vc_row[s_k * b_size + l] = vc_infl(0, l);
+                    bsr.vc_col[s_k * b_size + l] = vc_infl(1, l);
+                }
+            }
+        }
+        return bsr;
+    }
+
+    // Vector listed according to dof_hndl to block (element-wise) layout
+    il::Array<double> get_bsr_vector
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x) {
+        const il::int_t n_b = bsr.el_list.size();
+        const il::int_t b_size = BSR_Matrix_T::b_size;
+        const il::int_t n_ext = x.size() - dof_hndl.n_dof;
+        IL_EXPECT_FAST(n_ext == 0 || n_ext == 1);
+        il::Array<double> x_b{n_b * b_size + n_ext, 0.0};
+        for (il::int_t k = 0; k < n_b; ++k) {
+            il::int_t el = bsr.el_list[k];
+            for (il::int_t l = 0; l < b_size; ++l) {
+                il::int_t dof = dof_hndl.dof_h(el, l);
+                if (dof >= 0) {
+                    x_b[k * b_size + l] = x[dof];
+                }
+            }
+        }
+        if (n_ext == 1) {
+            x_b[n_b * b_size] = x[dof_hndl.n_dof];
+        }
+        return x_b;
+    }
+
+    // Vector in block (element-wise) layout to the one listed
+    // according to dof_hndl
+    il::Array<double> get_dof_vector
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x_b) {
+        const il::int_t n_b = bsr.el_list.size();
+        const il::int_t b_size = BSR_Matrix_T::b_size;
+        const il::int_t n_ext = x_b.size() - n_b * b_size;
+        IL_EXPECT_FAST(n_ext == 0 || n_ext == 1);
+        il::Array<double> x{dof_hndl.n_dof + n_ext, 0.0};
+        for (il::int_t k = 0; k < n_b; ++k) {
+            il::int_t el = bsr.el_list[k];
+            for (il::int_t l = 0; l < b_size; ++l) {
+                il::int_t dof = dof_hndl.dof_h(el, l);
+                if (dof >= 0) {
+                    x[dof] = x_b[k * b_size + l];
+                }
+            }
+        }
+        if (n_ext == 1) {
+            x[dof_hndl.n_dof] = x_b[n_b * b_size];
+        }
+        return x;
+    }
+
+    // Matrix-vector product in block (element-wise) layout
+    il::Array<double> bsr_dot
+            (const BSR_Matrix_T &bsr,
+             const il::Array<double> &x_b) {
+        // x_b = [DD; pressure] for Volume Control matrices
+        const il::int_t n_b = bsr.el_list.size();
+        const il::int_t b_size = BSR_Matrix_T::b_size;
+        const il::int_t b_len = b_size * b_size;
+        const il::int_t n_b_dof = n_b * b_size;
+        IL_EXPECT_FAST(x_b.size() == n_b_dof + (bsr.is_vc ? 1 : 0));
+
+        il::Array<double> y_b{x_b.size(), 0.0};
+        const double *x_p = x_b.data();
+        double *y_p = y_b.data();
+
+//#pragma omp parallel for
+        for (il::int_t t_k = 0; t_k < n_b; ++t_k) {
+            double *y_t = y_p + t_k * b_size;
+            for (il::int_t b = bsr.row_ptr[t_k];
+                 b < bsr.row_ptr[t_k + 1]; ++b) {
+                const double *x_s = x_p + bsr.col_ind[b] * b_size;
+                if (bsr.is_f[b]) {
+                    blk_gemv_18(bsr.val_f.data() + bsr.blk_pos[b] * b_len,
+                                x_s, il::io, y_t);
+                } else {
+                    blk_gemv_18(bsr.val.data() + bsr.blk_pos[b] * b_len,
+                                x_s, il::io, y_t);
+                }
+            }
+        }
+
+        if (bsr.is_vc) {
+            const double pressure = x_b[n_b_dof];
+            double volume = 0.0;
+            for (il::int_t i = 0; i < n_b_dof; ++i) {
+                y_p[i] += bsr.vc_col[i] * pressure;
+                volume += bsr.vc_row[i] * x_p[i];
+            }
+            y_p[n_b_dof] = volume;
+        }
+        return y_b;
+    }
+
+    // Matrix-vector product for vectors listed according to dof_hndl
+    il::Array<double> bsr_dot
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x) {
+        il::Array<double> x_b = get_bsr_vector(bsr, dof_hndl, x);
+        il::Array<double> y_b = bsr_dot(bsr, x_b);
+        return get_dof_vector(bsr, dof_hndl, y_b);
+    }
+
+    // Conversion to a dense matrix
+    il::Array2D<double> bsr_to_dense
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl) {
+        // (num_dof + 1) * (num_dof + 1) for Volume Control matrices
+        const il::int_t n_b = bsr.el_list.size();
+        const il::int_t b_size = BSR_Matrix_T::b_size;
+        const il::int_t b_len = b_size * b_size;
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t n_ext = bsr.is_vc ? 1 : 0;
+
+        il::Array2D<double> matrix{num_dof + n_ext, num_dof + n_ext, 0.0};
+        for (il::int_t t_k = 0; t_k < n_b; ++t_k) {
+            il::int_t target_elem = bsr.el_list[t_k];
+            for (il::int_t b = bsr.row_ptr[t_k];
+                 b < bsr.row_ptr[t_k + 1]; ++b) {
+                il::int_t source_elem = bsr.el_list[bsr.col_ind[b]];
+                const il::int_t b_0 = bsr.blk_pos[b] * b_len;
+                for (il::int_t i1 = 0; i1 < b_size; ++i1) {
+                    il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                    if (j1 < 0) {
+                        continue;
+                    }
+                    for (il::int_t i0 = 0; i0 < b_size; ++i0) {
+                        il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                        if (j0 >= 0) {
+                            il::int_t l = b_0 + i1 * b_size + i0;
+                            matrix(j0, j1) += bsr.is_f[b] ?
+                                    static_cast<double>(bsr.val_f[l]) :
+                                    bsr.val[l];
+                        }
+                    }
+                }
+            }
+            if (bsr.is_vc) {
+                for (il::int_t l = 0; l < b_size; ++l) {
+                    il::int_t dof = dof_hndl.dof_h(target_elem, l);
+                    if (dof >= 0) {
+                        matrix(num_dof, dof) = bsr.vc_row[t_k * b_size + l];
+                        matrix(dof, num_dof) = bsr.vc_col[t_k * b_size + l];
+                    }
+                }
+            }
+        }
+        return matrix;
+    }
+
+}
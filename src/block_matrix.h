@@ -0,0 +1,98 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Block-sparse-row (BSR) storage of the BEM matrix
+// in 18*18 element-to-element blocks;
+// far-field blocks can be stored in single precision
+// (matrix-vector products are accumulated in double precision)
+
+#ifndef INC_HFPX3D_BLOCK_MATRIX_H
+#define INC_HFPX3D_BLOCK_MATRIX_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // BSR matrix structure
+    struct BSR_Matrix_T {
+        // block size (DoF per element)
+        static const il::int_t b_size = 18;
+
+        // mesh elements represented by block rows (and columns)
+        il::Array<il::int_t> el_list{};
+        // block row (column) number for each element of the mesh
+        // (-1 means the element is not represented)
+        il::Array<il::int_t> el_blk{};
+
+        // block row pointers (size = el_list.size() + 1)
+        il::Array<il::int_t> row_ptr{};
+        // block column numbers
+        il::Array<il::int_t> col_ind{};
+        // block values (column-major, b_size * b_size per block)
+        // in double (val) or single (val_f) precision
+        il::Array<double> val{};
+        il::Array<float> val_f{};
+        // block b is stored in val_f if is_f[b], in val otherwise,
+        // starting at blk_pos[b] * b_size * b_size
+        il::Array<bool> is_f{};
+        il::Array<il::int_t> blk_pos{};
+        // rows & columns of fixed DoF are stored as zeros
+
+        // Volume Control: additional row (volume vs DD)
+        // and column (traction vs pressure), b_size per block row
+        bool is_vc = false;
+        il::Array<double> vc_row{};
+        il::Array<double> vc_col{};
+    };
+
+    // Volume Control matrix assembly in BSR format
+    // (all element pairs of the elements having active DoF in dof_hndl);
+    // far-field blocks (see Num_Param_T::ff_eta) are stored
+    // in single precision if n_par.is_ff_float
+    BSR_Matrix_T make_3dbem_matrix_vc_bsr
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl);
+
+    // Vector listed according to dof_hndl to block (element-wise) layout
+    // (the last entry, if any, is kept at the end)
+    il::Array<double> get_bsr_vector
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x);
+
+    // Vector in block (element-wise) layout to the one listed
+    // according to dof_hndl (the last entry, if any, is kept at the end)
+    il::Array<double> get_dof_vector
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x_b);
+
+    // Matrix-vector product in block (element-wise) layout
+    il::Array<double> bsr_dot
+            (const BSR_Matrix_T &bsr,
+             const il::Array<double> &x_b);
+
+    // Matrix-vector product for vectors listed according to dof_hndl
+    il::Array<double> bsr_dot
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x);
+
+    // Conversion to a dense matrix (e.g. for LU)
+    il::Array2D<double> bsr_to_dense
+            (const BSR_Matrix_T &bsr,
+             const DoF_Handle_T &dof_hndl);
+
+}
+
+#endif //INC_HFPX3D_BLOCK_MATRIX_H
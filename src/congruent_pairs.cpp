@@ -0,0 +1,161 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <complex>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "congruent_pairs.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    Congr_Pair_Cache::Congr_Pair_Cache
+            (double mu, double nu,
+             double tol, double l_scale,
+             il::int_t max_size) :
+            e_c_(mu, nu), blk_map_(max_size) {
+        IL_EXPECT_FAST(tol > 0.0);
+        IL_EXPECT_FAST(l_scale > 0.0);
+        q_step_ = tol * l_scale;
+        is_src_set_ = false;
+        n_hits_ = 0;
+        n_misses_ = 0;
+    }
+
+    void Congr_Pair_Cache::set_src_(const Element_Struct_T &src_el) {
+        // This function re-orders the vertices of the source element
+        // (cyclically, so that the normal is preserved) to start from
+        // the longest edge; the local coordinate system of the re-ordered
+        // element is then defined by the element's shape only
+        if (is_src_set_) {
+            bool is_same = true;
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    is_same = is_same && src_c_.vert(k, j) == src_el.vert(k, j);
+                }
+            }
+            if (is_same) return;
+        }
+
+        il::StaticArray<double, 3> e_len{0.0};
+        for (int j = 0; j < 3; ++j) {
+            int m = (j + 1) % 3;
+            double l2 = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                double dx = src_el.vert(k, m) - src_el.vert(k, j);
+                l2 += dx * dx;
+            }
+            e_len[j] = std::sqrt(l2);
+        }
+        int c = 0;
+        for (int j = 1; j < 3; ++j) {
+            if (e_len[j] > e_len[c] + q_step_) {
+                c = j;
+            }
+        }
+
+        il::StaticArray2D<double, 3, 3> c_vert;
+        for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                src_c_.vert(k, j) = src_el.vert(k, j);
+                c_vert(k, j) = src_el.vert(k, (j + c) % 3);
+            }
+        }
+        src_c_.shift = c;
+        src_c_.c_el = set_ele_struct(c_vert, 0.0);
+        src_c_.q_tau[0] = std::llround(std::real(src_c_.c_el.tau[1]) / q_step_);
+        src_c_.q_tau[1] = std::llround(std::real(src_c_.c_el.tau[2]) / q_step_);
+        src_c_.q_tau[2] = std::llround(std::imag(src_c_.c_el.tau[2]) / q_step_);
+        is_src_set_ = true;
+    }
+
+    il::StaticArray2D<double, 6, 18> Congr_Pair_Cache::el2p_stress
+            (const Element_Struct_T &src_el,
+             const il::StaticArray<double, 3> &x) {
+        set_src_(src_el);
+        const Element_Struct_T &c_el = src_c_.c_el;
+        HZ hz = make_el_pt_hz(c_el.vert, x, c_el.r_tensor);
+
+        CP_Key_T key;
+        for (int k = 0; k < 3; ++k) {
+            key.q[k] = src_c_.q_tau[k];
+        }
+        key.q[3] = std::llround(hz.h / q_step_);
+        key.q[4] = std::llround(std::real(hz.z) / q_step_);
+        key.q[5] = std::llround(std::imag(hz.z) / q_step_);
+
+        const il::StaticArray2D<double, 6, 18> *blk = blk_map_.find(key);
+        if (blk != nullptr) {
+            ++n_hits_;
+            return *blk;
+        }
+        ++n_misses_;
+        il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc =
+                make_local_3dbem_submatrix
+                        (1, e_c_, hz.h, hz.z, c_el.tau, c_el.sf_m);
+        blk_map_.insert(key, stress_infl_el2p_loc);
+        return stress_infl_el2p_loc;
+    }
+
+    il::StaticArray2D<double, 18, 18> Congr_Pair_Cache::el2el
+            (const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local) {
+        // This function assembles the same 18*18 block
+        // as make_el2el_3dbem_submatrix; the stress influence
+        // is calculated w.r. to the canonical (re-ordered) source element
+        // and then related to the source element's nodes & DD components
+
+        // Normal vector at collocation point (x)
+        il::StaticArray<double, 3> nrm_cp_glob;
+        for (int j = 0; j < 3; ++j) {
+            nrm_cp_glob[j] = -trg_el.r_tensor(2, j);
+        }
+
+        il::StaticArray2D<double, 18, 18> trac_infl_el2el{0.0};
+        // Loop over nodes of the "target" element
+        for (int n_t = 0; n_t < 6; ++n_t) {
+            il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc =
+                    el2p_stress(src_el, trg_el.cp_crd[n_t]);
+            // traction vs DD w.r. to the reference coordinate system
+            il::StaticArray2D<double, 3, 18> trac_cp_glob =
+                    make_el2p_trac_submatrix
+                            (stress_infl_el2p_loc, src_c_.c_el.r_tensor,
+                             nrm_cp_glob, false);
+
+            const int c = src_c_.shift;
+            for (int n_c = 0; n_c < 6; ++n_c) {
+                // node of the source element matching
+                // the n_c-th node of the canonical one
+                int n_s = (n_c < 3) ? (n_c + c) % 3 : 3 + (n_c - 3 + c) % 3;
+                for (int k = 0; k < 3; ++k) {
+                    for (int j = 0; j < 3; ++j) {
+                        double t_kj;
+                        if (is_dd_local) {
+                            // DD w.r. to the source element's
+                            // local coordinate system
+                            t_kj = 0.0;
+                            for (int i = 0; i < 3; ++i) {
+                                t_kj += trac_cp_glob(k, 3 * n_c + i) *
+                                        src_el.r_tensor(j, i);
+                            }
+                        } else {
+                            t_kj = trac_cp_glob(k, 3 * n_c + j);
+                        }
+                        trac_infl_el2el(3 * n_t + k, 3 * n_s + j) = t_kj;
+                    }
+                }
+            }
+        }
+        return trac_infl_el2el;
+    }
+
+}
@@ -0,0 +1,115 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Reuse of the element-to-point influence for congruent
+// (related by rigid motion) source element - collocation point pairs
+
+#ifndef INC_HFPX3D_CONGRUENT_PAIRS_H
+#define INC_HFPX3D_CONGRUENT_PAIRS_H
+
+#include <cstdint>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "element_utilities.h"
+#include "h_potential.h"
+#include "block_cache.h"
+
+namespace hfp3d {
+
+    // quantized relative geometry of a source element & a point:
+    // tau-coordinates of the vertices (2nd & 3rd; the 1st is at the origin)
+    // and h, z of the point, in the "canonical" local coordinate system
+    struct CP_Key_T {
+        il::StaticArray<std::int64_t, 6> q;
+        bool operator==(const CP_Key_T &b) const {
+            for (int k = 0; k < 6; ++k) {
+                if (q[k] != b.q[k]) return false;
+            }
+            return true;
+        }
+    };
+
+    struct CP_Key_Hash_T {
+        std::size_t operator()(const CP_Key_T &key) const {
+            std::size_t h = 0;
+            for (int k = 0; k < 6; ++k) {
+                h ^= std::hash<std::int64_t>()(key.q[k]) +
+                        0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+    };
+
+    // source element with vertices re-ordered (cyclically)
+    // such that the 1st edge is the longest one
+    struct Canon_El_T {
+        // the element in question
+        il::StaticArray2D<double, 3, 3> vert;
+        // re-ordered element
+        Element_Struct_T c_el;
+        // c_el vertex k is the original vertex (k + shift) % 3
+        int shift;
+        // quantized tau-coordinates of c_el vertices
+        il::StaticArray<std::int64_t, 3> q_tau;
+    };
+
+    class Congr_Pair_Cache {
+    private:
+        // elastic constants (kernel table)
+        Elast_Const_T e_c_;
+        // quantization step (relative tolerance * length scale)
+        double q_step_;
+
+        // DD-to stress influence (6*18) w.r. to the canonical element
+        Block_Cache<CP_Key_T, il::StaticArray2D<double, 6, 18>,
+                CP_Key_Hash_T> blk_map_;
+
+        // the last source element visited
+        bool is_src_set_;
+        Canon_El_T src_c_;
+
+        il::int_t n_hits_, n_misses_;
+
+        void set_src_(const Element_Struct_T &src_el);
+
+    public:
+        // tol: quantization step relative to l_scale, the length scale
+        // of the mesh (see get_mesh_length_scale);
+        // max_size: max. number of stored 6*18 blocks
+        Congr_Pair_Cache
+                (double mu, double nu,
+                 double tol, double l_scale,
+                 il::int_t max_size);
+
+        il::int_t size() const { return blk_map_.size(); };
+        il::int_t max_size() const { return blk_map_.max_size(); };
+        il::int_t n_hits() const { return n_hits_; };
+        il::int_t n_misses() const { return n_misses_; };
+
+        // DD-to stress influence at point x (global coordinates)
+        // w.r. to the canonical local coordinate system of src_el
+        // (computed or taken from the cache)
+        il::StaticArray2D<double, 6, 18> el2p_stress
+                (const Element_Struct_T &src_el,
+                 const il::StaticArray<double, 3> &x);
+
+        // Element-to-element influence matrix
+        // (same as make_el2el_3dbem_submatrix)
+        il::StaticArray2D<double, 18, 18> el2el
+                (const Element_Struct_T &src_el,
+                 const Element_Struct_T &trg_el,
+                 bool is_dd_local);
+
+        // the canonical (re-ordered) source element of the last call
+        const Canon_El_T &canon_src() const { return src_c_; };
+    };
+
+}
+
+#endif //INC_HFPX3D_CONGRUENT_PAIRS_H
@@ -0,0 +1,317 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <cstdint>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "dense_la.h"
+
+#if defined(HFPX3D_USE_MKL) || defined(HFPX3D_USE_OPENBLAS) || \
+    defined(HFPX3D_USE_BLIS)
+#define HFPX3D_LA_VENDOR
+#endif
+
+#ifdef HFPX3D_LA_VENDOR
+#ifdef HFPX3D_LA_ILP64
+typedef std::int64_t la_int;
+#else
+typedef int la_int;
+#endif
+
+// BLAS & LAPACK (Fortran interface) and thread control of the backend
+extern "C" {
+void dgemm_(const char *tr_a, const char *tr_b,
+            const la_int *m, const la_int *n, const la_int *k,
+            const double *alpha, const double *a, const la_int *lda,
+            const double *b, const la_int *ldb,
+            const double *beta, double *c, const la_int *ldc);
+void dgetrf_(const la_int *m, const la_int *n, double *a, const la_int *lda,
+             la_int *ipiv, la_int *info);
+void dgetrs_(const char *tr, const la_int *n, const la_int *nrhs,
+             const double *a, const la_int *lda, const la_int *ipiv,
+             double *b, const la_int *ldb, la_int *info);
+#if defined(HFPX3D_USE_MKL)
+int mkl_set_num_threads_local(int n_threads);
+#elif defined(HFPX3D_USE_OPENBLAS)
+void openblas_set_num_threads(int n_threads);
+int openblas_get_num_threads(void);
+#elif defined(HFPX3D_USE_BLIS)
+void bli_thread_set_num_threads(std::int64_t n_threads);
+std::int64_t bli_thread_get_num_threads(void);
+#endif
+}
+#endif // HFPX3D_LA_VENDOR
+
+namespace hfp3d {
+
+#ifdef HFPX3D_LA_VENDOR
+    // sets the number of threads of the vendor backend for a call.
+    // MKL: for the calling thread only, restored on exit from the scope.
+    // OpenBLAS & BLIS: the number is process-wide; it is changed
+    // (and not restored) only if it differs from n_threads, as
+    // a save & restore would race with concurrent calls
+    // (see Dense_LA_T::n_threads)
+    class LA_Thread_Guard_T {
+    private:
+        int prev_;
+    public:
+        explicit LA_Thread_Guard_T(int n_threads) {
+#if defined(HFPX3D_USE_MKL)
+            prev_ = mkl_set_num_threads_local(n_threads);
+#elif defined(HFPX3D_USE_OPENBLAS)
+            prev_ = openblas_get_num_threads();
+            if (prev_ != n_threads) {
+                openblas_set_num_threads(n_threads);
+            }
+#elif defined(HFPX3D_USE_BLIS)
+            prev_ = static_cast<int>(bli_thread_get_num_threads());
+            if (prev_ != n_threads) {
+                bli_thread_set_num_threads(n_threads);
+            }
+#endif
+        }
+        ~LA_Thread_Guard_T() {
+#if defined(HFPX3D_USE_MKL)
+            mkl_set_num_threads_local(prev_);
+#endif
+        }
+        LA_Thread_Guard_T(const LA_Thread_Guard_T &) = delete;
+        LA_Thread_Guard_T &operator=(const LA_Thread_Guard_T &) = delete;
+    };
+#endif // HFPX3D_LA_VENDOR
+
+    // Matrix product
+    void la_gemm
+            (const Dense_LA_T &la,
+             double alpha,
+             const il::Array2D<double> &a, bool tr_a,
+             const il::Array2D<double> &b, bool tr_b,
+             double beta,
+             il::io_t, il::Array2D<double> &c) {
+        IL_EXPECT_FAST(la_is_available(la.backend));
+        IL_EXPECT_FAST(la.n_threads >= 1);
+        const il::int_t m = c.size(0);
+        const il::int_t n = c.size(1);
+        const il::int_t k = tr_a ? a.size(0) : a.size(1);
+        IL_EXPECT_FAST((tr_a ? a.size(1) : a.size(0)) == m);
+        IL_EXPECT_FAST((tr_b ? b.size(1) : b.size(0)) == k);
+        IL_EXPECT_FAST((tr_b ? b.size(0) : b.size(1)) == n);
+        if (m == 0 || n == 0) {
+            return;
+        }
+
+#ifdef HFPX3D_LA_VENDOR
+        if (la.backend != LA_Backend_T::reference) {
+            LA_Thread_Guard_T t_guard{la.n_threads};
+            const char t_a = tr_a ? 'T' : 'N', t_b = tr_b ? 'T' : 'N';
+            const la_int m_ = m, n_ = n, k_ = k;
+            // (column stride of il::Array2D is capacity(0))
+            const la_int ld_a = a.capacity(0) > 0 ? a.capacity(0) : 1;
+            const la_int ld_b = b.capacity(0) > 0 ? b.capacity(0) : 1;
+            const la_int ld_c = c.capacity(0);
+            dgemm_(&t_a, &t_b, &m_, &n_, &k_, &alpha, a.data(), &ld_a,
+                   b.data(), &ld_b, &beta, c.data(), &ld_c);
+            return;
+        }
+#endif
+
+        // reference implementation (columns of c in parallel)
+#pragma omp parallel for num_threads(la.n_threads) if(la.n_threads > 1)
+        for (il::int_t j = 0; j < n; ++j) {
+            for (il::int_t i = 0; i < m; ++i) {
+                c(i, j) = (beta == 0.0) ? 0.0 : beta * c(i, j);
+            }
+            if (alpha == 0.0) {
+                continue;
+            }
+            for (il::int_t l = 0; l < k; ++l) {
+                const double b_lj = alpha * (tr_b ? b(j, l) : b(l, j));
+                if (b_lj == 0.0) {
+                    continue;
+                }
+                if (tr_a) {
+                    for (il::int_t i = 0; i < m; ++i) {
+                        c(i, j) += a(l, i) * b_lj;
+                    }
+                } else {
+                    for (il::int_t i = 0; i < m; ++i) {
+                        c(i, j) += a(i, l) * b_lj;
+                    }
+                }
+            }
+        }
+    }
+
+    // LU decomposition
+    void la_getrf
+            (const Dense_LA_T &la,
+             il::io_t, il::Array2D<double> &a,
+             il::Array<il::int_t> &piv, il::Status &status) {
+        IL_EXPECT_FAST(la_is_available(la.backend));
+        IL_EXPECT_FAST(la.n_threads >= 1);
+        const il::int_t n = a.size(0);
+        IL_EXPECT_FAST(a.size(1) == n);
+        piv = il::Array<il::int_t>{n};
+
+#ifdef HFPX3D_LA_VENDOR
+        if (la.backend != LA_Backend_T::reference) {
+            LA_Thread_Guard_T t_guard{la.n_threads};
+            const la_int n_ = n;
+            const la_int ld_a = a.capacity(0) > 0 ? a.capacity(0) : 1;
+            la_int info = 0;
+            il::Array<la_int> ipiv{n > 0 ? n : 1};
+            dgetrf_(&n_, &n_, a.data(), &ld_a, ipiv.data(), &info);
+            IL_EXPECT_FAST(info >= 0);
+            for (il::int_t i = 0; i < n; ++i) {
+                piv[i] = static_cast<il::int_t>(ipiv[i]) - 1;
+            }
+            if (info > 0) {
+                status.set_error(il::Error::MatrixSingular);
+                IL_SET_SOURCE(status);
+                return;
+            }
+            status.set_ok();
+            return;
+        }
+#endif
+
+        // reference implementation (right-looking, rank-1 updates
+        // of the columns in parallel)
+        for (il::int_t k = 0; k < n; ++k) {
+            il::int_t p = k;
+            double a_max = std::fabs(a(k, k));
+            for (il::int_t i = k + 1; i < n; ++i) {
+                if (std::fabs(a(i, k)) > a_max) {
+                    a_max = std::fabs(a(i, k));
+                    p = i;
+                }
+            }
+            piv[k] = p;
+            if (a_max == 0.0) {
+                status.set_error(il::Error::MatrixSingular);
+                IL_SET_SOURCE(status);
+                return;
+            }
+            if (p != k) {
+                for (il::int_t j = 0; j < n; ++j) {
+                    double t = a(k, j);
+                    a(k, j) = a(p, j);
+                    a(p, j) = t;
+                }
+            }
+            const double a_kk = a(k, k);
+            for (il::int_t i = k + 1; i < n; ++i) {
+                a(i, k) /= a_kk;
+            }
+#pragma omp parallel for num_threads(la.n_threads) if(la.n_threads > 1)
+            for (il::int_t j = k + 1; j < n; ++j) {
+                const double u_kj = a(k, j);
+                if (u_kj == 0.0) {
+                    continue;
+                }
+                for (il::int_t i = k + 1; i < n; ++i) {
+                    a(i, j) -= a(i, k) * u_kj;
+                }
+            }
+        }
+        status.set_ok();
+    }
+
+    // Solution of the system with LU-decomposed matrix
+    void la_getrs
+            (const Dense_LA_T &la,
+             const il::Array2D<double> &lu,
+             const il::Array<il::int_t> &piv,
+             il::io_t, il::Array2D<double> &b) {
+        IL_EXPECT_FAST(la_is_available(la.backend));
+        IL_EXPECT_FAST(la.n_threads >= 1);
+        const il::int_t n = lu.size(0);
+        const il::int_t n_rhs = b.size(1);
+        IL_EXPECT_FAST(lu.size(1) == n);
+        IL_EXPECT_FAST(piv.size() == n);
+        IL_EXPECT_FAST(b.size(0) == n);
+        if (n == 0 || n_rhs == 0) {
+            return;
+        }
+
+#ifdef HFPX3D_LA_VENDOR
+        if (la.backend != LA_Backend_T::reference) {
+            LA_Thread_Guard_T t_guard{la.n_threads};
+            const char tr = 'N';
+            const la_int n_ = n, n_rhs_ = n_rhs;
+            const la_int ld_lu = lu.capacity(0), ld_b = b.capacity(0);
+            la_int info = 0;
+            il::Array<la_int> ipiv{n};
+            for (il::int_t i = 0; i < n; ++i) {
+                ipiv[i] = static_cast<la_int>(piv[i] + 1);
+            }
+            dgetrs_(&tr, &n_, &n_rhs_, lu.data(), &ld_lu, ipiv.data(),
+                    b.data(), &ld_b, &info);
+            IL_EXPECT_FAST(info == 0);
+            return;
+        }
+#endif
+
+        // reference implementation (right-hand sides in parallel)
+#pragma omp parallel for num_threads(la.n_threads) if(la.n_threads > 1)
+        for (il::int_t j = 0; j < n_rhs; ++j) {
+            // row interchanges
+            for (il::int_t k = 0; k < n; ++k) {
+                il::int_t p = piv[k];
+                if (p != k) {
+                    double t = b(k, j);
+                    b(k, j) = b(p, j);
+                    b(p, j) = t;
+                }
+            }
+            // forward substitution (L, unit diagonal)
+            for (il::int_t k = 0; k < n; ++k) {
+                const double b_k = b(k, j);
+                if (b_k == 0.0) {
+                    continue;
+                }
+                for (il::int_t i = k + 1; i < n; ++i) {
+                    b(i, j) -= lu(i, k) * b_k;
+                }
+            }
+            // back substitution (U)
+            for (il::int_t k = n - 1; k >= 0; --k) {
+                b(k, j) /= lu(k, k);
+                const double b_k = b(k, j);
+                if (b_k == 0.0) {
+                    continue;
+                }
+                for (il::int_t i = 0; i < k; ++i) {
+                    b(i, j) -= lu(i, k) * b_k;
+                }
+            }
+        }
+    }
+
+    il::Array<double> la_getrs
+            (const Dense_LA_T &la,
+             const il::Array2D<double> &lu,
+             const il::Array<il::int_t> &piv,
+             const il::Array<double> &rhs) {
+        const il::int_t n = rhs.size();
+        il::Array2D<double> b{n, 1};
+        for (il::int_t i = 0; i < n; ++i) {
+            b(i, 0) = rhs[i];
+        }
+        la_getrs(la, lu, piv, il::io, b);
+        il::Array<double> x{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            x[i] = b(i, 0);
+        }
+        return x;
+    }
+
+}
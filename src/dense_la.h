@@ -0,0 +1,94 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Dense linear algebra (matrix product, LU decomposition & solution)
+// with a selectable backend: the built-in reference implementation
+// or the vendor BLAS/LAPACK chosen at configure time by one of
+// -DHFPX3D_USE_MKL, -DHFPX3D_USE_OPENBLAS, -DHFPX3D_USE_BLIS
+// (BLIS has to be linked with a LAPACK library for dgetrf & dgetrs;
+// -DHFPX3D_LA_ILP64 for 64-bit integer interfaces).
+// The number of threads used by the backend is set for each call
+// (see Dense_LA_T::n_threads)
+
+#ifndef INC_HFPX3D_DENSE_LA_H
+#define INC_HFPX3D_DENSE_LA_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+
+namespace hfp3d {
+
+    enum class LA_Backend_T { reference, mkl, openblas, blis };
+
+    // the vendor backend linked (reference if none)
+    inline LA_Backend_T la_linked_backend() {
+#if defined(HFPX3D_USE_MKL)
+        return LA_Backend_T::mkl;
+#elif defined(HFPX3D_USE_OPENBLAS)
+        return LA_Backend_T::openblas;
+#elif defined(HFPX3D_USE_BLIS)
+        return LA_Backend_T::blis;
+#else
+        return LA_Backend_T::reference;
+#endif
+    }
+
+    // the reference backend & the linked one are available at runtime
+    inline bool la_is_available(LA_Backend_T backend) {
+        return backend == LA_Backend_T::reference ||
+               backend == la_linked_backend();
+    }
+
+    // backend selection & thread control
+    struct Dense_LA_T {
+        LA_Backend_T backend = la_linked_backend();
+        // number of threads of the backend during a call;
+        // with MKL it applies to the calling thread only, while
+        // OpenBLAS & BLIS have one process-wide number: concurrent calls
+        // (e.g. from parallel assembly threads) have to use the same
+        // n_threads, otherwise they are not thread-safe
+        int n_threads = 1;
+    };
+
+    // c = alpha * op(a) * op(b) + beta * c,
+    // op(a) = a^T if tr_a, a otherwise (same for b)
+    void la_gemm
+            (const Dense_LA_T &la,
+             double alpha,
+             const il::Array2D<double> &a, bool tr_a,
+             const il::Array2D<double> &b, bool tr_b,
+             double beta,
+             il::io_t, il::Array2D<double> &c);
+
+    // LU decomposition with partial (row) pivoting in place (as dgetrf):
+    // row k has been interchanged with row piv[k] (0-based)
+    void la_getrf
+            (const Dense_LA_T &la,
+             il::io_t, il::Array2D<double> &a,
+             il::Array<il::int_t> &piv, il::Status &status);
+
+    // Solution of the system with LU-decomposed matrix (as dgetrs)
+    // for the columns of b (in place)
+    void la_getrs
+            (const Dense_LA_T &la,
+             const il::Array2D<double> &lu,
+             const il::Array<il::int_t> &piv,
+             il::io_t, il::Array2D<double> &b);
+
+    // (same, one right-hand side)
+    il::Array<double> la_getrs
+            (const Dense_LA_T &la,
+             const il::Array2D<double> &lu,
+             const il::Array<il::int_t> &piv,
+             const il::Array<double> &rhs);
+
+}
+
+#endif //INC_HFPX3D_DENSE_LA_H
@@ -0,0 +1,46 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <il/StaticArray2D.h>
+#include "el2el_cache.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    El2El_Cache::El2El_Cache
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par) :
+            e_c_(mu, nu),
+            cp_cache_(mu, nu, n_par.cp_tol,
+                      get_mesh_length_scale(mesh),
+                      n_par.is_cp_reuse ? n_par.cp_max_size : 0),
+            nf_cache_(mu, nu, n_par.beta,
+                      n_par.nf_tol,
+                      n_par.is_nf_reuse ? n_par.nf_max_size : 0) {
+        is_cp_reuse_ = n_par.is_cp_reuse;
+        is_nf_reuse_ = n_par.is_nf_reuse;
+    }
+
+    il::StaticArray2D<double, 18, 18> El2El_Cache::el2el
+            (const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local) {
+        // the near field first: adjacent pairs are similar (up to scaling)
+        // more often than congruent
+        if (is_nf_reuse_ && nf_cache_.is_adjacent(src_el, trg_el)) {
+            return nf_cache_.el2el_adj(src_el, trg_el, is_dd_local);
+        }
+        if (is_cp_reuse_) {
+            return cp_cache_.el2el(src_el, trg_el, is_dd_local);
+        }
+        return make_el2el_3dbem_submatrix(e_c_, src_el, trg_el, is_dd_local);
+    }
+
+}
@@ -0,0 +1,53 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Element-to-element influence with the reuse options of Num_Param_T:
+// adjacent (and self-) element pairs are taken from the near-field cache
+// (is_nf_reuse), the other pairs from the congruent-pair cache
+// (is_cp_reuse); both caches are bounded (nf_max_size, cp_max_size)
+
+#ifndef INC_HFPX3D_EL2EL_CACHE_H
+#define INC_HFPX3D_EL2EL_CACHE_H
+
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+#include "element_utilities.h"
+#include "h_potential.h"
+#include "congruent_pairs.h"
+#include "near_field_cache.h"
+
+namespace hfp3d {
+
+    class El2El_Cache {
+    private:
+        Elast_Const_T e_c_;
+        bool is_cp_reuse_, is_nf_reuse_;
+        Congr_Pair_Cache cp_cache_;
+        Near_Field_Cache nf_cache_;
+
+    public:
+        El2El_Cache
+                (double mu, double nu,
+                 const Mesh_Geom_T &mesh,
+                 const Num_Param_T &n_par);
+
+        // Element-to-element influence matrix
+        // (same as make_el2el_3dbem_submatrix)
+        il::StaticArray2D<double, 18, 18> el2el
+                (const Element_Struct_T &src_el,
+                 const Element_Struct_T &trg_el,
+                 bool is_dd_local);
+
+        const Congr_Pair_Cache &cp_cache() const { return cp_cache_; }
+        const Near_Field_Cache &nf_cache() const { return nf_cache_; }
+    };
+
+}
+
+#endif //INC_HFPX3D_EL2EL_CACHE_H
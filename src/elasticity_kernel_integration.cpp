@@ -11,6 +11,7 @@
 // over a part of a polygonal element (a sector associated with one edge)
 // with 2nd order polynomial approximating (shape) functions.
 
+#include <cmath>
 #include <complex>
 #include <il/math.h>
 #include <il/StaticArray.h>
@@ -18,6 +19,7 @@
 #include <il/StaticArray4D.h>
 #include "elasticity_kernel_integration.h"
 #include "h_potential.h"
+#include "vector_math.h"
 //#include "t_potential.h"
 
 namespace hfp3d {
@@ -32,12 +34,12 @@ namespace hfp3d {
 
     il::StaticArray4D<std::complex<double>, 6, 4, 3, 9> s_integral_gen
             (const int kernel_id,
-             double nu, std::complex<double> eix,
-             double h, std::complex<double> d) {
+             const Elast_Const_T &e_c, std::complex<double> eix,
+             double h, std::complex<double> d, int c_mask) {
         il::StaticArray4D<std::complex<double>, 6, 4, 3, 9> c;
         switch (kernel_id) {
             case 1:
-                c = s_ij_gen_h(nu, eix, h, d);
+                c = s_ij_gen_h(e_c, eix, h, d, c_mask);
                 break;
             case 0:
                 // c = s_ij_gen_t(nu, eix, h, d);
@@ -49,12 +51,12 @@ namespace hfp3d {
 
     il::StaticArray4D<std::complex<double>, 6, 4, 3, 5> s_integral_red
             (const int kernel_id,
-             double nu, std::complex<double> eix,
-             double h) {
+             const Elast_Const_T &e_c, std::complex<double> eix,
+             double h, int c_mask) {
         il::StaticArray4D<std::complex<double>, 6, 4, 3, 5> c;
         switch (kernel_id) {
             case 1:
-                c = s_ij_red_h(nu, eix, h);
+                c = s_ij_red_h(e_c, eix, h, c_mask);
                 break;
             case 0:
                 // c = s_ij_red_t(nu, eix, h, d);
@@ -66,12 +68,12 @@ namespace hfp3d {
 
     il::StaticArray3D<std::complex<double>, 6, 4, 3> s_integral_lim
             (const int kernel_id,
-             double nu, std::complex<double> eix,
+             const Elast_Const_T &e_c, std::complex<double> eix,
              std::complex<double> d) {
         il::StaticArray3D<std::complex<double>, 6, 4, 3> c;
         switch (kernel_id) {
             case 1:
-                c = s_ij_lim_h(nu, eix, d);
+                c = s_ij_lim_h(e_c, eix, d);
                 break;
             case 0:
                 // c = s_ij_lim_t(nu, eix, sgnh, d);
@@ -84,72 +86,64 @@ namespace hfp3d {
 
 // Constituing functions for the integrals
 // of any kernel of the elasticity equation
-// over a part of a polygonal element.
-// Example of usage:
-// dot(S11_22H(nu, eix, h, d), integral_cst_fun(h, d, a, x, eix))
-// dot(S11_22H_red(nu, eip, h, d), integral_cst_fun_red(h, d, a))
-// dot(S13_23T(nu, eix, h, d), integral_cst_fun(h, d, a, x, eix))
-// dot(S33T_red(nu, eip, h, d), integral_cst_fun_red(h, d, a))
-// where eip = std::exp(I*std::arg(t-z));
-// eix = std::exp(I*x); x = std::arg(t-z)-std::arg(d);
-// a = std::fabs(t-z-d)*sign(x);
+// over a part of a polygonal element (see the header)
 
 // General case (h!=0, collocation point projected into or outside the element)
 // powers of r, g0=arctan((ah)/(dr)),
 // f0=arctanh(a/r) and its derivatives w.r. to h
 
-    il::StaticArray<std::complex<double>, 9> integral_cst_fun
-            (double h, std::complex<double> d, double a,
-             double x, std::complex<double> eix) {
-
-        double abs_d = std::abs(d), d2 = abs_d * abs_d, a2 = a * a,
-                r = std::sqrt(h * h + a2 + d2),
-                r2 = r * r, r3 = r2 * r, r5 = r3 * r2,
-                ar = a / r, ar2 = ar * ar,
-                hr = std::fabs(h / r),
-                b = 1.0 / (r2 - a2), b2 = b * b, b3 = b2 * b;
-        double tah_x = std::imag(eix) / std::real(eix), tr = hr * tah_x,
-                g0 = std::atan(tr), f0 = std::atanh(ar),
-                f1 = -0.5 * ar * b, f2 = 0.25 * (3.0 - ar2) * ar * b2,
-                f3 = -0.125 * (15.0 - 10.0 * ar2 + 3.0 * ar2 * ar2) * ar * b3;
-
-        il::StaticArray<std::complex<double>, 9> fun_list{0.0};
-        fun_list[0] = r;
-        fun_list[1] = 1.0 / r;
-        fun_list[2] = 1.0 / r3;
-        fun_list[3] = 1.0 / r5;
-        fun_list[4] = g0 - x;
-        fun_list[5] = f0;
-        fun_list[6] = f1;
-        fun_list[7] = f2;
-        fun_list[8] = f3;
-
-        return fun_list;
+    void integral_cst_fun_v
+            (il::int_t n_pt,
+             const double *h, const double *abs_d, const double *a,
+             const double *cos_x, const double *sin_x,
+             il::io_t, double *fun) {
+#pragma omp simd
+        for (il::int_t i = 0; i < n_pt; ++i) {
+            double d2 = abs_d[i] * abs_d[i], a2 = a[i] * a[i],
+                    r = std::sqrt(h[i] * h[i] + a2 + d2),
+                    r2 = r * r, r3 = r2 * r, r5 = r3 * r2,
+                    ar = a[i] / r, ar2 = ar * ar,
+                    hr = std::fabs(h[i] / r),
+                    b = 1.0 / (r2 - a2), b2 = b * b, b3 = b2 * b;
+            double c_x = cos_x[i], s_x = sin_x[i];
+            // g0 - x = arctan((hr - 1) * tan_x / (1 + hr * tan_x^2))
+            // (-+ pi if |x| > pi/2)
+            double g0_x = vm_atan((hr - 1.0) * s_x * c_x /
+                                  (c_x * c_x + hr * s_x * s_x));
+            g0_x += (c_x < 0.0) ? ((s_x < 0.0) ? M_PI : -M_PI) : 0.0;
+            fun[i] = r;
+            fun[n_pt + i] = 1.0 / r;
+            fun[2 * n_pt + i] = 1.0 / r3;
+            fun[3 * n_pt + i] = 1.0 / r5;
+            fun[4 * n_pt + i] = g0_x;
+            fun[5 * n_pt + i] = vm_atanh(ar);
+            fun[6 * n_pt + i] = -0.5 * ar * b;
+            fun[7 * n_pt + i] = 0.25 * (3.0 - ar2) * ar * b2;
+            fun[8 * n_pt + i] = -0.125 *
+                    (15.0 - 10.0 * ar2 + 3.0 * ar2 * ar2) * ar * b3;
+        }
     }
 
 // Special case (reduced summation,
 // collocation point projected onto the element contour) - additional terms
 
-    il::StaticArray<std::complex<double>, 5> integral_cst_fun_red
-            (double h, std::complex<double> d, double a) {
-
-        double h2 = h * h, h4 = h2 * h2, h6 = h4 * h2,
-                abs_d = std::abs(d), d2 = abs_d * abs_d, a2 = a * a,
-                ro = std::sqrt(a2 + d2),
-                r = std::sqrt(h2 + a2 + d2),
-                rr = ro / r, rr2 = rr * rr, rr4 = rr2 * rr2,
-                f0 = std::atanh(rr), f1 = -0.5 * rr / h2, f2 =
-                0.25 * (3.0 - rr2) * rr / h4,
-                f3 = -0.125 * (15.0 - 10.0 * rr2 + 3.0 * rr4) * rr / h6;
-
-        il::StaticArray<std::complex<double>, 5> fun_list{0.0};
-        fun_list[0] = 1.0;
-        fun_list[1] = f0;
-        fun_list[2] = f1;
-        fun_list[3] = f2;
-        fun_list[4] = f3;
-
-        return fun_list;
+    void integral_cst_fun_red_v
+            (il::int_t n_pt,
+             const double *h, const double *abs_d, const double *a,
+             il::io_t, double *fun) {
+#pragma omp simd
+        for (il::int_t i = 0; i < n_pt; ++i) {
+            double h2 = h[i] * h[i], h4 = h2 * h2, h6 = h4 * h2,
+                    d2 = abs_d[i] * abs_d[i], a2 = a[i] * a[i],
+                    ro = std::sqrt(a2 + d2),
+                    r = std::sqrt(h2 + a2 + d2),
+                    rr = ro / r, rr2 = rr * rr, rr4 = rr2 * rr2;
+            fun[i] = 1.0;
+            fun[n_pt + i] = vm_atanh(rr);
+            fun[2 * n_pt + i] = -0.5 * rr / h2;
+            fun[3 * n_pt + i] = 0.25 * (3.0 - rr2) * rr / h4;
+            fun[4 * n_pt + i] = -0.125 * (15.0 - 10.0 * rr2 + 3.0 * rr4) * rr / h6;
+        }
     }
 
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <il/StaticArray.h>
 #include <il/StaticArray3D.h>
 #include <il/StaticArray4D.h>
+#include "h_potential.h"
 
 // Integration of a kernel of the elasticity equation
 // over a part of a polygonal element (a sector associated with one edge)
@@ -27,42 +28,78 @@ namespace hfp3d {
 // associated with each node of the element (via left multiplication)
 //
 // Stress components (vs local Cartesian coordinate system of the element)
-// combined as S11+S22, S11-S22+2*I*S12, S13+I*S23, S33
+// combined as S11+S22, S11-S22+2*I*S12, S13+I*S23, S33;
+// only the components in c_mask (s_mask_* in h_potential.h) are calculated
 
     il::StaticArray4D<std::complex<double>, 6, 4, 3, 9> s_integral_gen
                 (const int ker,
-                 double nu, std::complex<double> eix,
-                 double h, std::complex<double> d);
+                 const Elast_Const_T &e_c, std::complex<double> eix,
+                 double h, std::complex<double> d, int c_mask);
 
     il::StaticArray4D<std::complex<double>, 6, 4, 3, 5> s_integral_red
                 (const int kernel_id,
-                 double nu, std::complex<double> eix,
-                 double h);
+                 const Elast_Const_T &e_c, std::complex<double> eix,
+                 double h, int c_mask);
 
     il::StaticArray3D<std::complex<double>, 6, 4, 3> s_integral_lim
                 (const int ker,
-                 double nu, std::complex<double> eix,
+                 const Elast_Const_T &e_c, std::complex<double> eix,
                  std::complex<double> d);
 
 
 // Constituing functions for the integrals
 // of any kernel of the elasticity equation
-// over a part of a polygonal element.
-// Example of usage:
-// dot(S11_22H(nu, eix, h, d), integral_cst_fun(h, d, a, x, eix))
-// dot(S11_22H_red(nu, eip, h, d), integral_cst_fun_red(h, d, a))
-// dot(S13_23T(nu, eix, h, d), integral_cst_fun(h, d, a, x, eix))
-// dot(S33T_red(nu, eip, h, d), integral_cst_fun_red(h, d, a))
-// where eip = std::exp(I*std::arg(t-z));
-// eix = std::exp(I*x); x = std::arg(t-z)-std::arg(d);
-// a = std::fabs(t-z-d)*sign(x);
-
-    il::StaticArray<std::complex<double>, 9> integral_cst_fun
-            (double h, std::complex<double> d, double a,
-             double x, std::complex<double> eix);
-
-    il::StaticArray<std::complex<double>, 5> integral_cst_fun_red
-            (double h, std::complex<double> d, double a);
+// over a part of a polygonal element (real-valued),
+// evaluated for n_pt points at once:
+// inputs h[i], abs_d[i] = |d|, a[i], cos_x[i] + I*sin_x[i] = eix,
+// function k of point i is fun[k * n_pt + i] (9 or 5 functions)
+// where eix = std::exp(I*x); x = std::arg(t-z)-std::arg(d);
+// a = std::fabs(t-z-d)*sign(x).
+// Example of usage (see make_local_3dbem_infl_nod_v):
+// add_s_integral_dot(1.0, s_integral_gen(ker, e_c, eix, h, d, c_mask),
+// fun + i, n_pt, c_mask, il::io, s) with fun from integral_cst_fun_v;
+// add_s_integral_dot(1.0, s_integral_red(ker, e_c, eip, h, c_mask),
+// fun + i, n_pt, c_mask, il::io, s) with fun from integral_cst_fun_red_v;
+// where eip = std::exp(I*std::arg(t-z))
+
+    void integral_cst_fun_v
+            (il::int_t n_pt,
+             const double *h, const double *abs_d, const double *a,
+             const double *cos_x, const double *sin_x,
+             il::io_t, double *fun);
+
+    void integral_cst_fun_red_v
+            (il::int_t n_pt,
+             const double *h, const double *abs_d, const double *a,
+             il::io_t, double *fun);
+
+// Contraction of the coefficients with real constituing functions
+// (f[k * f_stride], k = 0 ... n_f - 1): s += alpha * dot(c, f)
+// for the stress components in c_mask
+
+    template <il::int_t n_f>
+    void add_s_integral_dot
+            (double alpha,
+             const il::StaticArray4D<std::complex<double>, 6, 4, 3, n_f> &c,
+             const double *f, il::int_t f_stride, int c_mask,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        for (il::int_t l = 0; l < 3; ++l) {
+            for (il::int_t k = 0; k < 4; ++k) {
+                if (!(c_mask & (1 << k))) {
+                    continue;
+                }
+                for (il::int_t j = 0; j < 6; ++j) {
+                    double s_re = 0.0, s_im = 0.0;
+                    for (il::int_t m = 0; m < n_f; ++m) {
+                        s_re += std::real(c(j, k, l, m)) * f[m * f_stride];
+                        s_im += std::imag(c(j, k, l, m)) * f[m * f_stride];
+                    }
+                    s(j, k, l) += std::complex<double>
+                            (alpha * s_re, alpha * s_im);
+                }
+            }
+        }
+    }
 
 }
 
@@ -335,29 +335,6 @@ namespace hfp3d {
 // "weights" vertex_wts
     //};
 
-    il::StaticArray2D<std::complex<double>, 6, 6> shift_el_sfm
-            (std::complex<double> z) {
-        // "shifted" sfm from z, tau[m], and local sfm
-        std::complex<double> zc = std::conj(z);
-        il::StaticArray2D<std::complex<double>, 6, 6> shift_2_z{0.0};
-        shift_2_z(0, 0) = 1.0;
-        shift_2_z(1, 0) = z;
-        shift_2_z(1, 1) = 1.0;
-        shift_2_z(2, 0) = zc;
-        shift_2_z(2, 2) = 1.0;
-        shift_2_z(3, 0) = z * z;
-        shift_2_z(3, 1) = 2.0 * z;
-        shift_2_z(3, 3) = 1.0;
-        shift_2_z(4, 0) = zc * zc;
-        shift_2_z(4, 2) = 2.0 * zc;
-        shift_2_z(4, 4) = 1.0;
-        shift_2_z(5, 0) = z * zc;
-        shift_2_z(5, 1) = zc;
-        shift_2_z(5, 2) = z;
-        shift_2_z(5, 5) = 1.0;
-        return shift_2_z;
-    }
-
 // Collocation points
 
     il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_uniform
@@ -451,6 +428,9 @@ namespace hfp3d {
         //ele_s.sf_m = make_el_sfm_nonuniform
         // (ele_s.r_tensor, ele_s.el_vert, ele_s.vert_wts);
 
+        // Complex-valued positions of the vertices
+        ele_s.tau = make_el_tau_crd(ele_s.vert, ele_s.r_tensor);
+
         // Collocation points' coordinates
         ele_s.cp_crd = el_cp_uniform(ele_s.vert, beta);
         //ele_s.cp_crd = el_cp_nonuniform(ele_s.vert, ele_s.vert_wts, beta);
@@ -33,6 +33,8 @@ namespace hfp3d {
         il::StaticArray2D<double, 3, 3> r_tensor;
         // collocation points' coordinates
         il::StaticArray<il::StaticArray<double, 3>, 6> cp_crd;
+        // complex-valued positions of the vertices in local coordinates
+        il::StaticArray<std::complex<double>, 3> tau;
         // coefficienta of basis (shape) functions of the el-t
         il::StaticArray2D<std::complex<double>, 6, 6> sf_m;
         // values of nodal SF at collocation points
@@ -76,8 +78,25 @@ namespace hfp3d {
     // double beta,
     // il::io_t, il::StaticArray2D<double, 3, 3> &r_tensor);
 
-    il::StaticArray2D<std::complex<double>, 6, 6> shift_el_sfm
-            (std::complex<double> z);
+    // j-th row of sfm with the local coordinate shifted by z
+    // (coefficients of the same shape function in powers of tau - z);
+    // the shift matrix is sparse (lower triangular),
+    // so only 11 complex products are needed
+    inline void shift_el_sfm_row
+            (const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             int j, std::complex<double> z,
+             il::io_t, il::StaticArray<std::complex<double>, 6> &sfm_z_j) {
+        const std::complex<double> zc = std::conj(z);
+        const std::complex<double> s_1 = sfm(j, 1), s_2 = sfm(j, 2),
+                s_3 = sfm(j, 3), s_4 = sfm(j, 4), s_5 = sfm(j, 5);
+        sfm_z_j[0] = sfm(j, 0) + z * (s_1 + z * s_3) +
+                     zc * (s_2 + zc * s_4 + z * s_5);
+        sfm_z_j[1] = s_1 + 2.0 * z * s_3 + zc * s_5;
+        sfm_z_j[2] = s_2 + 2.0 * zc * s_4 + z * s_5;
+        sfm_z_j[3] = s_3;
+        sfm_z_j[4] = s_4;
+        sfm_z_j[5] = s_5;
+    }
 
 // Collocation points
 
@@ -12,22 +12,89 @@
 #ifndef INC_HFPX3D_H_POTENTIAL_H
 #define INC_HFPX3D_H_POTENTIAL_H
 
+#include <cmath>
 #include <complex>
 #include <il/StaticArray3D.h>
 #include <il/StaticArray4D.h>
 
 namespace hfp3d {
 
+    // Material constants of the (H-) kernel: Poisson's ratio combinations
+    // used by s_ij_gen_h, s_ij_red_h & s_ij_lim_h (c_1_2nu = 1 + 2*nu,
+    // c_1_m2nu = 1 - 2*nu, etc.) and the scaling of the stress influence;
+    // to be created once per material (mu, nu); constexpr instances
+    // (e.g. constexpr Elast_Const_T e_c{1.0, 0.25};) are evaluated
+    // at compile time
+    struct Elast_Const_T {
+        double mu, nu;
+        // -mu / (4 * pi * (1 - nu))
+        double scale;
+        double c_1_nu, c_1_2nu, c_2_nu, c_3_nu, c_3_2nu, c_4_nu, c_5_4nu,
+                c_6_nu, c_7_2nu, c_7_5nu, c_7_6nu, c_11_4nu, c_11_5nu,
+                c_12_nu, c_13_2nu, c_13_10nu;
+        double c_1_mnu, c_1_m2nu, c_2_mnu, c_3_mnu, c_3_m4nu, c_5_mnu,
+                c_5_m2nu, c_5_m4nu, c_6_m5nu, c_7_m2nu, c_8_m5nu, c_9_m2nu,
+                c_9_m4nu, c_9_m8nu, c_13_m2nu, c_15_m4nu, c_15_m8nu,
+                c_115_m38nu_80;
+
+        constexpr Elast_Const_T(double mu_, double nu_) :
+                mu(mu_), nu(nu_),
+                scale(-mu_ / (4.0 * M_PI * (1.0 - nu_))),
+                c_1_nu(1.0 + nu_),
+                c_1_2nu(1.0 + 2.0 * nu_),
+                c_2_nu(2.0 + nu_),
+                c_3_nu(3.0 + nu_),
+                c_3_2nu(3.0 + 2.0 * nu_),
+                c_4_nu(4.0 + nu_),
+                c_5_4nu(5.0 + 4.0 * nu_),
+                c_6_nu(6.0 + nu_),
+                c_7_2nu(7.0 + 2.0 * nu_),
+                c_7_5nu(7.0 + 5.0 * nu_),
+                c_7_6nu(7.0 + 6.0 * nu_),
+                c_11_4nu(11.0 + 4.0 * nu_),
+                c_11_5nu(11.0 + 5.0 * nu_),
+                c_12_nu(12.0 + nu_),
+                c_13_2nu(13.0 + 2.0 * nu_),
+                c_13_10nu(13.0 + 10.0 * nu_),
+                c_1_mnu(1.0 - nu_),
+                c_1_m2nu(1.0 - 2.0 * nu_),
+                c_2_mnu(2.0 - nu_),
+                c_3_mnu(3.0 - nu_),
+                c_3_m4nu(3.0 - 4.0 * nu_),
+                c_5_mnu(5.0 - nu_),
+                c_5_m2nu(5.0 - 2.0 * nu_),
+                c_5_m4nu(5.0 - 4.0 * nu_),
+                c_6_m5nu(6.0 - 5.0 * nu_),
+                c_7_m2nu(7.0 - 2.0 * nu_),
+                c_8_m5nu(8.0 - 5.0 * nu_),
+                c_9_m2nu(9.0 - 2.0 * nu_),
+                c_9_m4nu(9.0 - 4.0 * nu_),
+                c_9_m8nu(9.0 - 8.0 * nu_),
+                c_13_m2nu(13.0 - 2.0 * nu_),
+                c_15_m4nu(15.0 - 4.0 * nu_),
+                c_15_m8nu(15.0 - 8.0 * nu_),
+                c_115_m38nu_80(1.4375 - 0.475 * nu_) {}
+    };
+
+    // Masks of the stress components (2nd index of the coefficient
+    // arrays) to be calculated: S11+S22, S11-S22+2*I*S12, S13+I*S23, S33;
+    // the coefficients of the components not in c_mask are left zero
+    constexpr int s_mask_11_22 = 1;
+    constexpr int s_mask_11_m22 = 2;
+    constexpr int s_mask_13_23 = 4;
+    constexpr int s_mask_33 = 8;
+    constexpr int s_mask_all = 15;
+
     il::StaticArray4D<std::complex<double>, 6, 4, 3, 9> s_ij_gen_h
-            (double nu, std::complex<double> eix,
-             double h, std::complex<double> d);
+            (const Elast_Const_T &k_c, std::complex<double> eix,
+             double h, std::complex<double> d, int c_mask);
 
     il::StaticArray4D<std::complex<double>, 6, 4, 3, 5> s_ij_red_h
-            (double nu, std::complex<double> eix,
-             double h);
+            (const Elast_Const_T &k_c, std::complex<double> eix,
+             double h, int c_mask);
 
     il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_lim_h
-            (double nu, std::complex<double> eix,
+            (const Elast_Const_T &k_c, std::complex<double> eix,
              std::complex<double> d);
 
 }
@@ -0,0 +1,429 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <string>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+#include "system_assembly.h"
+#include "time_stepping.h"
+#include "leak_off.h"
+#include "hfp3d_c_api.h"
+
+// model: mesh, parameters, the stepper (assembled system
+// & factorizations) & the solution
+struct hfp3d_model {
+    double mu = 0.0, nu = 0.0;
+    hfp3d::Mesh_Geom_T mesh{};
+    hfp3d::Num_Param_T n_par{};
+    hfp3d::Time_Step_Param_T ts_par{};
+    hfp3d::Load_T load{};
+    hfp3d::Mesh_Data_T m_data{};
+    hfp3d::Leak_Off_T leak_off{};
+    bool is_assembled = false;
+    hfp3d::VC_Stepper_T vc_st{};
+    hfp3d::Time_Step_Stat_T ts_stat{};
+    // stress matrix of the latest points of hfp3d_get_stress
+    // (kept while the points & the assembly do not change)
+    mutable il::Array2D<double> s_pts{};
+    mutable il::Array2D<double> s_matrix{};
+    // (set by the getters as well)
+    mutable std::string error{};
+};
+
+namespace hfp3d {
+
+    // error code & message
+    int c_api_error
+            (const hfp3d_model *model,
+             int code,
+             const char *msg) {
+        if (model != nullptr) {
+            model->error = msg;
+        }
+        return code;
+    }
+
+    int c_api_ok
+            (const hfp3d_model *model) {
+        model->error.clear();
+        return HFP3D_OK;
+    }
+
+}
+
+extern "C" {
+
+int hfp3d_create
+        (const double *nods, int nods_dim, int64_t n_nods,
+         const int64_t *conn, int conn_dim, int64_t n_el,
+         int is_matlab,
+         double mu, double nu,
+         hfp3d_model **model) {
+    if (model == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    *model = nullptr;
+    if (nods == nullptr || conn == nullptr || nods_dim < 3 ||
+        conn_dim < 3 || n_nods < 3 || n_el < 1 ||
+        !(mu > 0.0) || !(nu > -1.0 && nu < 0.5)) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    const int64_t base = is_matlab ? 1 : 0;
+    for (int64_t el = 0; el < n_el; ++el) {
+        for (int64_t j = 0; j < 3; ++j) {
+            const int64_t n = conn[conn_dim * el + j];
+            if (n < base || n >= n_nods + base) {
+                return HFP3D_ERR_ARGUMENT;
+            }
+        }
+    }
+    try {
+        hfp3d_model *m = new hfp3d_model{};
+        m->mu = mu;
+        m->nu = nu;
+        m->mesh.nods = il::Array2D<double>{nods_dim, n_nods};
+        for (il::int_t n = 0; n < n_nods; ++n) {
+            for (il::int_t j = 0; j < nods_dim; ++j) {
+                m->mesh.nods(j, n) = nods[nods_dim * n + j];
+            }
+        }
+        // (only the vertex nodes are renumbered, as in mesh_file_io)
+        m->mesh.conn = il::Array2D<il::int_t>{conn_dim, n_el};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t j = 0; j < conn_dim; ++j) {
+                m->mesh.conn(j, el) = conn[conn_dim * el + j] -
+                                      ((j < 3) ? base : 0);
+            }
+        }
+        m->m_data.mesh = &m->mesh;
+        *model = m;
+    } catch (const std::bad_alloc &) {
+        return HFP3D_ERR_INTERNAL;
+    } catch (...) {
+        return HFP3D_ERR_INTERNAL;
+    }
+    return HFP3D_OK;
+}
+
+void hfp3d_destroy
+        (hfp3d_model *model) {
+    delete model;
+}
+
+const char *hfp3d_last_error
+        (const hfp3d_model *model) {
+    if (model == nullptr) {
+        return "no model";
+    }
+    return model->error.c_str();
+}
+
+int hfp3d_set_num_param
+        (hfp3d_model *model,
+         double beta, int tip_type, int is_dd_local) {
+    if (model == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!(beta > 0.0 && beta < 1.0) || tip_type < 0 || tip_type > 2) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_ARGUMENT,
+                                  "beta in (0, 1), tip_type 0, 1, or 2");
+    }
+    model->n_par.beta = beta;
+    model->n_par.tip_type = tip_type;
+    model->n_par.is_dd_local = (is_dd_local != 0);
+    model->is_assembled = false;
+    return hfp3d::c_api_ok(model);
+}
+
+int hfp3d_set_time_step_param
+        (hfp3d_model *model,
+         double dt_ini, double dt_min, double rate_target,
+         int64_t n_iter_max) {
+    if (model == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!(dt_min > 0.0) || !(dt_ini >= dt_min) || !(rate_target > 0.0) ||
+        n_iter_max < 1) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_ARGUMENT,
+                                  "0 < dt_min <= dt_ini, rate_target > 0, "
+                                  "n_iter_max >= 1");
+    }
+    model->ts_par.dt_ini = dt_ini;
+    model->ts_par.dt_min = dt_min;
+    model->ts_par.rate_target = rate_target;
+    model->ts_par.n_iter_max = n_iter_max;
+    model->ts_par.n_iter_target =
+            std::min(model->ts_par.n_iter_target, model->ts_par.n_iter_max);
+    return hfp3d::c_api_ok(model);
+}
+
+int hfp3d_set_leak_off
+        (hfp3d_model *model,
+         double c_l) {
+    if (model == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!(c_l >= 0.0)) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_ARGUMENT, "c_l >= 0");
+    }
+    try {
+        model->leak_off = hfp3d::make_leak_off
+                (model->mesh, model->n_par, il::Array<il::int_t>{}, c_l);
+    } catch (const std::bad_alloc &) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL, "out of memory");
+    } catch (...) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL,
+                                  "internal error");
+    }
+    return hfp3d::c_api_ok(model);
+}
+
+int hfp3d_assemble
+        (hfp3d_model *model) {
+    if (model == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    try {
+        model->is_assembled = false;
+        model->vc_st = hfp3d::make_vc_stepper
+                (model->mu, model->nu, model->mesh, model->n_par);
+        const il::int_t n_nod = 6 * model->mesh.conn.size(1);
+        if (model->m_data.dd.size(0) != n_nod) {
+            model->m_data.dd = il::Array2D<double>{n_nod, 3, 0.0};
+            model->m_data.pp = il::Array<double>{n_nod, 0.0};
+        }
+        // leak-off areas for the current numerical parameters
+        // (the exposure times & the leaked volume are kept)
+        if (model->leak_off.area_w.size() > 0) {
+            hfp3d::Leak_Off_T leak_off = hfp3d::make_leak_off
+                    (model->mesh, model->n_par, il::Array<il::int_t>{},
+                     model->leak_off.c_l);
+            leak_off.t_exp = model->leak_off.t_exp;
+            leak_off.vol_lost = model->leak_off.vol_lost;
+            model->leak_off = leak_off;
+        }
+        model->s_pts = il::Array2D<double>{};
+        model->s_matrix = il::Array2D<double>{};
+        model->is_assembled = true;
+    } catch (const std::bad_alloc &) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL, "out of memory");
+    } catch (...) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL,
+                                  "internal error");
+    }
+    return hfp3d::c_api_ok(model);
+}
+
+int hfp3d_step
+        (hfp3d_model *model,
+         const double *s_inf,
+         double inj_rate,
+         double dt) {
+    if (model == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (s_inf == nullptr || !(dt > 0.0) || !std::isfinite(inj_rate)) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_ARGUMENT,
+                                  "s_inf (6), finite inj_rate, dt > 0");
+    }
+    if (!model->is_assembled) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_STATE,
+                                  "the system is not assembled");
+    }
+    for (il::int_t k = 0; k < 6; ++k) {
+        model->load.s_inf[k] = s_inf[k];
+    }
+    // constant rate over the increment
+    model->load.inj_rate = il::Array<double>{1, inj_rate};
+    model->load.inj_time = il::Array<double>{};
+    hfp3d::Time_Step_Param_T ts_par = model->ts_par;
+    ts_par.t_end = model->m_data.time + dt;
+    ts_par.dt_max = dt;
+    ts_par.dt_ini = std::min(ts_par.dt_ini, dt);
+    ts_par.dt_min = std::min(ts_par.dt_min, ts_par.dt_ini);
+    il::Status status{};
+    try {
+        hfp3d::vc_advance(model->mesh, model->n_par, model->load, ts_par,
+                          il::io, model->vc_st, model->m_data,
+                          model->leak_off, model->ts_stat, status);
+    } catch (const std::bad_alloc &) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL, "out of memory");
+    } catch (...) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL,
+                                  "internal error");
+    }
+    if (!status.ok()) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_SOLVER,
+                                  "time stepping failed (contact "
+                                  "iterations or a singular system)");
+    }
+    return hfp3d::c_api_ok(model);
+}
+
+int hfp3d_get_size
+        (const hfp3d_model *model,
+         int64_t *n_el, int64_t *n_nodes) {
+    if (model == nullptr || n_el == nullptr || n_nodes == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    *n_el = model->mesh.conn.size(1);
+    *n_nodes = 6 * model->mesh.conn.size(1);
+    return HFP3D_OK;
+}
+
+int hfp3d_get_time
+        (const hfp3d_model *model,
+         double *time) {
+    if (model == nullptr || time == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    *time = model->m_data.time;
+    return HFP3D_OK;
+}
+
+int hfp3d_get_dd
+        (const hfp3d_model *model,
+         double *dd) {
+    if (model == nullptr || dd == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!model->is_assembled) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_STATE,
+                                  "the system is not assembled");
+    }
+    const il::int_t n_nod = model->m_data.dd.size(0);
+    for (il::int_t n = 0; n < n_nod; ++n) {
+        for (il::int_t j = 0; j < 3; ++j) {
+            dd[3 * n + j] = model->m_data.dd(n, j);
+        }
+    }
+    return HFP3D_OK;
+}
+
+int hfp3d_get_pressure
+        (const hfp3d_model *model,
+         double *pp) {
+    if (model == nullptr || pp == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!model->is_assembled) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_STATE,
+                                  "the system is not assembled");
+    }
+    for (il::int_t n = 0; n < model->m_data.pp.size(); ++n) {
+        pp[n] = model->m_data.pp[n];
+    }
+    return HFP3D_OK;
+}
+
+int hfp3d_get_volume
+        (const hfp3d_model *model,
+         double *vol, double *vol_lost) {
+    if (model == nullptr || vol == nullptr || vol_lost == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!model->is_assembled) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_STATE,
+                                  "the system is not assembled");
+    }
+    // (the volume row of the VC matrix)
+    const hfp3d::DoF_Handle_T &dof_h = model->vc_st.orig_dof_h;
+    double v = 0.0;
+    try {
+        il::Array<double> x = hfp3d::get_dd_vector_from_md
+                (model->m_data, dof_h, false, dof_h);
+        for (il::int_t j = 0; j < dof_h.n_dof; ++j) {
+            v += model->vc_st.orig_matrix(dof_h.n_dof, j) * x[j];
+        }
+    } catch (const std::bad_alloc &) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL, "out of memory");
+    } catch (...) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL,
+                                  "internal error");
+    }
+    *vol = v;
+    *vol_lost = model->leak_off.vol_lost;
+    return HFP3D_OK;
+}
+
+int hfp3d_get_stress
+        (const hfp3d_model *model,
+         const double *pts, int64_t n_pts,
+         double *stress) {
+    if (model == nullptr || pts == nullptr || stress == nullptr ||
+        n_pts < 0) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    if (!model->is_assembled) {
+        return hfp3d::c_api_error(model, HFP3D_ERR_STATE,
+                                  "the system is not assembled");
+    }
+    if (n_pts == 0) {
+        return HFP3D_OK;
+    }
+    try {
+        // the stress matrix is built again only for new points
+        bool is_same = (model->s_pts.size(1) == n_pts) &&
+                       (model->s_matrix.size(0) == 6 * n_pts);
+        for (il::int_t p = 0; p < n_pts && is_same; ++p) {
+            for (il::int_t j = 0; j < 3; ++j) {
+                is_same = is_same && (model->s_pts(j, p) == pts[3 * p + j]);
+            }
+        }
+        if (!is_same) {
+            model->s_matrix = il::Array2D<double>{};
+            model->s_pts = il::Array2D<double>{3, n_pts};
+            for (il::int_t p = 0; p < n_pts; ++p) {
+                for (il::int_t j = 0; j < 3; ++j) {
+                    model->s_pts(j, p) = pts[3 * p + j];
+                }
+            }
+            model->s_matrix = hfp3d::make_3dbem_stress_f_s
+                    (model->mu, model->nu, model->mesh, model->n_par,
+                     model->s_pts);
+        }
+        il::Array2D<double> s = hfp3d::get_3dbem_stress_s
+                (model->s_matrix, model->m_data);
+        for (il::int_t p = 0; p < n_pts; ++p) {
+            for (il::int_t k = 0; k < 6; ++k) {
+                stress[6 * p + k] = s(k, p);
+            }
+        }
+    } catch (const std::bad_alloc &) {
+        model->s_pts = il::Array2D<double>{};
+        model->s_matrix = il::Array2D<double>{};
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL, "out of memory");
+    } catch (...) {
+        model->s_pts = il::Array2D<double>{};
+        model->s_matrix = il::Array2D<double>{};
+        return hfp3d::c_api_error(model, HFP3D_ERR_INTERNAL,
+                                  "internal error");
+    }
+    return HFP3D_OK;
+}
+
+int hfp3d_get_stats
+        (const hfp3d_model *model,
+         int64_t *n_steps, int64_t *n_fact, int64_t *n_solves) {
+    if (model == nullptr || n_steps == nullptr || n_fact == nullptr ||
+        n_solves == nullptr) {
+        return HFP3D_ERR_ARGUMENT;
+    }
+    *n_steps = model->ts_stat.n_steps;
+    *n_fact = model->ts_stat.n_fact;
+    *n_solves = model->ts_stat.n_solves;
+    return HFP3D_OK;
+}
+
+}
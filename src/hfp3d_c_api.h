@@ -0,0 +1,151 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// C interface of the Volume Control solver, e.g. for a reservoir
+// simulator calling it once per coupling step. The model (opaque handle)
+// keeps the mesh, the assembled system, the LU factorizations
+// and the solution between the calls, so that a step (injection
+// increment) only solves with the stored factorizations unless
+// the set of closed nodes changes.
+// The shared library (exporting the hfp3d_* functions only) is built
+// by build_c_api.sh, i.e. with -DHFPX3D_BUILD_DLL -fvisibility=hidden.
+// The functions return HFP3D_OK or an error code
+// (see hfp3d_last_error for the message); arrays are node-wise
+// (node = 6 * element + local node of the quadratic element)
+
+#ifndef INC_HFPX3D_HFP3D_C_API_H
+#define INC_HFPX3D_HFP3D_C_API_H
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(HFPX3D_BUILD_DLL)
+#define HFP3D_API __declspec(dllexport)
+#else
+#define HFP3D_API __declspec(dllimport)
+#endif
+#else
+#define HFP3D_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// model (opaque handle)
+typedef struct hfp3d_model hfp3d_model;
+
+// error codes
+enum {
+    HFP3D_OK = 0,
+    // invalid argument
+    HFP3D_ERR_ARGUMENT = 1,
+    // the system is not assembled (hfp3d_assemble)
+    HFP3D_ERR_STATE = 2,
+    // the time step failed (the model stays at the last accepted time)
+    HFP3D_ERR_SOLVER = 3,
+    // out of memory, etc.
+    HFP3D_ERR_INTERNAL = 4
+};
+
+// Creation of a model from the mesh: nods (nods_dim * n_nods: x, y, z
+// of each node), conn (conn_dim * n_el: vertex nodes of each element,
+// numbered from 1 if is_matlab, from 0 otherwise),
+// shear modulus mu & Poisson's ratio nu; nods_dim = conn_dim = 5
+// for the extended mesh (marking the tip, see make_dof_h_crack)
+HFP3D_API int hfp3d_create
+        (const double *nods, int nods_dim, int64_t n_nods,
+         const int64_t *conn, int conn_dim, int64_t n_el,
+         int is_matlab,
+         double mu, double nu,
+         hfp3d_model **model);
+
+HFP3D_API void hfp3d_destroy
+        (hfp3d_model *model);
+
+// message of the last error ("" after a successful call of a function
+// changing the model; the getters only set it on an error)
+HFP3D_API const char *hfp3d_last_error
+        (const hfp3d_model *model);
+
+// numerical parameters (see Num_Param_T); the system has to be
+// assembled again after the change
+HFP3D_API int hfp3d_set_num_param
+        (hfp3d_model *model,
+         double beta, int tip_type, int is_dd_local);
+
+// time stepping parameters within an increment (see Time_Step_Param_T)
+HFP3D_API int hfp3d_set_time_step_param
+        (hfp3d_model *model,
+         double dt_ini, double dt_min, double rate_target,
+         int64_t n_iter_max);
+
+// Carter's leak-off coefficient (all elements; no node exposed yet);
+// the nodal areas follow the numerical parameters at hfp3d_assemble
+HFP3D_API int hfp3d_set_leak_off
+        (hfp3d_model *model,
+         double c_l);
+
+// Assembly of the system (kept until the model is destroyed)
+HFP3D_API int hfp3d_assemble
+        (hfp3d_model *model);
+
+// One injection increment: from the current time to time + dt
+// at the rate inj_rate under the stress at infinity
+// s_inf (6: s11, s22, s33, s12, s13, s23)
+HFP3D_API int hfp3d_step
+        (hfp3d_model *model,
+         const double *s_inf,
+         double inj_rate,
+         double dt);
+
+// number of elements & of (DD) nodes, i.e. 6 * n_el
+HFP3D_API int hfp3d_get_size
+        (const hfp3d_model *model,
+         int64_t *n_el, int64_t *n_nodes);
+
+HFP3D_API int hfp3d_get_time
+        (const hfp3d_model *model,
+         double *time);
+
+// DD (3 * n_nodes), in the local coordinates of the elements
+// unless is_dd_local == 0
+HFP3D_API int hfp3d_get_dd
+        (const hfp3d_model *model,
+         double *dd);
+
+// fluid pressure (n_nodes)
+HFP3D_API int hfp3d_get_pressure
+        (const hfp3d_model *model,
+         double *pp);
+
+// fracture volume & the volume leaked off
+HFP3D_API int hfp3d_get_volume
+        (const hfp3d_model *model,
+         double *vol, double *vol_lost);
+
+// stress (6 * n_pts, order as in s_inf) induced by DD
+// at the points pts (3 * n_pts); the stress matrix of the points
+// is kept in the model and reused while the same points are passed
+// (no concurrent calls on the same model)
+HFP3D_API int hfp3d_get_stress
+        (const hfp3d_model *model,
+         const double *pts, int64_t n_pts,
+         double *stress);
+
+// time steps, LU factorizations & solutions (all increments)
+HFP3D_API int hfp3d_get_stats
+        (const hfp3d_model *model,
+         int64_t *n_steps, int64_t *n_fact, int64_t *n_solves);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //INC_HFPX3D_HFP3D_C_API_H
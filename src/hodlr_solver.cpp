@@ -0,0 +1,937 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <algorithm>
+#include <unordered_map>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "hodlr_solver.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    // data for the evaluation of the matrix entries
+    struct HODLR_Asm_T {
+        const Elast_Const_T *e_c;
+        bool is_dd_local;
+        // element properties (in cluster order)
+        il::Array<Element_Struct_T> el_s{};
+        // position of the 1st DoF of each element (in cluster order)
+        il::Array<il::int_t> el_p0{};
+        // element (position in cluster order) & local DoF number (0..17)
+        // of each DoF (in cluster order)
+        il::Array<il::int_t> dof_e{}, dof_l{};
+    };
+
+    // cluster tree: node for the elements e0 ... e1 - 1 of c_ele
+    // & its descendants (recursive bisection)
+    il::int_t add_hodlr_nodes
+            (const il::Array<il::StaticArray<double, 3>> &el_ctr,
+             il::int_t leaf_size,
+             il::int_t e0, il::int_t e1,
+             il::io_t, il::Array<il::int_t> &c_ele,
+             il::Array<HODLR_Node_T> &node) {
+        const il::int_t nd = node.size();
+        node.append(HODLR_Node_T{});
+        node[nd].e0 = e0;
+        node[nd].e1 = e1;
+        if (e1 - e0 <= leaf_size) {
+            return nd;
+        }
+
+        // bounding box of the element centroids: the longest side
+        il::StaticArray<double, 3> x_min = el_ctr[c_ele[e0]];
+        il::StaticArray<double, 3> x_max = el_ctr[c_ele[e0]];
+        for (il::int_t k = e0 + 1; k < e1; ++k) {
+            for (int i = 0; i < 3; ++i) {
+                x_min[i] = std::fmin(x_min[i], el_ctr[c_ele[k]][i]);
+                x_max[i] = std::fmax(x_max[i], el_ctr[c_ele[k]][i]);
+            }
+        }
+        int ax = 0;
+        for (int i = 1; i < 3; ++i) {
+            if (x_max[i] - x_min[i] > x_max[ax] - x_min[ax]) {
+                ax = i;
+            }
+        }
+
+        // median split
+        const il::int_t e_m = (e0 + e1) / 2;
+        std::nth_element(c_ele.data() + e0, c_ele.data() + e_m,
+                         c_ele.data() + e1,
+                         [&el_ctr, ax](il::int_t a, il::int_t b) {
+                             return el_ctr[a][ax] < el_ctr[b][ax];
+                         });
+        il::int_t c_1 = add_hodlr_nodes
+                (el_ctr, leaf_size, e0, e_m, il::io, c_ele, node);
+        il::int_t c_2 = add_hodlr_nodes
+                (el_ctr, leaf_size, e_m, e1, il::io, c_ele, node);
+        node[nd].child[0] = c_1;
+        node[nd].child[1] = c_2;
+        return nd;
+    }
+
+    // bounding boxes of the nodes (children first)
+    void set_hodlr_boxes
+            (const il::Array<Element_Struct_T> &el_s,
+             il::io_t, il::Array<HODLR_Node_T> &node) {
+        for (il::int_t nd = node.size() - 1; nd >= 0; --nd) {
+            HODLR_Node_T &n_d = node[nd];
+            if (n_d.child[0] < 0) {
+                for (int i = 0; i < 3; ++i) {
+                    n_d.x_min[i] = el_s[n_d.e0].vert(i, 0);
+                    n_d.x_max[i] = el_s[n_d.e0].vert(i, 0);
+                }
+                for (il::int_t k = n_d.e0; k < n_d.e1; ++k) {
+                    for (int j = 0; j < 3; ++j) {
+                        for (int i = 0; i < 3; ++i) {
+                            n_d.x_min[i] = std::fmin(n_d.x_min[i],
+                                                     el_s[k].vert(i, j));
+                            n_d.x_max[i] = std::fmax(n_d.x_max[i],
+                                                     el_s[k].vert(i, j));
+                        }
+                    }
+                }
+            } else {
+                const HODLR_Node_T &n_1 = node[n_d.child[0]];
+                const HODLR_Node_T &n_2 = node[n_d.child[1]];
+                for (int i = 0; i < 3; ++i) {
+                    n_d.x_min[i] = std::fmin(n_1.x_min[i], n_2.x_min[i]);
+                    n_d.x_max[i] = std::fmax(n_1.x_max[i], n_2.x_max[i]);
+                }
+            }
+        }
+    }
+
+    // partition of the block (rows of t, columns of s) into admissible
+    // (low-rank) blocks and dense blocks of the leaves
+    void add_hodlr_blocks
+            (const il::Array<HODLR_Node_T> &node,
+             double adm_eta,
+             il::int_t t, il::int_t s,
+             il::io_t, il::Array<HODLR_Blk_T> &blk) {
+        const HODLR_Node_T &t_nd = node[t];
+        const HODLR_Node_T &s_nd = node[s];
+        double dist2 = 0.0, diam2_t = 0.0, diam2_s = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            double gap = std::fmax(0.0,
+                                   std::fmax(t_nd.x_min[i] - s_nd.x_max[i],
+                                             s_nd.x_min[i] - t_nd.x_max[i]));
+            double d_t = t_nd.x_max[i] - t_nd.x_min[i];
+            double d_s = s_nd.x_max[i] - s_nd.x_min[i];
+            dist2 += gap * gap;
+            diam2_t += d_t * d_t;
+            diam2_s += d_s * d_s;
+        }
+        const bool is_adm = dist2 > 0.0 &&
+                std::fmin(diam2_t, diam2_s) <= adm_eta * adm_eta * dist2;
+        const bool is_leaf_t = t_nd.child[0] < 0;
+        const bool is_leaf_s = s_nd.child[0] < 0;
+        if (is_adm || (is_leaf_t && is_leaf_s)) {
+            HODLR_Blk_T b{};
+            b.t = t;
+            b.s = s;
+            b.is_low_rank = is_adm;
+            blk.append(b);
+            return;
+        }
+        // the larger (or the non-leaf) cluster is split
+        if (!is_leaf_t && (is_leaf_s || diam2_t >= diam2_s)) {
+            for (int c = 0; c < 2; ++c) {
+                add_hodlr_blocks(node, adm_eta, t_nd.child[c], s,
+                                 il::io, blk);
+            }
+        } else {
+            for (int c = 0; c < 2; ++c) {
+                add_hodlr_blocks(node, adm_eta, t, s_nd.child[c],
+                                 il::io, blk);
+            }
+        }
+    }
+
+    // dense block of the matrix (rows of t_nd, columns of s_nd)
+    il::Array2D<double> get_hodlr_dense
+            (const HODLR_Asm_T &ha,
+             const HODLR_Node_T &t_nd,
+             const HODLR_Node_T &s_nd) {
+        il::Array2D<double> a{t_nd.i1 - t_nd.i0, s_nd.i1 - s_nd.i0, 0.0};
+        for (il::int_t k_s = s_nd.e0; k_s < s_nd.e1; ++k_s) {
+            for (il::int_t k_t = t_nd.e0; k_t < t_nd.e1; ++k_t) {
+                il::StaticArray2D<double, 18, 18> trac_infl =
+                        make_el2el_3dbem_submatrix
+                                (*ha.e_c, ha.el_s[k_s], ha.el_s[k_t],
+                                 ha.is_dd_local);
+                for (il::int_t q = ha.el_p0[k_s];
+                     q < ha.el_p0[k_s + 1]; ++q) {
+                    for (il::int_t p = ha.el_p0[k_t];
+                         p < ha.el_p0[k_t + 1]; ++p) {
+                        a(p - t_nd.i0, q - s_nd.i0) =
+                                trac_infl(ha.dof_l[p], ha.dof_l[q]);
+                    }
+                }
+            }
+        }
+        return a;
+    }
+
+    // rows & columns of the block (rows of t_nd, columns of s_nd)
+    // computed from the kernel; the influence on all traction components
+    // at a collocation point (row panel) and of all DoF of a source element
+    // (column panel) is computed at once and kept, as ACA takes
+    // the next pivot in the same element more often than not
+    struct HODLR_Kernel_Get_T {
+        const HODLR_Asm_T *ha;
+        const HODLR_Node_T *t_nd, *s_nd;
+        // row panels (3 rows) by 6 * target element + collocation point
+        std::unordered_map<il::int_t, il::Array2D<double>> row_pnl;
+        // column panels (18 columns) by source element
+        std::unordered_map<il::int_t, il::Array2D<double>> col_pnl;
+
+        void row(il::int_t i, il::io_t, il::Array<double> &row_i) {
+            const il::int_t p = t_nd->i0 + i;
+            const il::int_t k_t = ha->dof_e[p];
+            const il::int_t l = ha->dof_l[p];
+            auto it = row_pnl.find(6 * k_t + l / 3);
+            if (it == row_pnl.end()) {
+                const Element_Struct_T &trg_el = ha->el_s[k_t];
+                il::StaticArray<double, 3> nrm_cp_glob;
+                for (int j = 0; j < 3; ++j) {
+                    nrm_cp_glob[j] = -trg_el.r_tensor(2, j);
+                }
+                il::Array2D<double> pnl{3, s_nd->i1 - s_nd->i0};
+                for (il::int_t k = s_nd->e0; k < s_nd->e1; ++k) {
+                    const Element_Struct_T &src_el = ha->el_s[k];
+                    il::StaticArray<double, 3> nrm_cp_loc =
+                            il::dot(src_el.r_tensor, nrm_cp_glob);
+                    HZ hz = make_el_pt_hz
+                            (src_el.vert, trg_el.cp_crd[l / 3],
+                             src_el.r_tensor);
+                    il::StaticArray2D<double, 3, 18> trac_el2p =
+                            rotate_el2p_trac_submatrix
+                                    (make_local_3dbem_trac_submatrix
+                                             (1, *ha->e_c, hz.h, hz.z,
+                                              src_el.tau, src_el.sf_m,
+                                              nrm_cp_loc),
+                                     src_el.r_tensor, ha->is_dd_local);
+                    for (il::int_t q = ha->el_p0[k];
+                         q < ha->el_p0[k + 1]; ++q) {
+                        for (int c = 0; c < 3; ++c) {
+                            pnl(c, q - s_nd->i0) =
+                                    trac_el2p(c, ha->dof_l[q]);
+                        }
+                    }
+                }
+                it = row_pnl.emplace(6 * k_t + l / 3, std::move(pnl)).first;
+            }
+            const il::Array2D<double> &pnl = it->second;
+            for (il::int_t j = 0; j < pnl.size(1); ++j) {
+                row_i[j] = pnl(l % 3, j);
+            }
+        }
+
+        void col(il::int_t j, il::io_t, il::Array<double> &col_j) {
+            const il::int_t q = s_nd->i0 + j;
+            const il::int_t k_s = ha->dof_e[q];
+            auto it = col_pnl.find(k_s);
+            if (it == col_pnl.end()) {
+                const Element_Struct_T &src_el = ha->el_s[k_s];
+                il::Array2D<double> pnl{t_nd->i1 - t_nd->i0, 18};
+                for (il::int_t k = t_nd->e0; k < t_nd->e1; ++k) {
+                    il::StaticArray2D<double, 18, 18> trac_infl =
+                            make_el2el_3dbem_submatrix
+                                    (*ha->e_c, src_el, ha->el_s[k],
+                                     ha->is_dd_local);
+                    for (il::int_t l = 0; l < 18; ++l) {
+                        for (il::int_t p = ha->el_p0[k];
+                             p < ha->el_p0[k + 1]; ++p) {
+                            pnl(p - t_nd->i0, l) =
+                                    trac_infl(ha->dof_l[p], l);
+                        }
+                    }
+                }
+                it = col_pnl.emplace(k_s, std::move(pnl)).first;
+            }
+            const il::Array2D<double> &pnl = it->second;
+            const il::int_t l = ha->dof_l[q];
+            for (il::int_t i = 0; i < pnl.size(0); ++i) {
+                col_j[i] = pnl(i, l);
+            }
+        }
+    };
+
+    // rows & columns of an off-diagonal block (rows of t_nd,
+    // columns of s_nd) from its admissible partition
+    struct HODLR_Blk_Get_T {
+        const il::Array<HODLR_Node_T> *node;
+        const il::Array<HODLR_Blk_T> *blk;
+        const HODLR_Node_T *t_nd, *s_nd;
+
+        void row(il::int_t i, il::io_t, il::Array<double> &row_i) {
+            const il::int_t p = t_nd->i0 + i;
+            for (il::int_t j = 0; j < row_i.size(); ++j) {
+                row_i[j] = 0.0;
+            }
+            for (il::int_t b = 0; b < blk->size(); ++b) {
+                const HODLR_Blk_T &b_k = (*blk)[b];
+                const HODLR_Node_T &t_b = (*node)[b_k.t];
+                const HODLR_Node_T &s_b = (*node)[b_k.s];
+                if (p < t_b.i0 || p >= t_b.i1) {
+                    continue;
+                }
+                double *r = row_i.data() + (s_b.i0 - s_nd->i0);
+                const il::int_t n_s = s_b.i1 - s_b.i0;
+                if (b_k.is_low_rank) {
+                    for (il::int_t k = 0; k < b_k.u.size(1); ++k) {
+                        const double u_pk = b_k.u(p - t_b.i0, k);
+                        for (il::int_t j = 0; j < n_s; ++j) {
+                            r[j] += u_pk * b_k.v(j, k);
+                        }
+                    }
+                } else {
+                    for (il::int_t j = 0; j < n_s; ++j) {
+                        r[j] = b_k.a(p - t_b.i0, j);
+                    }
+                }
+            }
+        }
+
+        void col(il::int_t j, il::io_t, il::Array<double> &col_j) {
+            const il::int_t q = s_nd->i0 + j;
+            for (il::int_t i = 0; i < col_j.size(); ++i) {
+                col_j[i] = 0.0;
+            }
+            for (il::int_t b = 0; b < blk->size(); ++b) {
+                const HODLR_Blk_T &b_k = (*blk)[b];
+                const HODLR_Node_T &t_b = (*node)[b_k.t];
+                const HODLR_Node_T &s_b = (*node)[b_k.s];
+                if (q < s_b.i0 || q >= s_b.i1) {
+                    continue;
+                }
+                double *c = col_j.data() + (t_b.i0 - t_nd->i0);
+                const il::int_t n_t = t_b.i1 - t_b.i0;
+                if (b_k.is_low_rank) {
+                    for (il::int_t k = 0; k < b_k.v.size(1); ++k) {
+                        const double v_qk = b_k.v(q - s_b.i0, k);
+                        for (il::int_t i = 0; i < n_t; ++i) {
+                            c[i] += v_qk * b_k.u(i, k);
+                        }
+                    }
+                } else {
+                    for (il::int_t i = 0; i < n_t; ++i) {
+                        c[i] = b_k.a(i, q - s_b.i0);
+                    }
+                }
+            }
+        }
+    };
+
+    // low-rank approximation u.v^T of the block
+    // (rows of t_nd, columns of s_nd; entries given by get);
+    // ACA with partial pivoting;
+    // the convergence is checked for each traction component
+    // separately, as these can be (nearly) decoupled
+    // (e.g. normal & shear ones for a planar fracture)
+    template <typename Get_T>
+    void make_hodlr_aca
+            (const HODLR_Asm_T &ha,
+             const HODLR_Node_T &t_nd,
+             const HODLR_Node_T &s_nd,
+             double aca_tol,
+             il::int_t max_rank,
+             il::io_t, Get_T &get,
+             il::Array2D<double> &u, il::Array2D<double> &v) {
+        const il::int_t n_a = t_nd.i1 - t_nd.i0;
+        const il::int_t n_b = s_nd.i1 - s_nd.i0;
+        il::Array<double> u_c{}, v_c{};
+        il::Array<bool> is_row_used{n_a, false};
+        il::Array<bool> is_col_used{n_b, false};
+        double appr_norm2 = 0.0;
+        il::int_t rank = 0;
+        il::int_t i_piv = 0;
+        // convergence for rows of each traction component
+        il::StaticArray<bool, 3> is_conv{true};
+        // candidate pivot rows for each component
+        il::StaticArray<il::int_t, 3> i_next{-1};
+        for (il::int_t i = 0; i < n_a; ++i) {
+            is_conv[ha.dof_l[t_nd.i0 + i] % 3] = false;
+        }
+        max_rank = std::min(max_rank, std::min(n_a, n_b));
+        while (rank < max_rank) {
+            // residual row i_piv
+            il::Array<double> row{n_b, 0.0};
+            get.row(i_piv, il::io, row);
+            double row_max = 0.0;
+            for (il::int_t j = 0; j < n_b; ++j) {
+                row_max = std::fmax(row_max, std::fabs(row[j]));
+            }
+            for (il::int_t k = 0; k < rank; ++k) {
+                double u_ik = u_c[k * n_a + i_piv];
+                for (il::int_t j = 0; j < n_b; ++j) {
+                    row[j] -= u_ik * v_c[k * n_b + j];
+                }
+            }
+            is_row_used[i_piv] = true;
+
+            il::int_t j_piv = -1;
+            for (il::int_t j = 0; j < n_b; ++j) {
+                if (!is_col_used[j] && (j_piv < 0 ||
+                        std::fabs(row[j]) > std::fabs(row[j_piv]))) {
+                    j_piv = j;
+                }
+            }
+            if (j_piv < 0) {
+                break;
+            }
+            if (std::fabs(row[j_piv]) <= 1.0E-12 * row_max) {
+                // zero residual row (up to round-off;
+                // e.g. decoupled DD components): trying the next one
+                i_piv = -1;
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    if (!is_row_used[i] &&
+                        !is_conv[ha.dof_l[t_nd.i0 + i] % 3]) {
+                        i_piv = i;
+                        break;
+                    }
+                }
+                if (i_piv < 0) {
+                    break;
+                }
+                continue;
+            }
+            const double row_piv = row[j_piv];
+            for (il::int_t j = 0; j < n_b; ++j) {
+                row[j] /= row_piv;
+            }
+
+            // residual column j_piv
+            il::Array<double> col{n_a, 0.0};
+            get.col(j_piv, il::io, col);
+            for (il::int_t k = 0; k < rank; ++k) {
+                double v_jk = v_c[k * n_b + j_piv];
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    col[i] -= v_jk * u_c[k * n_a + i];
+                }
+            }
+            is_col_used[j_piv] = true;
+
+            // Frobenius norm of the approximation (update)
+            double u2 = 0.0, v2 = 0.0;
+            for (il::int_t i = 0; i < n_a; ++i) {
+                u2 += col[i] * col[i];
+            }
+            for (il::int_t j = 0; j < n_b; ++j) {
+                v2 += row[j] * row[j];
+            }
+            for (il::int_t k = 0; k < rank; ++k) {
+                double uu = 0.0, vv = 0.0;
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    uu += col[i] * u_c[k * n_a + i];
+                }
+                for (il::int_t j = 0; j < n_b; ++j) {
+                    vv += row[j] * v_c[k * n_b + j];
+                }
+                appr_norm2 += 2.0 * uu * vv;
+            }
+            appr_norm2 += u2 * v2;
+            for (il::int_t i = 0; i < n_a; ++i) {
+                u_c.append(col[i]);
+            }
+            for (il::int_t j = 0; j < n_b; ++j) {
+                v_c.append(row[j]);
+            }
+            ++rank;
+
+            if (std::sqrt(u2 * v2) <=
+                aca_tol * std::sqrt(std::fabs(appr_norm2))) {
+                is_conv[ha.dof_l[t_nd.i0 + i_piv] % 3] = true;
+                if (is_conv[0] && is_conv[1] && is_conv[2]) {
+                    break;
+                }
+            }
+            // next pivot row: the row of the next (cyclically) component
+            // not converged yet with max. of the last column having
+            // non-zero entries in the rows of this component
+            // (so that the rank is shared if max_rank is reached)
+            double col_max = 0.0;
+            for (il::int_t i = 0; i < n_a; ++i) {
+                col_max = std::fmax(col_max, std::fabs(col[i]));
+            }
+            for (int c = 0; c < 3; ++c) {
+                il::int_t i_c = -1;
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    if (!is_row_used[i] && ha.dof_l[t_nd.i0 + i] % 3 == c &&
+                        (i_c < 0 ||
+                         std::fabs(col[i]) > std::fabs(col[i_c]))) {
+                        i_c = i;
+                    }
+                }
+                if (i_c >= 0 &&
+                    (std::fabs(col[i_c]) > 1.0E-12 * col_max ||
+                     i_next[c] < 0 || is_row_used[i_next[c]])) {
+                    i_next[c] = i_c;
+                }
+                if (i_c < 0) {
+                    // all rows of this component are used
+                    is_conv[c] = true;
+                }
+            }
+            const il::int_t c_prev = ha.dof_l[t_nd.i0 + i_piv] % 3;
+            i_piv = -1;
+            for (int c_s = 1; c_s <= 3; ++c_s) {
+                const il::int_t c = (c_prev + c_s) % 3;
+                if (!is_conv[c]) {
+                    i_piv = i_next[c];
+                    break;
+                }
+            }
+            if (i_piv < 0) {
+                break;
+            }
+        }
+
+        u = il::Array2D<double>{n_a, rank};
+        v = il::Array2D<double>{n_b, rank};
+        for (il::int_t k = 0; k < rank; ++k) {
+            for (il::int_t i = 0; i < n_a; ++i) {
+                u(i, k) = u_c[k * n_a + i];
+            }
+            for (il::int_t j = 0; j < n_b; ++j) {
+                v(j, k) = v_c[k * n_b + j];
+            }
+        }
+    }
+
+    // HODLR approximation of the Volume Control matrix
+    HODLR_Matrix_T make_3dbem_hodlr_vc
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const HODLR_Param_T &h_par,
+             const DoF_Handle_T &dof_hndl) {
+// This function builds the cluster tree of the elements having
+// active DoF (listed in dof_hndl), assembles the dense diagonal
+// leaf blocks, partitions the off-diagonal blocks of each non-leaf node
+// into admissible (ACA) and dense blocks and recompresses each
+// off-diagonal block into one low-rank block (ACA of the partition)
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        IL_EXPECT_FAST(h_par.leaf_size >= 1);
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+
+        HODLR_Matrix_T hm;
+        hm.n_dof = dof_hndl.n_dof;
+
+        // elements having active DoF & their centroids
+        il::Array<il::StaticArray<double, 3>> el_ctr{num_ele};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            bool is_act = false;
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                if (dof_hndl.dof_h(el, l) >= 0) {
+                    is_act = true;
+                    break;
+                }
+            }
+            if (!is_act) {
+                continue;
+            }
+            hm.c_ele.append(el);
+            il::StaticArray<double, 3> ctr{0.0};
+            for (int j = 0; j < 3; ++j) {
+                il::int_t n = mesh.conn(j, el);
+                for (int i = 0; i < 3; ++i) {
+                    ctr[i] += mesh.nods(i, n) / 3.0;
+                }
+            }
+            el_ctr[el] = ctr;
+        }
+        const il::int_t n_act = hm.c_ele.size();
+        if (n_act == 0) {
+            return hm;
+        }
+
+        // cluster tree
+        add_hodlr_nodes(el_ctr, h_par.leaf_size, 0, n_act,
+                        il::io, hm.c_ele, hm.node);
+
+        // DoF in cluster order
+        const Elast_Const_T e_c{mu, nu};
+        HODLR_Asm_T ha;
+        ha.e_c = &e_c;
+        ha.is_dd_local = n_par.is_dd_local;
+        ha.el_s = il::Array<Element_Struct_T>{n_act};
+        ha.el_p0 = il::Array<il::int_t>{n_act + 1, 0};
+        hm.perm = il::Array<il::int_t>{hm.n_dof};
+        hm.vc_row = il::Array<double>{hm.n_dof, 0.0};
+        hm.vc_col = il::Array<double>{hm.n_dof, 0.0};
+        ha.dof_e = il::Array<il::int_t>{hm.n_dof};
+        ha.dof_l = il::Array<il::int_t>{hm.n_dof};
+        il::int_t p = 0;
+        for (il::int_t k = 0; k < n_act; ++k) {
+            il::int_t el = hm.c_ele[k];
+            ha.el_s[k] = get_mesh_el_struct(mesh, el, n_par.beta);
+            il::StaticArray2D<double, 2, 18> vc_infl =
+                    make_el_vc_submatrix(ha.el_s[k], n_par.is_dd_local);
+            ha.el_p0[k] = p;
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t dof = dof_hndl.dof_h(el, l);
+                if (dof >= 0) {
+                    hm.perm[p] = dof;
+                    ha.dof_e[p] = k;
+                    ha.dof_l[p] = l;
+                    hm.vc_row[p] = vc_infl(0, l);
+                    hm.vc_col[p] = vc_infl(1, l);
+                    ++p;
+                }
+            }
+        }
+        ha.el_p0[n_act] = p;
+        IL_EXPECT_FAST(p == hm.n_dof);
+        for (il::int_t nd = 0; nd < hm.node.size(); ++nd) {
+            hm.node[nd].i0 = ha.el_p0[hm.node[nd].e0];
+            hm.node[nd].i1 = ha.el_p0[hm.node[nd].e1];
+        }
+        set_hodlr_boxes(ha.el_s, il::io, hm.node);
+
+        // dense leaf blocks & off-diagonal blocks: admissible partition,
+        // then recompression for the factorization
+        const il::int_t n_node = hm.node.size();
+#pragma omp parallel for schedule(dynamic)
+        for (il::int_t nd = 0; nd < n_node; ++nd) {
+            HODLR_Node_T &n_d = hm.node[nd];
+            if (n_d.child[0] < 0) {
+                n_d.a = get_hodlr_dense(ha, n_d, n_d);
+                continue;
+            }
+            for (int c = 0; c < 2; ++c) {
+                const il::int_t t = n_d.child[c], s = n_d.child[1 - c];
+                const HODLR_Node_T &t_nd = hm.node[t];
+                const HODLR_Node_T &s_nd = hm.node[s];
+                il::Array<HODLR_Blk_T> &blk = (c == 0) ? n_d.blk_12 :
+                                              n_d.blk_21;
+                add_hodlr_blocks(hm.node, h_par.adm_eta, t, s, il::io, blk);
+                for (il::int_t b = 0; b < blk.size(); ++b) {
+                    HODLR_Blk_T &b_k = blk[b];
+                    const HODLR_Node_T &t_b = hm.node[b_k.t];
+                    const HODLR_Node_T &s_b = hm.node[b_k.s];
+                    if (b_k.is_low_rank) {
+                        HODLR_Kernel_Get_T get{&ha, &t_b, &s_b, {}, {}};
+                        make_hodlr_aca(ha, t_b, s_b,
+                                       h_par.aca_tol, h_par.max_rank,
+                                       il::io, get, b_k.u, b_k.v);
+                    } else {
+                        b_k.a = get_hodlr_dense(ha, t_b, s_b);
+                    }
+                }
+                HODLR_Blk_Get_T get{&hm.node, &blk, &t_nd, &s_nd};
+                make_hodlr_aca(ha, t_nd, s_nd, h_par.aca_tol, h_par.max_rank,
+                               il::io, get,
+                               (c == 0) ? n_d.u_12 : n_d.u_21,
+                               (c == 0) ? n_d.v_12 : n_d.v_21);
+            }
+        }
+        return hm;
+    }
+
+    il::int_t hodlr_n_entries(const HODLR_Matrix_T &hm) {
+        il::int_t n_e = 2 * hm.n_dof;
+        for (il::int_t nd = 0; nd < hm.node.size(); ++nd) {
+            const HODLR_Node_T &n_d = hm.node[nd];
+            for (int c = 0; c < 2; ++c) {
+                const il::Array<HODLR_Blk_T> &blk = (c == 0) ? n_d.blk_12 :
+                                                    n_d.blk_21;
+                for (il::int_t b = 0; b < blk.size(); ++b) {
+                    n_e += blk[b].u.size(0) * blk[b].u.size(1) +
+                           blk[b].v.size(0) * blk[b].v.size(1) +
+                           blk[b].a.size(0) * blk[b].a.size(1);
+                }
+            }
+            n_e += n_d.a.size(0) * n_d.a.size(1) +
+                   n_d.u_12.size(0) * n_d.u_12.size(1) +
+                   n_d.v_12.size(0) * n_d.v_12.size(1) +
+                   n_d.u_21.size(0) * n_d.u_21.size(1) +
+                   n_d.v_21.size(0) * n_d.v_21.size(1);
+        }
+        return n_e;
+    }
+
+    il::int_t hodlr_max_rank(const HODLR_Matrix_T &hm) {
+        il::int_t r = 0;
+        for (il::int_t nd = 0; nd < hm.node.size(); ++nd) {
+            r = std::max(r, std::max(hm.node[nd].u_12.size(1),
+                                     hm.node[nd].u_21.size(1)));
+        }
+        return r;
+    }
+
+    // y += u.(v^T.x)
+    void add_low_rank_dot
+            (const il::Array2D<double> &u,
+             const il::Array2D<double> &v,
+             const double *x,
+             il::io_t, double *y) {
+        for (il::int_t k = 0; k < u.size(1); ++k) {
+            double vx = 0.0;
+            for (il::int_t j = 0; j < v.size(0); ++j) {
+                vx += v(j, k) * x[j];
+            }
+            for (il::int_t i = 0; i < u.size(0); ++i) {
+                y[i] += u(i, k) * vx;
+            }
+        }
+    }
+
+    // y += (blocks).x (x & y in cluster order)
+    void add_hodlr_blk_dot
+            (const il::Array<HODLR_Node_T> &node,
+             const il::Array<HODLR_Blk_T> &blk,
+             const double *x,
+             il::io_t, double *y) {
+        for (il::int_t b = 0; b < blk.size(); ++b) {
+            const HODLR_Blk_T &b_k = blk[b];
+            const il::int_t i0 = node[b_k.t].i0, j0 = node[b_k.s].i0;
+            if (b_k.is_low_rank) {
+                add_low_rank_dot(b_k.u, b_k.v, x + j0, il::io, y + i0);
+            } else {
+                for (il::int_t j = 0; j < b_k.a.size(1); ++j) {
+                    const double x_j = x[j0 + j];
+                    for (il::int_t i = 0; i < b_k.a.size(0); ++i) {
+                        y[i0 + i] += b_k.a(i, j) * x_j;
+                    }
+                }
+            }
+        }
+    }
+
+    // Matrix-vector product
+    il::Array<double> hodlr_dot
+            (const HODLR_Matrix_T &hm,
+             const il::Array<double> &x) {
+        const il::int_t n_dof = hm.n_dof;
+        IL_EXPECT_FAST(x.size() == n_dof + 1);
+        il::Array<double> x_c{n_dof}, y_c{n_dof, 0.0};
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            x_c[p] = x[hm.perm[p]];
+        }
+        for (il::int_t nd = 0; nd < hm.node.size(); ++nd) {
+            const HODLR_Node_T &n_d = hm.node[nd];
+            if (n_d.child[0] < 0) {
+                const il::int_t n = n_d.i1 - n_d.i0;
+                for (il::int_t j = 0; j < n; ++j) {
+                    double x_j = x_c[n_d.i0 + j];
+                    for (il::int_t i = 0; i < n; ++i) {
+                        y_c[n_d.i0 + i] += n_d.a(i, j) * x_j;
+                    }
+                }
+            } else {
+                add_hodlr_blk_dot(hm.node, n_d.blk_12, x_c.data(),
+                                  il::io, y_c.data());
+                add_hodlr_blk_dot(hm.node, n_d.blk_21, x_c.data(),
+                                  il::io, y_c.data());
+            }
+        }
+        il::Array<double> y{n_dof + 1, 0.0};
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            y[hm.perm[p]] = y_c[p] + hm.vc_col[p] * x[n_dof];
+            y[n_dof] += hm.vc_row[p] * x_c[p];
+        }
+        return y;
+    }
+
+    // b := (diagonal block of node nd)^(-1).b (b: DoF of the node)
+    void hodlr_node_solve
+            (const HODLR_Matrix_T &hm,
+             il::int_t nd,
+             il::io_t, il::Array2D<double> &b) {
+        const HODLR_Node_T &n_d = hm.node[nd];
+        if (n_d.child[0] < 0) {
+            la_getrs(hm.la, n_d.lu, n_d.piv, il::io, b);
+            return;
+        }
+        const il::int_t n_1 = hm.node[n_d.child[0]].i1 -
+                              hm.node[n_d.child[0]].i0;
+        const il::int_t n_2 = hm.node[n_d.child[1]].i1 -
+                              hm.node[n_d.child[1]].i0;
+        const il::int_t n_rhs = b.size(1);
+        il::Array2D<double> b_1{n_1, n_rhs}, b_2{n_2, n_rhs};
+        for (il::int_t j = 0; j < n_rhs; ++j) {
+            for (il::int_t i = 0; i < n_1; ++i) {
+                b_1(i, j) = b(i, j);
+            }
+            for (il::int_t i = 0; i < n_2; ++i) {
+                b_2(i, j) = b(n_1 + i, j);
+            }
+        }
+        // y = diag(A_11, A_22)^(-1).b
+        hodlr_node_solve(hm, n_d.child[0], il::io, b_1);
+        hodlr_node_solve(hm, n_d.child[1], il::io, b_2);
+
+        // coupling: x_1 = y_1 - w_12.z_1, x_2 = y_2 - w_21.z_2,
+        // z_1 = v_12^T.x_2, z_2 = v_21^T.x_1
+        const il::int_t k_12 = n_d.u_12.size(1);
+        const il::int_t k_21 = n_d.u_21.size(1);
+        if (k_12 + k_21 > 0) {
+            il::Array2D<double> z_1{k_12, n_rhs}, z_2{k_21, n_rhs};
+            la_gemm(hm.la, 1.0, n_d.v_12, true, b_2, false,
+                    0.0, il::io, z_1);
+            la_gemm(hm.la, 1.0, n_d.v_21, true, b_1, false,
+                    0.0, il::io, z_2);
+            il::Array2D<double> z{k_12 + k_21, n_rhs};
+            for (il::int_t j = 0; j < n_rhs; ++j) {
+                for (il::int_t k = 0; k < k_12; ++k) {
+                    z(k, j) = z_1(k, j);
+                }
+                for (il::int_t k = 0; k < k_21; ++k) {
+                    z(k_12 + k, j) = z_2(k, j);
+                }
+            }
+            la_getrs(hm.la, n_d.k_lu, n_d.k_piv, il::io, z);
+            for (il::int_t j = 0; j < n_rhs; ++j) {
+                for (il::int_t k = 0; k < k_12; ++k) {
+                    z_1(k, j) = z(k, j);
+                }
+                for (il::int_t k = 0; k < k_21; ++k) {
+                    z_2(k, j) = z(k_12 + k, j);
+                }
+            }
+            la_gemm(hm.la, -1.0, n_d.w_12, false, z_1, false,
+                    1.0, il::io, b_1);
+            la_gemm(hm.la, -1.0, n_d.w_21, false, z_2, false,
+                    1.0, il::io, b_2);
+        }
+
+        for (il::int_t j = 0; j < n_rhs; ++j) {
+            for (il::int_t i = 0; i < n_1; ++i) {
+                b(i, j) = b_1(i, j);
+            }
+            for (il::int_t i = 0; i < n_2; ++i) {
+                b(n_1 + i, j) = b_2(i, j);
+            }
+        }
+    }
+
+    // factorization of the diagonal block of node nd (children first)
+    void hodlr_node_factorize
+            (il::int_t nd,
+             il::io_t, HODLR_Matrix_T &hm, il::Status &status) {
+        HODLR_Node_T &n_d = hm.node[nd];
+        if (n_d.child[0] < 0) {
+            n_d.lu = n_d.a;
+            la_getrf(hm.la, il::io, n_d.lu, n_d.piv, status);
+            return;
+        }
+        hodlr_node_factorize(n_d.child[0], il::io, hm, status);
+        if (!status.ok()) {
+            return;
+        }
+        hodlr_node_factorize(n_d.child[1], il::io, hm, status);
+        if (!status.ok()) {
+            return;
+        }
+
+        n_d.w_12 = n_d.u_12;
+        n_d.w_21 = n_d.u_21;
+        hodlr_node_solve(hm, n_d.child[0], il::io, n_d.w_12);
+        hodlr_node_solve(hm, n_d.child[1], il::io, n_d.w_21);
+
+        // coupling matrix [I, v_12^T.w_21; v_21^T.w_12, I]
+        const il::int_t k_12 = n_d.u_12.size(1);
+        const il::int_t k_21 = n_d.u_21.size(1);
+        n_d.k_lu = il::Array2D<double>{k_12 + k_21, k_12 + k_21, 0.0};
+        il::Array2D<double> k_12_21{k_12, k_21}, k_21_12{k_21, k_12};
+        la_gemm(hm.la, 1.0, n_d.v_12, true, n_d.w_21, false,
+                0.0, il::io, k_12_21);
+        la_gemm(hm.la, 1.0, n_d.v_21, true, n_d.w_12, false,
+                0.0, il::io, k_21_12);
+        for (il::int_t k = 0; k < k_12 + k_21; ++k) {
+            n_d.k_lu(k, k) = 1.0;
+        }
+        for (il::int_t j = 0; j < k_21; ++j) {
+            for (il::int_t i = 0; i < k_12; ++i) {
+                n_d.k_lu(i, k_12 + j) = k_12_21(i, j);
+                n_d.k_lu(k_12 + j, i) = k_21_12(j, i);
+            }
+        }
+        la_getrf(hm.la, il::io, n_d.k_lu, n_d.k_piv, status);
+    }
+
+    // Factorization
+    void hodlr_factorize
+            (const HODLR_Param_T &h_par,
+             il::io_t, HODLR_Matrix_T &hm, il::Status &status) {
+// This function factorizes the diagonal blocks of the nodes
+// (from the leaves up) and the Schur complement of the Volume Control
+// system: x = A^(-1).(t - c.p), p = (r^T.A^(-1).t - V) / (r^T.A^(-1).c)
+        IL_EXPECT_FAST(hm.node.size() > 0);
+        hm.la = h_par.la;
+        hm.is_factorized = false;
+        hodlr_node_factorize(0, il::io, hm, status);
+        if (!status.ok()) {
+            return;
+        }
+
+        const il::int_t n_dof = hm.n_dof;
+        il::Array2D<double> w{n_dof, 1};
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            w(p, 0) = hm.vc_col[p];
+        }
+        hodlr_node_solve(hm, 0, il::io, w);
+        hm.vc_w = il::Array<double>{n_dof};
+        hm.vc_s = 0.0;
+        double r_norm = 0.0, w_norm = 0.0;
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            hm.vc_w[p] = w(p, 0);
+            hm.vc_s += hm.vc_row[p] * w(p, 0);
+            r_norm += hm.vc_row[p] * hm.vc_row[p];
+            w_norm += w(p, 0) * w(p, 0);
+        }
+        if (std::fabs(hm.vc_s) <=
+            1.0E-14 * std::sqrt(r_norm * w_norm)) {
+            status.set_error(il::Error::MatrixSingular);
+            IL_SET_SOURCE(status);
+            return;
+        }
+        hm.is_factorized = true;
+        status.set_ok();
+    }
+
+    // Solution of the system
+    il::Array<double> hodlr_solve
+            (const HODLR_Matrix_T &hm,
+             const il::Array<double> &rhs) {
+        IL_EXPECT_FAST(hm.is_factorized);
+        const il::int_t n_dof = hm.n_dof;
+        IL_EXPECT_FAST(rhs.size() == n_dof + 1);
+        il::Array2D<double> y{n_dof, 1};
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            y(p, 0) = rhs[hm.perm[p]];
+        }
+        hodlr_node_solve(hm, 0, il::io, y);
+        double r_y = 0.0;
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            r_y += hm.vc_row[p] * y(p, 0);
+        }
+        const double pr = (r_y - rhs[n_dof]) / hm.vc_s;
+        il::Array<double> x{n_dof + 1};
+        for (il::int_t p = 0; p < n_dof; ++p) {
+            x[hm.perm[p]] = y(p, 0) - hm.vc_w[p] * pr;
+        }
+        x[n_dof] = pr;
+        return x;
+    }
+
+}
@@ -0,0 +1,147 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Hierarchically off-diagonal low-rank (HODLR) approximation
+// of the Volume Control matrix and its direct solver:
+// elements are clustered by recursive geometric bisection,
+// diagonal leaf blocks are dense; the off-diagonal blocks at each level
+// are partitioned by the strong admissibility condition into low-rank
+// blocks (ACA with partial pivoting) of well separated clusters
+// and dense blocks of neighbouring leaves, which represent the matrix
+// (hodlr_dot). For the factorization (recursive Sherman-Morrison-Woodbury
+// formula) each off-diagonal block is recompressed into one low-rank
+// block; the factorization and the solution take O(N log^2 N)
+// and O(N log N) operations for bounded ranks. As the ranks of adjacent
+// clusters grow with N in 3D, with a bounded max. rank (and/or a loose
+// ACA tolerance) the solver is a preconditioner for GMRES
+// (see krylov_solvers.h) with hodlr_dot as the matrix
+
+#ifndef INC_HFPX3D_HODLR_SOLVER_H
+#define INC_HFPX3D_HODLR_SOLVER_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+#include "dense_la.h"
+
+namespace hfp3d {
+
+    // parameters of the approximation & factorization
+    struct HODLR_Param_T {
+        // max. number of elements in a leaf cluster
+        il::int_t leaf_size = 16;
+        // clusters t & s are well separated (admissible)
+        // if min(diam(t), diam(s)) <= adm_eta * dist(t, s)
+        // (bounding boxes of the element vertices)
+        double adm_eta = 2.0;
+        // relative tolerance of low-rank (ACA) approximation
+        double aca_tol = 1.0E-6;
+        // max. rank of the low-rank blocks
+        il::int_t max_rank = 64;
+        // dense LU of the leaf & coupling blocks (backend & threads)
+        Dense_LA_T la{};
+    };
+
+    // block of the matrix: rows of the node t, columns of the node s
+    // (cluster tree), low-rank (u.v^T) or dense (a)
+    struct HODLR_Blk_T {
+        il::int_t t = 0, s = 0;
+        bool is_low_rank = false;
+        il::Array2D<double> u{}, v{}, a{};
+    };
+
+    // node of the cluster tree; the diagonal block of the node is
+    // [A_11, A_12; A_21, A_22] (1 & 2 are the children)
+    struct HODLR_Node_T {
+        // DoF range (in cluster order) & element range (in c_ele)
+        il::int_t i0 = 0, i1 = 0;
+        il::int_t e0 = 0, e1 = 0;
+        // bounding box of the element vertices
+        il::StaticArray<double, 3> x_min{0.0}, x_max{0.0};
+        // children (-1 for a leaf)
+        il::StaticArray<il::int_t, 2> child{-1};
+        // leaf: dense block & its LU decomposition
+        il::Array2D<double> a{};
+        il::Array2D<double> lu{};
+        il::Array<il::int_t> piv{};
+        // off-diagonal blocks A_12 & A_21 (admissible partition)
+        il::Array<HODLR_Blk_T> blk_12{}, blk_21{};
+        // the same recompressed to rank <= max_rank:
+        // A_12 ~ u_12.v_12^T, A_21 ~ u_21.v_21^T
+        il::Array2D<double> u_12{}, v_12{}, u_21{}, v_21{};
+        // factorization: w_12 = A_11^(-1).u_12, w_21 = A_22^(-1).u_21,
+        // LU of the coupling matrix [I, v_12^T.w_21; v_21^T.w_12, I]
+        il::Array2D<double> w_12{}, w_21{};
+        il::Array2D<double> k_lu{};
+        il::Array<il::int_t> k_piv{};
+    };
+
+    // HODLR Volume Control matrix
+    // [A, c; r^T, 0] (A: traction vs DD; c: traction vs pressure;
+    // r: volume vs DD) for the DoF listed in dof_hndl
+    struct HODLR_Matrix_T {
+        il::int_t n_dof = 0;
+        // elements in cluster order
+        il::Array<il::int_t> c_ele{};
+        // DoF number (dof_hndl) in cluster order
+        il::Array<il::int_t> perm{};
+        // cluster tree (node 0 is the root)
+        il::Array<HODLR_Node_T> node{};
+        // Volume Control row & column (in cluster order)
+        il::Array<double> vc_row{}, vc_col{};
+
+        // factorization: A^(-1).c & r^T.A^(-1).c
+        bool is_factorized = false;
+        Dense_LA_T la{};
+        il::Array<double> vc_w{};
+        double vc_s = 0.0;
+    };
+
+    // HODLR approximation of the Volume Control matrix
+    HODLR_Matrix_T make_3dbem_hodlr_vc
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const HODLR_Param_T &h_par,
+             const DoF_Handle_T &dof_hndl);
+
+    // number of stored matrix entries
+    // & max. rank of the recompressed off-diagonal blocks
+    il::int_t hodlr_n_entries(const HODLR_Matrix_T &hm);
+    il::int_t hodlr_max_rank(const HODLR_Matrix_T &hm);
+
+    // Matrix-vector product (vector: [DD; pressure], listed by dof_hndl)
+    il::Array<double> hodlr_dot
+            (const HODLR_Matrix_T &hm,
+             const il::Array<double> &x);
+
+    // Factorization (in place)
+    void hodlr_factorize
+            (const HODLR_Param_T &h_par,
+             il::io_t, HODLR_Matrix_T &hm, il::Status &status);
+
+    // Solution of the system with the factorized matrix
+    // (rhs: [traction; volume], listed by dof_hndl)
+    il::Array<double> hodlr_solve
+            (const HODLR_Matrix_T &hm,
+             const il::Array<double> &rhs);
+
+    // preconditioner for gmres (see krylov_solvers.h)
+    struct HODLR_Prec_T {
+        const HODLR_Matrix_T *hm;
+        il::Array<double> operator()(const il::Array<double> &x) const {
+            return hodlr_solve(*hm, x);
+        }
+    };
+
+}
+
+#endif //INC_HFPX3D_HODLR_SOLVER_H
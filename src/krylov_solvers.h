@@ -0,0 +1,655 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Iterative (Krylov subspace) solvers for matrix-free operators;
+// GCRO-DR keeps a small subspace between the solutions
+// of a sequence of systems with (nearly) the same matrix
+
+#ifndef INC_HFPX3D_KRYLOV_SOLVERS_H
+#define INC_HFPX3D_KRYLOV_SOLVERS_H
+
+#include <cmath>
+#include <algorithm>
+#include <il/Array.h>
+#include <il/Array2D.h>
+
+namespace hfp3d {
+
+    // identity preconditioner
+    struct Identity_Prec_T {
+        il::Array<double> operator()(const il::Array<double> &x) const {
+            return x;
+        }
+    };
+
+    // Euclidean scalar product & norm
+    inline double vec_dot
+            (const il::Array<double> &a, const il::Array<double> &b) {
+        IL_EXPECT_FAST(a.size() == b.size());
+        double s = 0.0;
+        for (il::int_t i = 0; i < a.size(); ++i) {
+            s += a[i] * b[i];
+        }
+        return s;
+    }
+
+    inline double vec_norm(const il::Array<double> &a) {
+        return std::sqrt(vec_dot(a, a));
+    }
+
+    // Restarted GMRES(m) with right preconditioning
+    template <typename Op, typename Prec>
+    il::Array<double> gmres
+            (const Op &a_dot,
+             const Prec &m_inv,
+             const il::Array<double> &rhs,
+             il::int_t restart,
+             double tol,
+             il::int_t max_iter,
+             il::io_t, il::int_t &n_iter, double &rel_res) {
+        // This function solves A.x = rhs, where A.v = a_dot(v),
+        // with M^(-1).v = m_inv(v) as (right) preconditioner;
+        // iterations stop when |rhs - A.x| <= tol * |rhs|;
+        // n_iter is the number of matrix-vector products
+        // (including the true residual after each restart)
+        const il::int_t n = rhs.size();
+        IL_EXPECT_FAST(restart >= 1);
+        il::Array<double> x{n, 0.0};
+        const double rhs_norm = vec_norm(rhs);
+        n_iter = 0;
+        rel_res = 0.0;
+        if (rhs_norm == 0.0) {
+            return x;
+        }
+
+        // Krylov basis, Hessenberg matrix, Givens rotations
+        il::Array2D<double> v_b{n, restart + 1, 0.0};
+        il::Array2D<double> h_m{restart + 1, restart, 0.0};
+        il::Array<double> g_c{restart, 0.0}, g_s{restart, 0.0};
+        il::Array<double> g{restart + 1, 0.0};
+
+        il::Array<double> r = rhs;
+        double beta = rhs_norm;
+        rel_res = 1.0;
+        while (n_iter < max_iter) {
+            for (il::int_t i = 0; i < n; ++i) {
+                v_b(i, 0) = r[i] / beta;
+            }
+            for (il::int_t k = 0; k <= restart; ++k) {
+                g[k] = 0.0;
+            }
+            g[0] = beta;
+
+            il::int_t k = 0;
+            for (; k < restart && n_iter < max_iter; ++k) {
+                // new direction (Arnoldi, modified Gram-Schmidt)
+                il::Array<double> v_k{n};
+                for (il::int_t i = 0; i < n; ++i) {
+                    v_k[i] = v_b(i, k);
+                }
+                il::Array<double> w = a_dot(m_inv(v_k));
+                ++n_iter;
+                for (il::int_t j = 0; j <= k; ++j) {
+                    double h_jk = 0.0;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        h_jk += w[i] * v_b(i, j);
+                    }
+                    h_m(j, k) = h_jk;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        w[i] -= h_jk * v_b(i, j);
+                    }
+                }
+                double h_n = vec_norm(w);
+                h_m(k + 1, k) = h_n;
+                if (h_n > 0.0) {
+                    for (il::int_t i = 0; i < n; ++i) {
+                        v_b(i, k + 1) = w[i] / h_n;
+                    }
+                }
+                // previous rotations applied to the new column
+                for (il::int_t j = 0; j < k; ++j) {
+                    double t = g_c[j] * h_m(j, k) + g_s[j] * h_m(j + 1, k);
+                    h_m(j + 1, k) = -g_s[j] * h_m(j, k) + g_c[j] * h_m(j + 1, k);
+                    h_m(j, k) = t;
+                }
+                // new rotation
+                double d = std::sqrt(h_m(k, k) * h_m(k, k) +
+                                     h_m(k + 1, k) * h_m(k + 1, k));
+                g_c[k] = (d > 0.0) ? h_m(k, k) / d : 1.0;
+                g_s[k] = (d > 0.0) ? h_m(k + 1, k) / d : 0.0;
+                h_m(k, k) = d;
+                h_m(k + 1, k) = 0.0;
+                g[k + 1] = -g_s[k] * g[k];
+                g[k] = g_c[k] * g[k];
+                rel_res = std::fabs(g[k + 1]) / rhs_norm;
+                if (rel_res <= tol || h_n == 0.0) {
+                    ++k;
+                    break;
+                }
+            }
+
+            // update of the solution: x += M^(-1).V.y, H.y = g
+            il::Array<double> y{k, 0.0};
+            for (il::int_t j = k - 1; j >= 0; --j) {
+                double s = g[j];
+                for (il::int_t l = j + 1; l < k; ++l) {
+                    s -= h_m(j, l) * y[l];
+                }
+                y[j] = s / h_m(j, j);
+            }
+            il::Array<double> vy{n, 0.0};
+            for (il::int_t j = 0; j < k; ++j) {
+                for (il::int_t i = 0; i < n; ++i) {
+                    vy[i] += v_b(i, j) * y[j];
+                }
+            }
+            il::Array<double> dx = m_inv(vy);
+            for (il::int_t i = 0; i < n; ++i) {
+                x[i] += dx[i];
+            }
+
+            // true residual
+            il::Array<double> ax = a_dot(x);
+            ++n_iter;
+            for (il::int_t i = 0; i < n; ++i) {
+                r[i] = rhs[i] - ax[i];
+            }
+            beta = vec_norm(r);
+            rel_res = beta / rhs_norm;
+            if (rel_res <= tol || beta == 0.0) {
+                break;
+            }
+        }
+        return x;
+    }
+
+    // Eigenvalues (ascending) & eigenvectors (columns of q)
+    // of a symmetric matrix (cyclic Jacobi method; for small matrices)
+    inline void sym_eig_jacobi
+            (const il::Array2D<double> &a,
+             il::io_t, il::Array<double> &w, il::Array2D<double> &q) {
+        const il::int_t n = a.size(0);
+        IL_EXPECT_FAST(a.size(1) == n);
+        il::Array2D<double> b = a;
+        q = il::Array2D<double>{n, n, 0.0};
+        for (il::int_t i = 0; i < n; ++i) {
+            q(i, i) = 1.0;
+        }
+        double a_norm2 = 0.0;
+        for (il::int_t j = 0; j < n; ++j) {
+            for (il::int_t i = 0; i < n; ++i) {
+                a_norm2 += b(i, j) * b(i, j);
+            }
+        }
+        for (int sweep = 0; sweep < 100; ++sweep) {
+            double off2 = 0.0;
+            for (il::int_t j = 1; j < n; ++j) {
+                for (il::int_t i = 0; i < j; ++i) {
+                    off2 += 2.0 * b(i, j) * b(i, j);
+                }
+            }
+            if (off2 <= 1.0E-30 * a_norm2) {
+                break;
+            }
+            for (il::int_t p = 0; p < n - 1; ++p) {
+                for (il::int_t l = p + 1; l < n; ++l) {
+                    if (b(p, l) == 0.0) {
+                        continue;
+                    }
+                    // rotation annihilating b(p, l)
+                    double theta = (b(l, l) - b(p, p)) / (2.0 * b(p, l));
+                    double t = (theta >= 0.0 ? 1.0 : -1.0) /
+                               (std::fabs(theta) +
+                                std::sqrt(theta * theta + 1.0));
+                    double c = 1.0 / std::sqrt(t * t + 1.0), s = t * c;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        double b_ip = b(i, p), b_il = b(i, l);
+                        b(i, p) = c * b_ip - s * b_il;
+                        b(i, l) = s * b_ip + c * b_il;
+                    }
+                    for (il::int_t i = 0; i < n; ++i) {
+                        double b_pi = b(p, i), b_li = b(l, i);
+                        b(p, i) = c * b_pi - s * b_li;
+                        b(l, i) = s * b_pi + c * b_li;
+                    }
+                    for (il::int_t i = 0; i < n; ++i) {
+                        double q_ip = q(i, p), q_il = q(i, l);
+                        q(i, p) = c * q_ip - s * q_il;
+                        q(i, l) = s * q_ip + c * q_il;
+                    }
+                }
+            }
+        }
+        // sorting (insertion)
+        w = il::Array<double>{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            w[i] = b(i, i);
+        }
+        for (il::int_t j = 1; j < n; ++j) {
+            for (il::int_t i = j; i > 0 && w[i] < w[i - 1]; --i) {
+                double t = w[i];
+                w[i] = w[i - 1];
+                w[i - 1] = t;
+                for (il::int_t l = 0; l < n; ++l) {
+                    t = q(l, i);
+                    q(l, i) = q(l, i - 1);
+                    q(l, i - 1) = t;
+                }
+            }
+        }
+    }
+
+    // Recycled subspace of GCRO-DR: search directions z (columns),
+    // their images c = A.z (orthonormal columns), and the directions
+    // of the preconditioned system u = M.z
+    struct Krylov_Recycle_T {
+        // max. dimension of the recycled subspace
+        il::int_t k_max = 10;
+        // true if the matrix is the same as in the previous solution
+        // (otherwise c is re-calculated, k_max matrix-vector products)
+        bool is_same_op = false;
+        il::Array2D<double> z{};
+        il::Array2D<double> c{};
+        il::Array2D<double> u{};
+    };
+
+    // Orthonormalization of the columns of c (modified Gram-Schmidt),
+    // the same linear combinations of the columns of z & u;
+    // (nearly) dependent columns are dropped
+    inline void orth_krylov_recycle
+            (il::io_t, il::Array2D<double> &c,
+             il::Array2D<double> &z, il::Array2D<double> &u) {
+        const il::int_t n = c.size(0);
+        const il::int_t k = c.size(1);
+        il::int_t k_r = 0;
+        for (il::int_t j = 0; j < k; ++j) {
+            double c_norm0 = 0.0;
+            for (il::int_t i = 0; i < n; ++i) {
+                c_norm0 += c(i, j) * c(i, j);
+                c(i, k_r) = c(i, j);
+                z(i, k_r) = z(i, j);
+                u(i, k_r) = u(i, j);
+            }
+            c_norm0 = std::sqrt(c_norm0);
+            for (il::int_t l = 0; l < k_r; ++l) {
+                double r_lj = 0.0;
+                for (il::int_t i = 0; i < n; ++i) {
+                    r_lj += c(i, l) * c(i, k_r);
+                }
+                for (il::int_t i = 0; i < n; ++i) {
+                    c(i, k_r) -= r_lj * c(i, l);
+                    z(i, k_r) -= r_lj * z(i, l);
+                    u(i, k_r) -= r_lj * u(i, l);
+                }
+            }
+            double r_jj = 0.0;
+            for (il::int_t i = 0; i < n; ++i) {
+                r_jj += c(i, k_r) * c(i, k_r);
+            }
+            r_jj = std::sqrt(r_jj);
+            if (r_jj <= 1.0E-10 * c_norm0 || r_jj == 0.0) {
+                continue;
+            }
+            for (il::int_t i = 0; i < n; ++i) {
+                c(i, k_r) /= r_jj;
+                z(i, k_r) /= r_jj;
+                u(i, k_r) /= r_jj;
+            }
+            ++k_r;
+        }
+        if (k_r < k) {
+            il::Array2D<double> c_r{n, k_r}, z_r{n, k_r}, u_r{n, k_r};
+            for (il::int_t j = 0; j < k_r; ++j) {
+                for (il::int_t i = 0; i < n; ++i) {
+                    c_r(i, j) = c(i, j);
+                    z_r(i, j) = z(i, j);
+                    u_r(i, j) = u(i, j);
+                }
+            }
+            c = c_r;
+            z = z_r;
+            u = u_r;
+        }
+    }
+
+    // GCRO-DR (Krylov subspace recycling) with right preconditioning
+    template <typename Op, typename Prec>
+    il::Array<double> gcro_dr
+            (const Op &a_dot,
+             const Prec &m_inv,
+             const il::Array<double> &rhs,
+             il::int_t restart,
+             double tol,
+             il::int_t max_iter,
+             il::io_t, Krylov_Recycle_T &rec,
+             il::int_t &n_iter, double &rel_res) {
+        // This function solves A.x = rhs as gmres does, with
+        // the recycled subspace rec kept from the previous solutions
+        // (e.g. at the previous time step or nonlinear iteration):
+        // the residual is minimized over the recycled subspace and
+        // the Krylov one of (I - c.c^T).A.M^(-1); after each cycle,
+        // rec is replaced by the k_max directions of the recycled
+        // & Krylov subspaces with the smallest |A.M^(-1).v| / |v|
+        // (approximate smallest singular vectors of A.M^(-1));
+        // n_iter includes the products re-calculating rec.c
+        // and the true residual after each cycle
+        const il::int_t n = rhs.size();
+        IL_EXPECT_FAST(restart >= 1);
+        IL_EXPECT_FAST(rec.k_max >= 0);
+        il::Array<double> x{n, 0.0};
+        const double rhs_norm = vec_norm(rhs);
+        n_iter = 0;
+        rel_res = 0.0;
+        if (rhs_norm == 0.0) {
+            return x;
+        }
+        if (rec.z.size(0) != n) {
+            // the size of the system has changed
+            rec.z = il::Array2D<double>{n, 0};
+            rec.c = il::Array2D<double>{n, 0};
+            rec.u = il::Array2D<double>{n, 0};
+        }
+
+        // images of the recycled directions for the current matrix
+        if (rec.z.size(1) > 0 && !rec.is_same_op) {
+            for (il::int_t j = 0; j < rec.z.size(1); ++j) {
+                il::Array<double> z_j{n};
+                for (il::int_t i = 0; i < n; ++i) {
+                    z_j[i] = rec.z(i, j);
+                }
+                il::Array<double> c_j = a_dot(z_j);
+                ++n_iter;
+                for (il::int_t i = 0; i < n; ++i) {
+                    rec.c(i, j) = c_j[i];
+                }
+            }
+            orth_krylov_recycle(il::io, rec.c, rec.z, rec.u);
+        }
+
+        // Krylov basis, Hessenberg matrix (also before rotations),
+        // projections on c, Givens rotations
+        il::Array2D<double> v_b{n, restart + 1, 0.0};
+        il::Array2D<double> h_m{restart + 1, restart, 0.0};
+        il::Array2D<double> h_0{restart + 1, restart, 0.0};
+        il::Array<double> g_c{restart, 0.0}, g_s{restart, 0.0};
+        il::Array<double> g{restart + 1, 0.0};
+
+        il::Array<double> r = rhs;
+        while (true) {
+            // minimization over the recycled subspace
+            const il::int_t k_r = rec.c.size(1);
+            for (il::int_t j = 0; j < k_r; ++j) {
+                double c_r = 0.0;
+                for (il::int_t i = 0; i < n; ++i) {
+                    c_r += rec.c(i, j) * r[i];
+                }
+                for (il::int_t i = 0; i < n; ++i) {
+                    x[i] += c_r * rec.z(i, j);
+                    r[i] -= c_r * rec.c(i, j);
+                }
+            }
+            double beta = vec_norm(r);
+            rel_res = beta / rhs_norm;
+            if (rel_res <= tol || beta == 0.0 || n_iter >= max_iter) {
+                break;
+            }
+
+            for (il::int_t i = 0; i < n; ++i) {
+                v_b(i, 0) = r[i] / beta;
+            }
+            for (il::int_t k = 0; k <= restart; ++k) {
+                g[k] = 0.0;
+            }
+            g[0] = beta;
+            il::Array2D<double> b_k{k_r, restart, 0.0};
+
+            il::int_t k = 0;
+            for (; k < restart && n_iter < max_iter; ++k) {
+                // new direction (Arnoldi, modified Gram-Schmidt,
+                // orthogonal to c)
+                il::Array<double> v_k{n};
+                for (il::int_t i = 0; i < n; ++i) {
+                    v_k[i] = v_b(i, k);
+                }
+                il::Array<double> w = a_dot(m_inv(v_k));
+                ++n_iter;
+                for (il::int_t j = 0; j < k_r; ++j) {
+                    double b_jk = 0.0;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        b_jk += w[i] * rec.c(i, j);
+                    }
+                    b_k(j, k) = b_jk;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        w[i] -= b_jk * rec.c(i, j);
+                    }
+                }
+                for (il::int_t j = 0; j <= k; ++j) {
+                    double h_jk = 0.0;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        h_jk += w[i] * v_b(i, j);
+                    }
+                    h_m(j, k) = h_jk;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        w[i] -= h_jk * v_b(i, j);
+                    }
+                }
+                double h_n = vec_norm(w);
+                h_m(k + 1, k) = h_n;
+                if (h_n > 0.0) {
+                    for (il::int_t i = 0; i < n; ++i) {
+                        v_b(i, k + 1) = w[i] / h_n;
+                    }
+                }
+                for (il::int_t j = 0; j <= k + 1; ++j) {
+                    h_0(j, k) = h_m(j, k);
+                }
+                // previous rotations applied to the new column
+                for (il::int_t j = 0; j < k; ++j) {
+                    double t = g_c[j] * h_m(j, k) + g_s[j] * h_m(j + 1, k);
+                    h_m(j + 1, k) = -g_s[j] * h_m(j, k) + g_c[j] * h_m(j + 1, k);
+                    h_m(j, k) = t;
+                }
+                // new rotation
+                double d = std::sqrt(h_m(k, k) * h_m(k, k) +
+                                     h_m(k + 1, k) * h_m(k + 1, k));
+                g_c[k] = (d > 0.0) ? h_m(k, k) / d : 1.0;
+                g_s[k] = (d > 0.0) ? h_m(k + 1, k) / d : 0.0;
+                h_m(k, k) = d;
+                h_m(k + 1, k) = 0.0;
+                g[k + 1] = -g_s[k] * g[k];
+                g[k] = g_c[k] * g[k];
+                rel_res = std::fabs(g[k + 1]) / rhs_norm;
+                if (rel_res <= tol || h_n == 0.0) {
+                    ++k;
+                    break;
+                }
+            }
+            if (k == 0) {
+                break;
+            }
+
+            // update of the solution: x += M^(-1).V.y - z.b_k.y, H.y = g
+            il::Array<double> y{k, 0.0};
+            for (il::int_t j = k - 1; j >= 0; --j) {
+                double s = g[j];
+                for (il::int_t l = j + 1; l < k; ++l) {
+                    s -= h_m(j, l) * y[l];
+                }
+                y[j] = s / h_m(j, j);
+            }
+            il::Array<double> vy{n, 0.0};
+            for (il::int_t j = 0; j < k; ++j) {
+                for (il::int_t i = 0; i < n; ++i) {
+                    vy[i] += v_b(i, j) * y[j];
+                }
+            }
+            il::Array<double> dx = m_inv(vy);
+            for (il::int_t i = 0; i < n; ++i) {
+                x[i] += dx[i];
+            }
+            for (il::int_t j = 0; j < k_r; ++j) {
+                double b_y = 0.0;
+                for (il::int_t l = 0; l < k; ++l) {
+                    b_y += b_k(j, l) * y[l];
+                }
+                for (il::int_t i = 0; i < n; ++i) {
+                    x[i] -= b_y * rec.z(i, j);
+                }
+            }
+
+            // new recycled subspace: w = [u, V] p, with
+            // A.M^(-1).[u, V] = [c, V+].G, G = [I, b_k; 0, h_0],
+            // minimizing |G.p| / |[u, V].p|
+            // (symmetric generalized eigenproblem G^T.G.p = l.S.p,
+            // S = [u, V]^T.[u, V])
+            if (rec.k_max > 0) {
+                const il::int_t m = k_r + k;
+                il::Array2D<double> s_m{m, m, 0.0};
+                for (il::int_t j = 0; j < m; ++j) {
+                    for (il::int_t l = 0; l <= j; ++l) {
+                        double s_lj = 0.0;
+                        if (j >= k_r && l >= k_r) {
+                            s_lj = (l == j) ? 1.0 : 0.0;
+                        } else {
+                            for (il::int_t i = 0; i < n; ++i) {
+                                double w_l = (l < k_r) ? rec.u(i, l) :
+                                             v_b(i, l - k_r);
+                                double w_j = (j < k_r) ? rec.u(i, j) :
+                                             v_b(i, j - k_r);
+                                s_lj += w_l * w_j;
+                            }
+                        }
+                        s_m(l, j) = s_lj;
+                        s_m(j, l) = s_lj;
+                    }
+                }
+                il::Array2D<double> g_m{m + 1, m, 0.0};
+                for (il::int_t j = 0; j < k_r; ++j) {
+                    g_m(j, j) = 1.0;
+                }
+                for (il::int_t j = 0; j < k; ++j) {
+                    for (il::int_t l = 0; l < k_r; ++l) {
+                        g_m(l, k_r + j) = b_k(l, j);
+                    }
+                    for (il::int_t l = 0; l <= k; ++l) {
+                        g_m(k_r + l, k_r + j) = h_0(l, j);
+                    }
+                }
+
+                // S = Q.diag(s).Q^T -> T = Q.diag(s^(-1/2))
+                // (dependent directions are dropped)
+                il::Array<double> s_w;
+                il::Array2D<double> s_q;
+                sym_eig_jacobi(s_m, il::io, s_w, s_q);
+                il::int_t m_t = 0;
+                for (il::int_t j = 0; j < m; ++j) {
+                    if (s_w[j] > 1.0E-10 * s_w[m - 1]) {
+                        ++m_t;
+                    }
+                }
+                il::Array2D<double> t_m{m, m_t};
+                for (il::int_t j = 0; j < m_t; ++j) {
+                    const il::int_t j_s = m - m_t + j;
+                    for (il::int_t i = 0; i < m; ++i) {
+                        t_m(i, j) = s_q(i, j_s) / std::sqrt(s_w[j_s]);
+                    }
+                }
+                // G.T & (G.T)^T.(G.T)
+                il::Array2D<double> gt{m + 1, m_t, 0.0};
+                for (il::int_t j = 0; j < m_t; ++j) {
+                    for (il::int_t l = 0; l < m; ++l) {
+                        for (il::int_t i = 0; i <= m; ++i) {
+                            gt(i, j) += g_m(i, l) * t_m(l, j);
+                        }
+                    }
+                }
+                il::Array2D<double> gtg{m_t, m_t, 0.0};
+                for (il::int_t j = 0; j < m_t; ++j) {
+                    for (il::int_t l = 0; l < m_t; ++l) {
+                        for (il::int_t i = 0; i <= m; ++i) {
+                            gtg(l, j) += gt(i, l) * gt(i, j);
+                        }
+                    }
+                }
+                il::Array<double> e_w;
+                il::Array2D<double> e_q;
+                sym_eig_jacobi(gtg, il::io, e_w, e_q);
+                const il::int_t k_n = std::min(rec.k_max, m_t);
+
+                // p = T.e (k_n smallest), new z, u, & c = [c, V+].G.p
+                il::Array2D<double> p_m{m, k_n, 0.0};
+                for (il::int_t j = 0; j < k_n; ++j) {
+                    for (il::int_t l = 0; l < m_t; ++l) {
+                        for (il::int_t i = 0; i < m; ++i) {
+                            p_m(i, j) += t_m(i, l) * e_q(l, j);
+                        }
+                    }
+                }
+                il::Array2D<double> z_n{n, k_n, 0.0};
+                il::Array2D<double> u_n{n, k_n, 0.0};
+                il::Array2D<double> c_n{n, k_n, 0.0};
+                for (il::int_t j = 0; j < k_n; ++j) {
+                    il::Array<double> vp{n, 0.0};
+                    for (il::int_t l = 0; l < k; ++l) {
+                        const double p_lj = p_m(k_r + l, j);
+                        for (il::int_t i = 0; i < n; ++i) {
+                            vp[i] += v_b(i, l) * p_lj;
+                        }
+                    }
+                    il::Array<double> mvp = m_inv(vp);
+                    for (il::int_t i = 0; i < n; ++i) {
+                        z_n(i, j) = mvp[i];
+                        u_n(i, j) = vp[i];
+                    }
+                    for (il::int_t l = 0; l < k_r; ++l) {
+                        const double p_lj = p_m(l, j);
+                        for (il::int_t i = 0; i < n; ++i) {
+                            z_n(i, j) += rec.z(i, l) * p_lj;
+                            u_n(i, j) += rec.u(i, l) * p_lj;
+                        }
+                    }
+                    // G.p
+                    il::Array<double> gp{m + 1, 0.0};
+                    for (il::int_t l = 0; l < m; ++l) {
+                        for (il::int_t i = 0; i <= m; ++i) {
+                            gp[i] += g_m(i, l) * p_m(l, j);
+                        }
+                    }
+                    for (il::int_t l = 0; l <= m; ++l) {
+                        const double gp_l = gp[l];
+                        if (gp_l == 0.0) {
+                            continue;
+                        }
+                        for (il::int_t i = 0; i < n; ++i) {
+                            c_n(i, j) += gp_l * ((l < k_r) ? rec.c(i, l) :
+                                                 v_b(i, l - k_r));
+                        }
+                    }
+                }
+                orth_krylov_recycle(il::io, c_n, z_n, u_n);
+                rec.z = z_n;
+                rec.c = c_n;
+                rec.u = u_n;
+            }
+
+            // true residual
+            il::Array<double> ax = a_dot(x);
+            ++n_iter;
+            for (il::int_t i = 0; i < n; ++i) {
+                r[i] = rhs[i] - ax[i];
+            }
+        }
+        // (is_same_op is to be set for each solution)
+        rec.is_same_op = false;
+        return x;
+    }
+
+}
+
+#endif //INC_HFPX3D_KRYLOV_SOLVERS_H
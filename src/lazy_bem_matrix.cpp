@@ -0,0 +1,231 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray2D.h>
+#include "lazy_bem_matrix.h"
+
+namespace hfp3d {
+
+    Lazy_BEM_Matrix::Lazy_BEM_Matrix
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::int_t max_mem) {
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1);
+        // (blocks are kept in double precision)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        mesh_ = &mesh;
+        n_par_ = n_par;
+        mu_ = mu;
+        nu_ = nu;
+        // memory per block: the block itself & the hash map node
+        il::int_t blk_mem = sizeof(il::StaticArray2D<double, 18, 18>) +
+                            4 * sizeof(void *) + sizeof(il::int_t);
+        max_blocks_ = max_mem / blk_mem;
+        if (max_blocks_ < 1) {
+            max_blocks_ = 1;
+        }
+        n_blocks_ = 0;
+        n_hits_ = 0;
+        n_misses_ = 0;
+    }
+
+    const El_Data_T &Lazy_BEM_Matrix::el_data_(il::int_t el) {
+        // element properties & volume control rows, once per element
+        auto it = el_.find(el);
+        if (it != el_.end()) {
+            return it->second;
+        }
+        El_Data_T &el_d = el_[el];
+        el_d.el_s = get_mesh_el_struct(*mesh_, el, n_par_.beta);
+        el_d.vc = make_el_vc_submatrix(el_d.el_s, n_par_.is_dd_local);
+        return el_d;
+    }
+
+    El2El_Panel_T *Lazy_BEM_Matrix::row_panel_(il::int_t target_elem) {
+        auto it = panels_.find(target_elem);
+        if (it != panels_.end()) {
+            return &(it->second);
+        }
+        if (n_blocks_ >= max_blocks_) {
+            return nullptr;
+        }
+        return &(panels_[target_elem]);
+    }
+
+    const il::StaticArray2D<double, 18, 18> &Lazy_BEM_Matrix::panel_block_
+            (El2El_Panel_T *panel,
+             il::int_t target_elem, il::int_t source_elem) {
+        if (panel != nullptr) {
+            auto it = panel->find(source_elem);
+            if (it != panel->end()) {
+                ++n_hits_;
+                return it->second;
+            }
+        }
+        ++n_misses_;
+        const El_Data_T &el_d_s = el_data_(source_elem);
+        const El_Data_T &el_d_t = el_data_(target_elem);
+        if (panel != nullptr && n_blocks_ < max_blocks_) {
+            ++n_blocks_;
+            il::StaticArray2D<double, 18, 18> &blk = (*panel)[source_elem];
+            blk = make_el2el_3dbem_submatrix
+                    (mu_, nu_, el_d_s.el_s, el_d_t.el_s, n_par_.is_dd_local);
+            return blk;
+        }
+        blk_tmp_ = make_el2el_3dbem_submatrix
+                (mu_, nu_, el_d_s.el_s, el_d_t.el_s, n_par_.is_dd_local);
+        return blk_tmp_;
+    }
+
+    const il::StaticArray2D<double, 18, 18> &Lazy_BEM_Matrix::block
+            (il::int_t target_elem, il::int_t source_elem) {
+        const il::int_t n_el = n_ele();
+        IL_EXPECT_FAST(target_elem >= 0 && target_elem < n_el);
+        IL_EXPECT_FAST(source_elem >= 0 && source_elem < n_el);
+        return panel_block_(row_panel_(target_elem), target_elem, source_elem);
+    }
+
+    const il::StaticArray2D<double, 2, 18> &Lazy_BEM_Matrix::vc_block
+            (il::int_t el) {
+        IL_EXPECT_FAST(el >= 0 && el < n_ele());
+        return el_data_(el).vc;
+    }
+
+    il::Array<double> Lazy_BEM_Matrix::dot
+            (const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x) {
+// This function multiplies the Volume Control operator
+// truncated to the DoF listed in dof_hndl by x = [DD; pressure];
+// only the blocks of the elements having active DoF are accessed
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == n_ele());
+        IL_EXPECT_FAST(x.size() == num_dof + 1);
+
+        il::Array<il::int_t> ae_set = get_act_el_set(dof_hndl);
+        const il::int_t num_ae = ae_set.size();
+        il::Array<double> y{num_dof + 1, 0.0};
+        const double pressure = x[num_dof];
+
+        // DD at the nodes of the active elements
+        il::Array2D<double> x_ae{ndpe, num_ae, 0.0};
+        for (il::int_t s_k = 0; s_k < num_ae; ++s_k) {
+            il::int_t source_elem = ae_set[s_k];
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t s_dof = dof_hndl.dof_h(source_elem, l);
+                if (s_dof >= 0) {
+                    x_ae(l, s_k) = x[s_dof];
+                }
+            }
+        }
+
+        // Loop over "Target" elements (row panels)
+        for (il::int_t t_k = 0; t_k < num_ae; ++t_k) {
+            il::int_t target_elem = ae_set[t_k];
+            El2El_Panel_T *panel = row_panel_(target_elem);
+            il::StaticArray<double, 18> y_t{0.0};
+            // Loop over "source" elements
+            for (il::int_t s_k = 0; s_k < num_ae; ++s_k) {
+                il::int_t source_elem = ae_set[s_k];
+                const il::StaticArray2D<double, 18, 18> &blk =
+                        panel_block_(panel, target_elem, source_elem);
+                for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                    double x_s = x_ae(i1, s_k);
+                    for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                        y_t[i0] += blk(i0, i1) * x_s;
+                    }
+                }
+            }
+            // Volume vs DD & traction vs pressure
+            const il::StaticArray2D<double, 2, 18> &vc_infl =
+                    vc_block(target_elem);
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t t_dof = dof_hndl.dof_h(target_elem, l);
+                if (t_dof >= 0) {
+                    y[t_dof] += y_t[l] + vc_infl(1, l) * pressure;
+                    y[num_dof] += vc_infl(0, l) * x_ae(l, t_k);
+                }
+            }
+        }
+        return y;
+    }
+
+    SAE_T Lazy_BEM_Matrix::make_trc_system
+            (const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &delta_t,
+             double delta_v) {
+// Truncated matrix & RHS assembly (as in mod_3dbem_system_vc)
+// pulling the element-to-element blocks from the cache
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == n_ele());
+        IL_EXPECT_FAST(num_dof > 0);
+        IL_EXPECT_FAST(delta_t.size() == num_dof);
+
+        il::Array<il::int_t> ae_set = get_act_el_set(dof_hndl);
+        const il::int_t num_ae = ae_set.size();
+
+        SAE_T alg_system;
+        alg_system.n_dof = num_dof + 1;
+        alg_system.matrix = il::Array2D<double>{num_dof + 1,
+                                                num_dof + 1, 0.0};
+        alg_system.rhs_v = il::Array<double>{num_dof + 1, 0.0};
+        // (sought volume delta)
+        alg_system.rhs_v[num_dof] = delta_v;
+
+        // Loop over "Target" elements (row panels)
+        for (il::int_t t_k = 0; t_k < num_ae; ++t_k) {
+            il::int_t target_elem = ae_set[t_k];
+            El2El_Panel_T *panel = row_panel_(target_elem);
+            // Loop over "source" elements
+            for (il::int_t s_k = 0; s_k < num_ae; ++s_k) {
+                il::int_t source_elem = ae_set[s_k];
+                const il::StaticArray2D<double, 18, 18> &blk =
+                        panel_block_(panel, target_elem, source_elem);
+                for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                    il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                    if (j1 < 0) {
+                        continue;
+                    }
+                    for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                        il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                        if (j0 >= 0) {
+                            alg_system.matrix(j0, j1) += blk(i0, i1);
+                        }
+                    }
+                }
+            }
+            // Volume vs DD & traction vs pressure; RHS
+            const il::StaticArray2D<double, 2, 18> &vc_infl =
+                    vc_block(target_elem);
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t t_dof = dof_hndl.dof_h(target_elem, l);
+                if (t_dof >= 0) {
+                    alg_system.matrix(num_dof, t_dof) = vc_infl(0, l);
+                    alg_system.matrix(t_dof, num_dof) = vc_infl(1, l);
+                    // (sought traction delta)
+                    alg_system.rhs_v[t_dof] = delta_t[t_dof];
+                }
+            }
+        }
+        return alg_system;
+    }
+
+    void Lazy_BEM_Matrix::clear() {
+        panels_.clear();
+        n_blocks_ = 0;
+    }
+
+}
@@ -0,0 +1,114 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Volume Control BEM operator with element-to-element blocks
+// computed on first access and kept in a memory-bounded cache
+// of row panels (all blocks of one target element)
+
+#ifndef INC_HFPX3D_LAZY_BEM_MATRIX_H
+#define INC_HFPX3D_LAZY_BEM_MATRIX_H
+
+#include <unordered_map>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    // properties & volume control rows of an element
+    struct El_Data_T {
+        Element_Struct_T el_s;
+        il::StaticArray2D<double, 2, 18> vc;
+    };
+
+    // traction at the CP of target_elem vs DD at the nodes of source_elem,
+    // keyed by source_elem
+    typedef std::unordered_map<il::int_t,
+            il::StaticArray2D<double, 18, 18>> El2El_Panel_T;
+
+    class Lazy_BEM_Matrix {
+    private:
+        const Mesh_Geom_T *mesh_;
+        Num_Param_T n_par_;
+        double mu_, nu_;
+
+        // max. number of blocks kept in memory
+        il::int_t max_blocks_;
+        il::int_t n_blocks_;
+
+        // element data, computed on first access
+        std::unordered_map<il::int_t, El_Data_T> el_;
+
+        // row panels keyed by target_elem. Panels are admitted in the order
+        // of first access while the memory limit allows and are kept;
+        // blocks of other rows are computed in blk_tmp_ and not stored.
+        // Unlike LRU, this keeps a fixed part of the matrix in memory
+        // under the cyclic sweeps of dot() & make_trc_system().
+        std::unordered_map<il::int_t, El2El_Panel_T> panels_;
+        il::StaticArray2D<double, 18, 18> blk_tmp_;
+
+        // cache statistics
+        il::int_t n_hits_, n_misses_;
+
+        const El_Data_T &el_data_(il::int_t el);
+
+        // row panel of target_elem, admitted if the memory allows;
+        // nullptr if the row is not cached
+        El2El_Panel_T *row_panel_(il::int_t target_elem);
+
+        const il::StaticArray2D<double, 18, 18> &panel_block_
+                (El2El_Panel_T *panel,
+                 il::int_t target_elem, il::int_t source_elem);
+
+    public:
+        // max_mem: memory limit for the block cache (bytes)
+        Lazy_BEM_Matrix
+                (double mu, double nu,
+                 const Mesh_Geom_T &mesh,
+                 const Num_Param_T &n_par,
+                 il::int_t max_mem);
+
+        il::int_t n_ele() const { return mesh_->conn.size(1); };
+        il::int_t max_blocks() const { return max_blocks_; };
+        il::int_t n_blocks() const { return n_blocks_; };
+        il::int_t n_panels() const { return panels_.size(); };
+        il::int_t n_hits() const { return n_hits_; };
+        il::int_t n_misses() const { return n_misses_; };
+
+        // element-to-element block (computed if not in the cache);
+        // the reference is valid until the next call of block() or clear()
+        const il::StaticArray2D<double, 18, 18> &block
+                (il::int_t target_elem, il::int_t source_elem);
+
+        // volume vs DD (row 0) & traction vs pressure (row 1) of an element
+        const il::StaticArray2D<double, 2, 18> &vc_block(il::int_t el);
+
+        // product of the Volume Control operator truncated to the DoF
+        // listed in dof_hndl and the vector [DD; pressure]
+        il::Array<double> dot
+                (const DoF_Handle_T &dof_hndl,
+                 const il::Array<double> &x);
+
+        // truncated Volume Control system (see mod_3dbem_system_vc);
+        // delta_t is listed according to dof_hndl
+        SAE_T make_trc_system
+                (const DoF_Handle_T &dof_hndl,
+                 const il::Array<double> &delta_t,
+                 double delta_v);
+
+        // drops all cached blocks (element data are kept)
+        void clear();
+    };
+
+}
+
+#endif //INC_HFPX3D_LAZY_BEM_MATRIX_H
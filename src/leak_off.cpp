@@ -0,0 +1,95 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <limits>
+#include <il/Array.h>
+#include <il/StaticArray.h>
+#include "element_utilities.h"
+#include "system_assembly.h"
+#include "leak_off.h"
+
+namespace hfp3d {
+
+    // Initialization
+    Leak_Off_T make_leak_off
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &fe_set,
+             double c_l) {
+        IL_EXPECT_FAST(c_l >= 0.0);
+        const il::int_t n_el = mesh.conn.size(1);
+        Leak_Off_T leak_off;
+        leak_off.c_l = c_l;
+        const il::int_t n_fe = (fe_set.size() > 0) ? fe_set.size() : n_el;
+        leak_off.nod = il::Array<il::int_t>{6 * n_fe};
+        leak_off.area_w = il::Array<double>{6 * n_fe};
+        leak_off.t_exp = il::Array<double>
+                {6 * n_fe, std::numeric_limits<double>::infinity()};
+        for (il::int_t k = 0; k < n_fe; ++k) {
+            il::int_t el = (fe_set.size() > 0) ? fe_set[k] : k;
+            IL_EXPECT_FAST(el >= 0 && el < n_el);
+            Element_Struct_T el_s = get_mesh_el_struct(mesh, el, n_par.beta);
+            il::StaticArray<double, 6> sf_int =
+                    el_p2_sf_integral(el_s.sf_m, el_s.tau);
+            for (il::int_t n = 0; n < 6; ++n) {
+                leak_off.nod[6 * k + n] = 6 * el + n;
+                leak_off.area_w[6 * k + n] = sf_int[n];
+            }
+        }
+        return leak_off;
+    }
+
+    // Volume leaked from t0 to t1
+    double carter_leak_off_volume
+            (const Leak_Off_T &leak_off,
+             double t0, double t1) {
+        IL_EXPECT_FAST(t1 >= t0);
+        const il::int_t n_nod = leak_off.area_w.size();
+        if (leak_off.c_l == 0.0 || n_nod == 0) {
+            return 0.0;
+        }
+        IL_EXPECT_FAST(leak_off.t_exp.size() == n_nod);
+        const double *a_w = leak_off.area_w.data();
+        const double *t_e = leak_off.t_exp.data();
+        double s = 0.0;
+#pragma omp simd reduction(+:s)
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            // (zero for the nodes not exposed by t1)
+            const double d_1 = t1 - t_e[n];
+            const double d_0 = t0 - t_e[n];
+            s += a_w[n] * (std::sqrt(d_1 > 0.0 ? d_1 : 0.0) -
+                           std::sqrt(d_0 > 0.0 ? d_0 : 0.0));
+        }
+        // 2 * c_l * sqrt(t - t_exp) per unit area of each of 2 faces
+        return 4.0 * leak_off.c_l * s;
+    }
+
+    // Exposure of the nodes with positive opening
+    void update_leak_off_exposure
+            (const il::Array<double> &opening,
+             double t,
+             il::io_t, Leak_Off_T &leak_off) {
+        const il::int_t n_nod = leak_off.area_w.size();
+        IL_EXPECT_FAST(leak_off.nod.size() == n_nod);
+        IL_EXPECT_FAST(leak_off.t_exp.size() == n_nod);
+        const double *w = opening.data();
+        const il::int_t *nd = leak_off.nod.data();
+        const double *a_w = leak_off.area_w.data();
+        double *t_e = leak_off.t_exp.data();
+#pragma omp simd
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            // (opening gathered from the node-wise array)
+            const bool is_exp = w[nd[n]] > 0.0 && a_w[n] > 0.0 &&
+                                t_e[n] > t;
+            t_e[n] = is_exp ? t : t_e[n];
+        }
+    }
+
+}
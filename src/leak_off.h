@@ -0,0 +1,65 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Fluid leak-off into the formation (Carter's model):
+// the leak-off velocity at a point exposed to the fluid since t_exp
+// is c_l / sqrt(t - t_exp) on each face of the fracture.
+// The state is stored for the nodes of the filled elements only
+// (listed as 6 * element + local node) in flat arrays, so that
+// the leaked volume & the exposure times are updated by branch-free
+// (SIMD) loops over these nodes once per time step.
+// Carter's leak-off does not depend on DD or pressure: it enters
+// the Volume Control system as a reduction of the sought volume
+// (the right-hand side of the volume row), the matrix is not changed
+
+#ifndef INC_HFPX3D_LEAK_OFF_H
+#define INC_HFPX3D_LEAK_OFF_H
+
+#include <il/Array.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // leak-off state
+    struct Leak_Off_T {
+        // Carter's leak-off coefficient
+        double c_l = 0.0;
+        // nodes of the filled elements (6 * element + local node)
+        il::Array<il::int_t> nod{};
+        // nodal area (integral of the shape function) of these nodes
+        il::Array<double> area_w{};
+        // time of exposure to the fluid (infinity if not exposed)
+        il::Array<double> t_exp{};
+        // total leaked volume
+        double vol_lost = 0.0;
+    };
+
+    // Initialization (no node exposed) for the elements of fe_set
+    // (all elements of the mesh if fe_set is empty)
+    Leak_Off_T make_leak_off
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &fe_set,
+             double c_l);
+
+    // Volume leaked (from both faces) from t0 to t1
+    double carter_leak_off_volume
+            (const Leak_Off_T &leak_off,
+             double t0, double t1);
+
+    // Exposure of the (not yet exposed) nodes with positive opening
+    // (node-wise) at time t
+    void update_leak_off_exposure
+            (const il::Array<double> &opening,
+             double t,
+             il::io_t, Leak_Off_T &leak_off);
+
+}
+
+#endif //INC_HFPX3D_LEAK_OFF_H
@@ -0,0 +1,614 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "krylov_solvers.h"
+#include "time_stepping.h"
+#include "lubrication.h"
+
+namespace hfp3d {
+
+    // FV mesh of the filled elements
+    FV_Mesh_T make_fv_mesh
+            (const Mesh_Geom_T &mesh,
+             const il::Array<il::int_t> &fe_set) {
+        const il::int_t n_cell = fe_set.size();
+        FV_Mesh_T fv;
+        fv.cell_el = fe_set;
+        fv.area = il::Array<double>{n_cell};
+        il::Array2D<double> ctr{3, n_cell, 0.0};
+        // edges of the cells: (vertex a, vertex b, cell), a < b
+        il::Array2D<il::int_t> edge{3 * n_cell, 3};
+        for (il::int_t c = 0; c < n_cell; ++c) {
+            il::int_t el = fe_set[c];
+            il::StaticArray<il::StaticArray<double, 3>, 3> v;
+            for (int k = 0; k < 3; ++k) {
+                for (int j = 0; j < 3; ++j) {
+                    v[k][j] = mesh.nods(j, mesh.conn(k, el));
+                    ctr(j, c) += v[k][j] / 3.0;
+                }
+                il::int_t n_a = mesh.conn(k, el);
+                il::int_t n_b = mesh.conn((k + 1) % 3, el);
+                edge(3 * c + k, 0) = std::min(n_a, n_b);
+                edge(3 * c + k, 1) = std::max(n_a, n_b);
+                edge(3 * c + k, 2) = c;
+            }
+            il::StaticArray<double, 3> cr;
+            for (int j = 0; j < 3; ++j) {
+                int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+                cr[j] = (v[1][j1] - v[0][j1]) * (v[2][j2] - v[0][j2]) -
+                        (v[1][j2] - v[0][j2]) * (v[2][j1] - v[0][j1]);
+            }
+            fv.area[c] = 0.5 * std::sqrt(cr[0] * cr[0] + cr[1] * cr[1] +
+                                         cr[2] * cr[2]);
+        }
+
+        // shared edges (faces): edges sorted by vertices
+        il::Array<il::int_t> ord{3 * n_cell};
+        for (il::int_t i = 0; i < ord.size(); ++i) {
+            ord[i] = i;
+        }
+        std::sort(ord.data(), ord.data() + ord.size(),
+                  [&edge](il::int_t i, il::int_t j) {
+                      return edge(i, 0) < edge(j, 0) ||
+                             (edge(i, 0) == edge(j, 0) &&
+                              edge(i, 1) < edge(j, 1));
+                  });
+        // (all pairs of cells at an edge, e.g. at fracture intersections)
+        il::Array<il::int_t> f_a{}, f_b{};
+        il::Array<double> f_g{};
+        for (il::int_t i0 = 0; i0 < ord.size();) {
+            il::int_t i1 = i0 + 1;
+            while (i1 < ord.size() &&
+                   edge(ord[i1], 0) == edge(ord[i0], 0) &&
+                   edge(ord[i1], 1) == edge(ord[i0], 1)) {
+                ++i1;
+            }
+            // edge length & midpoint
+            il::int_t n_a = edge(ord[i0], 0), n_b = edge(ord[i0], 1);
+            il::StaticArray<double, 3> m;
+            double len = 0.0;
+            for (int j = 0; j < 3; ++j) {
+                double d = mesh.nods(j, n_b) - mesh.nods(j, n_a);
+                len += d * d;
+                m[j] = 0.5 * (mesh.nods(j, n_a) + mesh.nods(j, n_b));
+            }
+            len = std::sqrt(len);
+            for (il::int_t ia = i0; ia < i1; ++ia) {
+                for (il::int_t ib = ia + 1; ib < i1; ++ib) {
+                    il::int_t c_a = edge(ord[ia], 2), c_b = edge(ord[ib], 2);
+                    double d_a = 0.0, d_b = 0.0;
+                    for (int j = 0; j < 3; ++j) {
+                        d_a += (ctr(j, c_a) - m[j]) * (ctr(j, c_a) - m[j]);
+                        d_b += (ctr(j, c_b) - m[j]) * (ctr(j, c_b) - m[j]);
+                    }
+                    f_a.append(c_a);
+                    f_b.append(c_b);
+                    f_g.append(len / (std::sqrt(d_a) + std::sqrt(d_b)));
+                }
+            }
+            i0 = i1;
+        }
+        const il::int_t n_face = f_g.size();
+        fv.face_c = il::Array2D<il::int_t>{n_face, 2};
+        for (il::int_t f = 0; f < n_face; ++f) {
+            fv.face_c(f, 0) = f_a[f];
+            fv.face_c(f, 1) = f_b[f];
+        }
+        fv.face_g = std::move(f_g);
+        return fv;
+    }
+
+    // Matrix-vector product
+    il::Array<double> csr_dot
+            (const CSR_Matrix_T &m,
+             const il::Array<double> &x) {
+        IL_EXPECT_FAST(x.size() == m.n_cols);
+        il::Array<double> y{m.n_rows, 0.0};
+        for (il::int_t i = 0; i < m.n_rows; ++i) {
+            double s = 0.0;
+            for (il::int_t k = m.row_ptr[i]; k < m.row_ptr[i + 1]; ++k) {
+                s += m.val[k] * x[m.col_ind[k]];
+            }
+            y[i] = s;
+        }
+        return y;
+    }
+
+    // FV flux matrix: (L.p)_i = sum over faces of T_f * (p_i - p_j)
+    CSR_Matrix_T make_fv_flux_matrix
+            (const FV_Mesh_T &fv,
+             const il::Array<double> &trans) {
+        const il::int_t n_cell = fv.cell_el.size();
+        const il::int_t n_face = fv.face_g.size();
+        IL_EXPECT_FAST(trans.size() == n_face);
+        CSR_Matrix_T l_m;
+        l_m.n_rows = n_cell;
+        l_m.n_cols = n_cell;
+        // diagonal entry first, then one per face
+        l_m.row_ptr = il::Array<il::int_t>{n_cell + 1, 0};
+        for (il::int_t f = 0; f < n_face; ++f) {
+            ++l_m.row_ptr[fv.face_c(f, 0) + 1];
+            ++l_m.row_ptr[fv.face_c(f, 1) + 1];
+        }
+        for (il::int_t i = 0; i < n_cell; ++i) {
+            l_m.row_ptr[i + 1] += l_m.row_ptr[i] + 1;
+        }
+        const il::int_t nnz = l_m.row_ptr[n_cell];
+        l_m.col_ind = il::Array<il::int_t>{nnz};
+        l_m.val = il::Array<double>{nnz, 0.0};
+        il::Array<il::int_t> pos{n_cell};
+        for (il::int_t i = 0; i < n_cell; ++i) {
+            l_m.col_ind[l_m.row_ptr[i]] = i;
+            pos[i] = l_m.row_ptr[i] + 1;
+        }
+        for (il::int_t f = 0; f < n_face; ++f) {
+            il::int_t c_a = fv.face_c(f, 0), c_b = fv.face_c(f, 1);
+            l_m.val[l_m.row_ptr[c_a]] += trans[f];
+            l_m.val[l_m.row_ptr[c_b]] += trans[f];
+            l_m.col_ind[pos[c_a]] = c_b;
+            l_m.val[pos[c_a]] = -trans[f];
+            ++pos[c_a];
+            l_m.col_ind[pos[c_b]] = c_a;
+            l_m.val[pos[c_b]] = -trans[f];
+            ++pos[c_b];
+        }
+        return l_m;
+    }
+
+    // Assembly & factorization of the coupled system
+    Hydro_Frac_Sys_T make_hydro_frac_system
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Flow_Param_T &fl_par,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             il::Status &status) {
+        IL_EXPECT_FAST(m_data.fe_set.size() > 0);
+        const il::int_t n_el = mesh.conn.size(1);
+        Hydro_Frac_Sys_T hf_sys;
+        hf_sys.la = fl_par.la;
+        if (m_data.dof_h_dd.n_dof == 0 || m_data.dof_h_dd.dof_h.size(0) == 0) {
+            m_data.dof_h_dd = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        }
+        hf_sys.dof_h_dd = m_data.dof_h_dd;
+        const il::int_t n_dd = hf_sys.dof_h_dd.n_dof;
+        const il::int_t ndpe = hf_sys.dof_h_dd.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+
+        // cells & pressure DoF (one per cell)
+        hf_sys.fv = make_fv_mesh(mesh, m_data.fe_set);
+        const il::int_t n_cell = hf_sys.fv.cell_el.size();
+        hf_sys.dof_h_pp.dof_h = il::Array2D<il::int_t>{n_el, ndpe / 3, -1};
+        for (il::int_t c = 0; c < n_cell; ++c) {
+            for (il::int_t n = 0; n < ndpe / 3; ++n) {
+                hf_sys.dof_h_pp.dof_h(hf_sys.fv.cell_el[c], n) = c;
+            }
+        }
+        hf_sys.dof_h_pp.n_dof = n_cell;
+        m_data.dof_h_pp = hf_sys.dof_h_pp;
+
+        // Volume Control matrix: elastic block,
+        // traction vs pressure & volume vs DD element-wise
+        {
+            DoF_Handle_T dof_h = hf_sys.dof_h_dd;
+            il::Array2D<double> vc_infl{};
+            make_3dbem_matrix_vc_parts
+                    (mu, nu, mesh, n_par, il::io, dof_h, hf_sys.a, vc_infl);
+
+            // (one entry per row of DoF of the filled elements)
+            il::Array<il::int_t> row_cell{n_dd, -1};
+            for (il::int_t c = 0; c < n_cell; ++c) {
+                for (il::int_t l = 0; l < ndpe; ++l) {
+                    il::int_t dof = hf_sys.dof_h_dd.dof_h
+                            (hf_sys.fv.cell_el[c], l);
+                    if (dof >= 0) {
+                        row_cell[dof] = c;
+                    }
+                }
+            }
+            CSR_Matrix_T &c_m = hf_sys.c;
+            c_m.n_rows = n_dd;
+            c_m.n_cols = n_cell;
+            c_m.row_ptr = il::Array<il::int_t>{n_dd + 1, 0};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                c_m.row_ptr[i + 1] = c_m.row_ptr[i] + (row_cell[i] >= 0);
+            }
+            c_m.col_ind = il::Array<il::int_t>{c_m.row_ptr[n_dd]};
+            c_m.val = il::Array<double>{c_m.row_ptr[n_dd]};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                if (row_cell[i] >= 0) {
+                    c_m.col_ind[c_m.row_ptr[i]] = row_cell[i];
+                    c_m.val[c_m.row_ptr[i]] = vc_infl(1, i);
+                }
+            }
+
+            CSR_Matrix_T &b_m = hf_sys.b;
+            b_m.n_rows = n_cell;
+            b_m.n_cols = n_dd;
+            b_m.row_ptr = il::Array<il::int_t>{n_cell + 1, 0};
+            b_m.col_ind = il::Array<il::int_t>{};
+            b_m.val = il::Array<double>{};
+            for (il::int_t c = 0; c < n_cell; ++c) {
+                for (il::int_t l = 0; l < ndpe; ++l) {
+                    il::int_t dof = hf_sys.dof_h_dd.dof_h
+                            (hf_sys.fv.cell_el[c], l);
+                    if (dof >= 0) {
+                        b_m.col_ind.append(dof);
+                        b_m.val.append(vc_infl(0, dof));
+                    }
+                }
+                b_m.row_ptr[c + 1] = b_m.col_ind.size();
+            }
+        }
+        il::Array<double> t_ff = make_vc_far_field_rhs
+                (mesh, n_par, load.s_inf, hf_sys.dof_h_dd);
+        hf_sys.t_ff = il::Array<double>{n_dd};
+        for (il::int_t i = 0; i < n_dd; ++i) {
+            hf_sys.t_ff[i] = t_ff[i];
+        }
+
+        // LU decomposition of the elastic matrix
+        hf_sys.a_lu = hf_sys.a;
+        la_getrf(hf_sys.la, il::io, hf_sys.a_lu, hf_sys.a_piv, status);
+        if (!status.ok()) {
+            return hf_sys;
+        }
+
+        // G = B.A^(-1).C, by panels of columns
+        hf_sys.g = il::Array2D<double>{n_cell, n_cell, 0.0};
+        const il::int_t p_size = 64;
+        for (il::int_t c0 = 0; c0 < n_cell; c0 += p_size) {
+            const il::int_t n_c = std::min(p_size, n_cell - c0);
+            il::Array2D<double> w{n_dd, n_c, 0.0};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                for (il::int_t k = hf_sys.c.row_ptr[i];
+                     k < hf_sys.c.row_ptr[i + 1]; ++k) {
+                    il::int_t c = hf_sys.c.col_ind[k];
+                    if (c >= c0 && c < c0 + n_c) {
+                        w(i, c - c0) = hf_sys.c.val[k];
+                    }
+                }
+            }
+            la_getrs(hf_sys.la, hf_sys.a_lu, hf_sys.a_piv, il::io, w);
+            for (il::int_t j = 0; j < n_c; ++j) {
+                for (il::int_t c = 0; c < n_cell; ++c) {
+                    double s = 0.0;
+                    for (il::int_t k = hf_sys.b.row_ptr[c];
+                         k < hf_sys.b.row_ptr[c + 1]; ++k) {
+                        s += hf_sys.b.val[k] * w(hf_sys.b.col_ind[k], j);
+                    }
+                    hf_sys.g(c, c0 + j) = s;
+                }
+            }
+        }
+        status.set_ok();
+        return hf_sys;
+    }
+
+    // Jacobian of the coupled system: [A, C; B + dt*dF/dDD, dt*L]
+    // (dF/dDD: change of fluxes due to the change of transmissibility)
+    struct HF_Jacobian_T {
+        const Hydro_Frac_Sys_T *hf_sys;
+        const CSR_Matrix_T *l_m;
+        double dt;
+        // derivative of face flux w.r. to the mean aperture of the face
+        const il::Array<double> *d_flux;
+
+        il::Array<double> operator()(const il::Array<double> &x) const {
+            const il::int_t n_dd = hf_sys->a.size(0);
+            const il::int_t n_cell = hf_sys->fv.cell_el.size();
+            il::Array<double> u{n_dd}, v{n_cell};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                u[i] = x[i];
+            }
+            for (il::int_t i = 0; i < n_cell; ++i) {
+                v[i] = x[n_dd + i];
+            }
+            il::Array2D<double> u_m{n_dd, 1}, au_m{n_dd, 1};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                u_m(i, 0) = u[i];
+            }
+            la_gemm(hf_sys->la, 1.0, hf_sys->a, false, u_m, false, 0.0,
+                    il::io, au_m);
+            il::Array<double> cv = csr_dot(hf_sys->c, v);
+            il::Array<double> bu = csr_dot(hf_sys->b, u);
+            il::Array<double> lv = csr_dot(*l_m, v);
+            il::Array<double> y{n_dd + n_cell};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                y[i] = au_m(i, 0) + cv[i];
+            }
+            for (il::int_t i = 0; i < n_cell; ++i) {
+                y[n_dd + i] = bu[i] + dt * lv[i];
+            }
+            for (il::int_t f = 0; f < hf_sys->fv.face_g.size(); ++f) {
+                il::int_t c_a = hf_sys->fv.face_c(f, 0);
+                il::int_t c_b = hf_sys->fv.face_c(f, 1);
+                double dw = 0.5 * (bu[c_a] / hf_sys->fv.area[c_a] +
+                                   bu[c_b] / hf_sys->fv.area[c_b]);
+                double df = dt * (*d_flux)[f] * dw;
+                y[n_dd + c_a] += df;
+                y[n_dd + c_b] -= df;
+            }
+            return y;
+        }
+    };
+
+    // Block (LDU) preconditioner: exact inverse of [A, C; B, dt*L]
+    // by the LU of A and of the Schur complement dt*L - B.A^(-1).C
+    struct HF_Prec_T {
+        const Hydro_Frac_Sys_T *hf_sys;
+        const il::Array2D<double> *s_lu;
+        const il::Array<il::int_t> *s_piv;
+
+        il::Array<double> operator()(const il::Array<double> &x) const {
+            const il::int_t n_dd = hf_sys->a.size(0);
+            const il::int_t n_cell = hf_sys->fv.cell_el.size();
+            il::Array<double> r{n_dd}, s{n_cell};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                r[i] = x[i];
+            }
+            for (il::int_t i = 0; i < n_cell; ++i) {
+                s[i] = x[n_dd + i];
+            }
+            il::Array<double> z =
+                    la_getrs(hf_sys->la, hf_sys->a_lu, hf_sys->a_piv, r);
+            il::Array<double> bz = csr_dot(hf_sys->b, z);
+            for (il::int_t i = 0; i < n_cell; ++i) {
+                s[i] -= bz[i];
+            }
+            il::Array<double> p = la_getrs(hf_sys->la, *s_lu, *s_piv, s);
+            il::Array<double> cp = csr_dot(hf_sys->c, p);
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                r[i] -= cp[i];
+            }
+            il::Array<double> u =
+                    la_getrs(hf_sys->la, hf_sys->a_lu, hf_sys->a_piv, r);
+            il::Array<double> y{n_dd + n_cell};
+            for (il::int_t i = 0; i < n_dd; ++i) {
+                y[i] = u[i];
+            }
+            for (il::int_t i = 0; i < n_cell; ++i) {
+                y[n_dd + i] = p[i];
+            }
+            return y;
+        }
+    };
+
+    // Residual of the coupled system (elasticity; fluid volume balance)
+    // at (dd, pp); also the derivative of face fluxes w.r. to the mean
+    // aperture & the flux matrix, and the norms of the two parts
+    il::Array<double> hf_residual
+            (const Hydro_Frac_Sys_T &hf_sys,
+             const Flow_Param_T &fl_par,
+             double dt,
+             const il::Array<double> &vol_0,
+             const il::Array<double> &q,
+             const il::Array<double> &dd,
+             const il::Array<double> &pp,
+             il::io_t,
+             il::Array<double> &d_flux,
+             CSR_Matrix_T &l_m,
+             double &res_e, double &res_f, double &ref_e) {
+        const FV_Mesh_T &fv = hf_sys.fv;
+        const il::int_t n_dd = hf_sys.dof_h_dd.n_dof;
+        const il::int_t n_cell = fv.cell_el.size();
+        const il::int_t n_face = fv.face_g.size();
+
+        // transmissibility of faces (cubic law) & its derivative
+        il::Array<double> vol = csr_dot(hf_sys.b, dd);
+        il::Array<double> trans{n_face};
+        d_flux = il::Array<double>{n_face};
+        for (il::int_t f = 0; f < n_face; ++f) {
+            il::int_t c_a = fv.face_c(f, 0), c_b = fv.face_c(f, 1);
+            double w_f = 0.5 * (vol[c_a] / fv.area[c_a] +
+                                vol[c_b] / fv.area[c_b]);
+            double g_f = fv.face_g[f] / (12.0 * fl_par.visc);
+            if (w_f > fl_par.w_min) {
+                trans[f] = g_f * w_f * w_f * w_f;
+                d_flux[f] = 3.0 * g_f * w_f * w_f * (pp[c_a] - pp[c_b]);
+            } else {
+                trans[f] = g_f * fl_par.w_min * fl_par.w_min * fl_par.w_min;
+                d_flux[f] = 0.0;
+            }
+        }
+        l_m = make_fv_flux_matrix(fv, trans);
+
+        il::Array2D<double> dd_m{n_dd, 1}, add_m{n_dd, 1};
+        for (il::int_t i = 0; i < n_dd; ++i) {
+            dd_m(i, 0) = dd[i];
+        }
+        la_gemm(hf_sys.la, 1.0, hf_sys.a, false, dd_m, false, 0.0,
+                il::io, add_m);
+        il::Array<double> cp = csr_dot(hf_sys.c, pp);
+        il::Array<double> lp = csr_dot(l_m, pp);
+        il::Array<double> res{n_dd + n_cell};
+        res_e = 0.0;
+        res_f = 0.0;
+        for (il::int_t i = 0; i < n_dd; ++i) {
+            res[i] = add_m(i, 0) + cp[i] - hf_sys.t_ff[i];
+            res_e += res[i] * res[i];
+        }
+        for (il::int_t c = 0; c < n_cell; ++c) {
+            res[n_dd + c] = vol[c] - vol_0[c] - q[c] + dt * lp[c];
+            res_f += res[n_dd + c] * res[n_dd + c];
+        }
+        res_e = std::sqrt(res_e);
+        res_f = std::sqrt(res_f);
+        ref_e = std::max(vec_norm(hf_sys.t_ff), vec_norm(cp));
+        return res;
+    }
+
+    // Implicit time step
+    void lubrication_step
+            (const Hydro_Frac_Sys_T &hf_sys,
+             const Load_T &load,
+             const Flow_Param_T &fl_par,
+             double dt,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             il::int_t &n_newton,
+             il::int_t &n_krylov,
+             il::Status &status) {
+        IL_EXPECT_FAST(dt > 0.0);
+        const FV_Mesh_T &fv = hf_sys.fv;
+        const il::int_t n_el = hf_sys.dof_h_dd.dof_h.size(0);
+        const il::int_t nnpe = hf_sys.dof_h_dd.dof_h.size(1) / 3;
+        const il::int_t n_dd = hf_sys.dof_h_dd.n_dof;
+        const il::int_t n_cell = fv.cell_el.size();
+        n_newton = 0;
+        n_krylov = 0;
+
+        // current state
+        if (m_data.dd.size(0) != n_el * nnpe || m_data.dd.size(1) != 3) {
+            m_data.dd = il::Array2D<double>{n_el * nnpe, 3, 0.0};
+        }
+        if (m_data.pp.size() != n_el * nnpe) {
+            m_data.pp = il::Array<double>{n_el * nnpe, 0.0};
+        }
+        il::Array<double> dd = get_dd_vector_from_md
+                (m_data, hf_sys.dof_h_dd, false, hf_sys.dof_h_pp);
+        il::Array<double> pp{n_cell};
+        for (il::int_t c = 0; c < n_cell; ++c) {
+            pp[c] = m_data.pp[fv.cell_el[c] * nnpe];
+        }
+        const il::Array<double> vol_0 = csr_dot(hf_sys.b, dd);
+
+        // injected volume per cell
+        il::Array<double> q{n_cell, 0.0};
+        {
+            const il::int_t n_loc = load.inj_loc.size(0);
+            il::Array<il::int_t> el_cell{n_el, -1};
+            for (il::int_t c = 0; c < n_cell; ++c) {
+                el_cell[fv.cell_el[c]] = c;
+            }
+            const bool is_rate_loc = load.inj_time.size() == 0 &&
+                                     load.inj_rate.size() == n_loc;
+            const double vol_inj = injected_volume
+                    (load, m_data.time, m_data.time + dt);
+            for (il::int_t k = 0; k < n_loc; ++k) {
+                const il::int_t el = load.inj_loc(k, 0);
+                const il::int_t c = (el >= 0 && el < n_el) ? el_cell[el] : -1;
+                if (c < 0) {
+                    // injection outside of the filled elements
+                    status.set_error(il::Error::Undefined);
+                    IL_SET_SOURCE(status);
+                    return;
+                }
+                q[c] += is_rate_loc ? load.inj_rate[k] * dt : vol_inj / n_loc;
+            }
+        }
+        const double ref_f = std::max(vec_norm(q), vec_norm(vol_0));
+
+        il::Array<double> d_flux{};
+        CSR_Matrix_T l_m{};
+        double res_e = 0.0, res_f = 0.0, ref_e = 0.0;
+        il::Array<double> res = hf_residual
+                (hf_sys, fl_par, dt, vol_0, q, dd, pp,
+                 il::io, d_flux, l_m, res_e, res_f, ref_e);
+        while (res_e > fl_par.newton_tol * ref_e ||
+               res_f > fl_par.newton_tol * ref_f) {
+            if (n_newton >= fl_par.newton_max) {
+                status.set_error(il::Error::Undefined);
+                IL_SET_SOURCE(status);
+                return;
+            }
+            ++n_newton;
+
+            // Schur complement for pressure (frozen transmissibility)
+            il::Array2D<double> s_lu{n_cell, n_cell};
+            for (il::int_t j = 0; j < n_cell; ++j) {
+                for (il::int_t i = 0; i < n_cell; ++i) {
+                    s_lu(i, j) = -hf_sys.g(i, j);
+                }
+            }
+            for (il::int_t i = 0; i < n_cell; ++i) {
+                for (il::int_t k = l_m.row_ptr[i];
+                     k < l_m.row_ptr[i + 1]; ++k) {
+                    s_lu(i, l_m.col_ind[k]) += dt * l_m.val[k];
+                }
+            }
+            il::Array<il::int_t> s_piv{};
+            la_getrf(hf_sys.la, il::io, s_lu, s_piv, status);
+            if (!status.ok()) {
+                return;
+            }
+
+            // Newton correction
+            for (il::int_t i = 0; i < res.size(); ++i) {
+                res[i] = -res[i];
+            }
+            HF_Jacobian_T jac{&hf_sys, &l_m, dt, &d_flux};
+            HF_Prec_T prec{&hf_sys, &s_lu, &s_piv};
+            il::int_t n_it = 0;
+            double rel_res = 0.0;
+            il::Array<double> delta = gmres
+                    (jac, prec, res, fl_par.gmres_restart, fl_par.gmres_tol,
+                     fl_par.gmres_max, il::io, n_it, rel_res);
+            n_krylov += n_it;
+            if (!(rel_res <= fl_par.gmres_tol)) {
+                // the correction is not a descent direction in general
+                status.set_error(il::Error::Undefined);
+                IL_SET_SOURCE(status);
+                return;
+            }
+
+            // line search: the step is halved until the volume balance
+            // residual decreases (the elastic part is linear),
+            // at most ls_max times
+            double lambda = 1.0;
+            const double res_f_0 = res_f;
+            for (il::int_t k_ls = 0; ; ++k_ls) {
+                il::Array<double> dd_t = dd, pp_t = pp;
+                for (il::int_t i = 0; i < n_dd; ++i) {
+                    dd_t[i] += lambda * delta[i];
+                }
+                for (il::int_t c = 0; c < n_cell; ++c) {
+                    pp_t[c] += lambda * delta[n_dd + c];
+                }
+                res = hf_residual
+                        (hf_sys, fl_par, dt, vol_0, q, dd_t, pp_t,
+                         il::io, d_flux, l_m, res_e, res_f, ref_e);
+                if (res_f <= (1.0 - 1.0E-4 * lambda) * res_f_0 ||
+                    res_f <= fl_par.newton_tol * ref_f) {
+                    dd = std::move(dd_t);
+                    pp = std::move(pp_t);
+                    break;
+                }
+                if (k_ls >= fl_par.ls_max) {
+                    status.set_error(il::Error::Undefined);
+                    IL_SET_SOURCE(status);
+                    return;
+                }
+                lambda *= 0.5;
+            }
+        }
+
+        // new state
+        write_dd_vector_to_md(dd, hf_sys.dof_h_dd, false, hf_sys.dof_h_pp,
+                              il::io, m_data);
+        for (il::int_t c = 0; c < n_cell; ++c) {
+            for (il::int_t n = 0; n < nnpe; ++n) {
+                m_data.pp[fv.cell_el[c] * nnpe + n] = pp[c];
+            }
+        }
+        m_data.time += dt;
+        status.set_ok();
+    }
+
+}
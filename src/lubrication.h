@@ -0,0 +1,140 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Fluid flow in the fracture (lubrication theory, cubic law)
+// coupled with elasticity (BEM). The flow is discretized by finite volumes:
+// the cells are the "filled" elements (m_data.fe_set) with one pressure
+// value per cell, the faces are the edges shared by two cells.
+// An implicit time step is solved by the (inexact) Newton method
+// with line search;
+// the linearized systems are solved by GMRES with the block (LDU)
+// preconditioner made of the LU decomposition of the elastic matrix
+// and of the Schur complement for pressure with frozen transmissibility
+
+#ifndef INC_HFPX3D_LUBRICATION_H
+#define INC_HFPX3D_LUBRICATION_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+#include "dense_la.h"
+
+namespace hfp3d {
+
+    // fluid properties & solver parameters
+    struct Flow_Param_T {
+        // fluid (dynamic) viscosity
+        double visc = 1.0E-3;
+        // min. hydraulic aperture (for the transmissibility of faces)
+        double w_min = 0.0;
+        // Newton iterations: relative tolerance & max. number
+        double newton_tol = 1.0E-8;
+        il::int_t newton_max = 20;
+        // max. number of halvings of the Newton step (line search)
+        il::int_t ls_max = 10;
+        // GMRES (for Newton corrections): relative tolerance,
+        // restart & max. number of iterations
+        double gmres_tol = 1.0E-3;
+        il::int_t gmres_restart = 30;
+        il::int_t gmres_max = 300;
+        // dense LU (backend & threads)
+        Dense_LA_T la{};
+    };
+
+    // finite volume mesh
+    struct FV_Mesh_T {
+        // element of each cell & the area of the cell
+        il::Array<il::int_t> cell_el{};
+        il::Array<double> area{};
+        // cells sharing the face (n_faces * 2) & the geometric factor
+        // of the face (edge length / distance between the cells' centroids)
+        il::Array2D<il::int_t> face_c{};
+        il::Array<double> face_g{};
+    };
+
+    // sparse matrix (compressed sparse rows)
+    struct CSR_Matrix_T {
+        il::int_t n_rows = 0, n_cols = 0;
+        il::Array<il::int_t> row_ptr{};
+        il::Array<il::int_t> col_ind{};
+        il::Array<double> val{};
+    };
+
+    // coupled elasticity & lubrication system
+    struct Hydro_Frac_Sys_T {
+        // DoF for DD & pressure (pressure DoF = cell No)
+        DoF_Handle_T dof_h_dd{};
+        DoF_Handle_T dof_h_pp{};
+        FV_Mesh_T fv{};
+        // elastic matrix (traction vs DD) & its LU decomposition
+        il::Array2D<double> a{};
+        il::Array2D<double> a_lu{};
+        il::Array<il::int_t> a_piv{};
+        // traction vs cell pressure & cell volume vs DD
+        CSR_Matrix_T c{};
+        CSR_Matrix_T b{};
+        // far-field traction (listed by dof_h_dd)
+        il::Array<double> t_ff{};
+        // B.A^(-1).C (cell volume vs cell pressure)
+        il::Array2D<double> g{};
+        Dense_LA_T la{};
+    };
+
+    // FV mesh of the filled elements (fe_set)
+    FV_Mesh_T make_fv_mesh
+            (const Mesh_Geom_T &mesh,
+             const il::Array<il::int_t> &fe_set);
+
+    // Matrix-vector product
+    il::Array<double> csr_dot
+            (const CSR_Matrix_T &m,
+             const il::Array<double> &x);
+
+    // FV matrix of the fluxes out of cells vs cell pressure
+    // for the given transmissibility of faces
+    CSR_Matrix_T make_fv_flux_matrix
+            (const FV_Mesh_T &fv,
+             const il::Array<double> &trans);
+
+    // Assembly & factorization of the coupled system for the DoF
+    // of m_data.dof_h_dd (all DoF but the ones at the tip if empty)
+    // and the cells of m_data.fe_set; sets m_data.dof_h_pp
+    Hydro_Frac_Sys_T make_hydro_frac_system
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Flow_Param_T &fl_par,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             il::Status &status);
+
+    // Implicit time step (from m_data.time to m_data.time + dt)
+    // with the injection at the cells of load.inj_loc;
+    // m_data.dd, m_data.pp & m_data.time are updated.
+    // If Newton iterations do not converge (incl. a GMRES correction
+    // above gmres_tol or no decrease of the residual after ls_max halvings
+    // of the step) or an injection location is not a filled element,
+    // status is set to error and m_data is not changed
+    // (the step can be retried with smaller dt)
+    void lubrication_step
+            (const Hydro_Frac_Sys_T &hf_sys,
+             const Load_T &load,
+             const Flow_Param_T &fl_par,
+             double dt,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             il::int_t &n_newton,
+             il::int_t &n_krylov,
+             il::Status &status);
+
+}
+
+#endif //INC_HFPX3D_LUBRICATION_H
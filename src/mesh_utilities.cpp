@@ -7,6 +7,7 @@
 // See the LICENSE.TXT file for more details. 
 //
 
+#include <cmath>
 #include <il/Array2D.h>
 #include <il/StaticArray.h>
 #include "mesh_utilities.h"
@@ -158,12 +159,12 @@ namespace hfp3d {
                 il::int_t i_n = inj_loc(i_el, n + 1);
                 // look if pressure is applied at the node
                 if (i_n != -1) {
-                    ++g_pp_dof;
                     m_data.dof_h_pp.dof_h(el, n) = g_pp_dof;
+                    ++g_pp_dof;
                     for (int l = 0; l < 3; ++l) {
                         int ldof = n * 3 + l;
-                        ++g_dd_dof;
                         m_data.dof_h_dd.dof_h(el, ldof) = g_dd_dof;
+                        ++g_dd_dof;
                     }
                 }
             }
@@ -293,4 +294,73 @@ namespace hfp3d {
         }
     }
 
+    // list of elements having at least one active DoF
+    il::Array<il::int_t> get_act_el_set
+            (const DoF_Handle_T &dof_h) {
+        il::int_t n_el = dof_h.dof_h.size(0);
+        il::int_t n_dpe = dof_h.dof_h.size(1);
+        il::Array<il::int_t> ae_set{};
+        ae_set.reserve(n_el);
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t l = 0; l < n_dpe; ++l) {
+                if (dof_h.dof_h(el, l) >= 0) {
+                    ae_set.append(el);
+                    break;
+                }
+            }
+        }
+        return ae_set;
+    }
+
+    // length scale of the mesh: max. element edge length
+    double get_mesh_length_scale
+            (const Mesh_Geom_T &mesh) {
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        double l_max = 0.0;
+        for (il::int_t el = 0; el < mesh.conn.size(1); ++el) {
+            for (il::int_t j = 0; j < 3; ++j) {
+                il::int_t n_a = mesh.conn(j, el);
+                il::int_t n_b = mesh.conn((j + 1) % 3, el);
+                double l2 = 0.0;
+                for (il::int_t k = 0; k < 3; ++k) {
+                    double dx = mesh.nods(k, n_b) - mesh.nods(k, n_a);
+                    l2 += dx * dx;
+                }
+                l_max = std::fmax(l_max, l2);
+            }
+        }
+        return std::sqrt(l_max);
+    }
+
+    // check the reduced mesh against the symmetry planes
+    bool is_mesh_sym_valid
+            (const Mesh_Geom_T &mesh,
+             const Mesh_Sym_T &sym) {
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        // distance to the plane below which a vertex is in the plane
+        const double d_tol = 1.0E-9 * get_mesh_length_scale(mesh);
+        for (il::int_t el = 0; el < mesh.conn.size(1); ++el) {
+            for (il::int_t k = 0; k < 3; ++k) {
+                if (!sym.is_mirror[k]) {
+                    continue;
+                }
+                double d_min = 0.0, d_max = 0.0;
+                for (il::int_t j = 0; j < 3; ++j) {
+                    double d = mesh.nods(k, mesh.conn(j, el)) -
+                               sym.mirror_crd[k];
+                    d_min = (j == 0) ? d : std::fmin(d_min, d);
+                    d_max = (j == 0) ? d : std::fmax(d_max, d);
+                }
+                bool is_in_plane = d_max <= d_tol && d_min >= -d_tol;
+                bool is_crossing = d_max > d_tol && d_min < -d_tol;
+                if (is_in_plane || is_crossing) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
 }
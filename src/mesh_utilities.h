@@ -30,6 +30,18 @@ namespace hfp3d {
 
         // material ID
         //il::Array<int> mat_id;
+
+        // fracture (fault) ID of each element, 0..(number of fractures - 1);
+        // empty means a single fracture
+        il::Array<il::int_t> frac_id{};
+    };
+
+    // mirror symmetry of the problem (geometry & loading)
+    // w.r. to the planes x_k = mirror_crd[k]
+    struct Mesh_Sym_T {
+        // is the plane x_k = mirror_crd[k] a symmetry plane
+        il::StaticArray<bool, 3> is_mirror{false};
+        il::StaticArray<double, 3> mirror_crd{0.0};
     };
 
     // physical model parameters
@@ -45,6 +57,12 @@ namespace hfp3d {
 
         // injection rate(s)
         il::Array<double> inj_rate{};
+
+        // injection schedule: if empty, inj_rate are constant rates
+        // at the injection locations (total rate = sum);
+        // otherwise, inj_rate[k] is the total rate
+        // from inj_time[k] to inj_time[k + 1] (zero before inj_time[0])
+        il::Array<double> inj_time{};
     };
 
     // numerical simulation parameters
@@ -65,6 +83,37 @@ namespace hfp3d {
         bool is_dd_local = true;
         // true -> local; false -> global (reference)
 
+        // reuse of the influence for congruent element pairs
+        // (related by rigid motion), see congruent_pairs.h
+        bool is_cp_reuse = false;
+        // tolerance for the comparison of pair geometries
+        // (relative to the max. element edge length in the mesh)
+        double cp_tol = 1.0E-9;
+        // max. number of stored (collocation point to element) blocks
+        il::int_t cp_max_size = 100000;
+
+        // reuse of the self- & adjacent element influence for similar
+        // element pairs (up to scaling), see near_field_cache.h;
+        // with is_cp_reuse, the other pairs are taken from the congruent-pair
+        // cache (see el2el_cache.h)
+        bool is_nf_reuse = false;
+        // relative tolerance for the comparison of pair shapes
+        double nf_tol = 1.0E-9;
+        // max. number of stored (element to element) blocks
+        il::int_t nf_max_size = 10000;
+
+        // single precision storage of far-field blocks, BSR matrix only
+        // (make_3dbem_matrix_vc_bsr; the dense & lazy storages reject it):
+        // elements a & b are far from each other if the distance between
+        // their centroids > ff_eta * max(diameter(a), diameter(b))
+        bool is_ff_float = false;
+        double ff_eta = 3.0;
+
+        // planar mesh detection (see planar_assembly.h): max. distance
+        // of the nodes to the plane of the mesh
+        // (relative to the max. element edge length in the mesh)
+        double pl_tol = 1.0E-12;
+
         // how to partition edges
         // bool is_part_uniform = true;
     };
@@ -153,6 +202,20 @@ namespace hfp3d {
              const DoF_Handle_T &dof_h_pp,
              il::io_t,
              Mesh_Data_T &m_data);
+
+    // list of elements having at least one active DoF
+    il::Array<il::int_t> get_act_el_set
+            (const DoF_Handle_T &dof_h);
+
+    // length scale of the mesh: max. element edge length
+    double get_mesh_length_scale
+            (const Mesh_Geom_T &mesh);
+
+    // false if an element lies in a symmetry plane (it would coincide
+    // with its image) or crosses it; elements may touch the plane
+    bool is_mesh_sym_valid
+            (const Mesh_Geom_T &mesh,
+             const Mesh_Sym_T &sym);
 }
 
 #endif //INC_HFPX3D_MESH_UTILITIES_H
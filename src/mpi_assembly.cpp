@@ -0,0 +1,152 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#ifdef HFPX3D_USE_MPI
+
+#include <algorithm>
+#include <vector>
+#include <mpi.h>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mpi_assembly.h"
+#include "krylov_solvers.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    // Partition of DoF rows between the ranks
+    void make_mpi_row_partition
+            (const DoF_Handle_T &dof_hndl,
+             MPI_Comm comm,
+             il::io_t, MPI_Row_Block_T &row_block) {
+        // the boundaries of the row blocks are placed
+        // at the first DoF of an element (if possible),
+        // so that each element's rows are assembled by one rank only
+        int n_ranks = 1, rank = 0;
+        MPI_Comm_size(comm, &n_ranks);
+        MPI_Comm_rank(comm, &rank);
+
+        const il::int_t num_ele = dof_hndl.dof_h.size(0);
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        const il::int_t n_tot = dof_hndl.n_dof + 1;
+
+        // first DoF of each element
+        std::vector<il::int_t> el_start;
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            il::int_t d_min = -1;
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t dof = dof_hndl.dof_h(el, l);
+                if (dof >= 0 && (d_min < 0 || dof < d_min)) {
+                    d_min = dof;
+                }
+            }
+            if (d_min >= 0) {
+                el_start.push_back(d_min);
+            }
+        }
+        el_start.push_back(n_tot);
+        std::sort(el_start.begin(), el_start.end());
+
+        il::Array<il::int_t> bnd{n_ranks + 1, 0};
+        bnd[n_ranks] = n_tot;
+        for (int r = 1; r < n_ranks; ++r) {
+            il::int_t target = (n_tot * r) / n_ranks;
+            il::int_t b = *std::lower_bound
+                    (el_start.begin(), el_start.end(), target);
+            bnd[r] = std::max(b, bnd[r - 1]);
+        }
+
+        row_block.comm = comm;
+        row_block.n_tot = n_tot;
+        row_block.row0 = bnd[rank];
+        row_block.n_rows = bnd[rank + 1] - bnd[rank];
+        row_block.rank_cnt = il::Array<int>{n_ranks};
+        row_block.rank_disp = il::Array<int>{n_ranks};
+        for (int r = 0; r < n_ranks; ++r) {
+            row_block.rank_disp[r] = static_cast<int>(bnd[r]);
+            row_block.rank_cnt[r] = static_cast<int>(bnd[r + 1] - bnd[r]);
+        }
+    }
+
+    // Assembly of the rows of this rank
+    MPI_Row_Block_T make_3dbem_matrix_vc_mpi
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             MPI_Comm comm) {
+        MPI_Row_Block_T row_block;
+        make_mpi_row_partition(dof_hndl, comm, il::io, row_block);
+        row_block.matrix = make_3dbem_matrix_vc_rows
+                (mu, nu, mesh, n_par, dof_hndl,
+                 row_block.row0, row_block.n_rows);
+        return row_block;
+    }
+
+    // Matrix-vector product
+    il::Array<double> mpi_dot
+            (const MPI_Row_Block_T &row_block,
+             const il::Array<double> &x) {
+        const il::int_t n_tot = row_block.n_tot;
+        const il::int_t n_rows = row_block.n_rows;
+        IL_EXPECT_FAST(x.size() == n_tot);
+        const il::Array2D<double> &m = row_block.matrix;
+
+        il::Array<double> y_loc{n_rows, 0.0};
+        for (il::int_t j = 0; j < n_tot; ++j) {
+            const double x_j = x[j];
+            for (il::int_t i = 0; i < n_rows; ++i) {
+                y_loc[i] += m(i, j) * x_j;
+            }
+        }
+        il::Array<double> y{n_tot, 0.0};
+        MPI_Allgatherv(y_loc.data(), static_cast<int>(n_rows), MPI_DOUBLE,
+                       y.data(), row_block.rank_cnt.data(),
+                       row_block.rank_disp.data(), MPI_DOUBLE,
+                       row_block.comm);
+        return y;
+    }
+
+    // GMRES solution
+    il::Array<double> solve_3dbem_system_mpi
+            (const MPI_Row_Block_T &row_block,
+             const il::Array<double> &rhs,
+             il::int_t restart,
+             double tol,
+             il::int_t max_iter,
+             il::io_t, il::int_t &n_iter, double &rel_res) {
+        // all ranks perform the same (replicated) vector operations;
+        // only the matrix-vector products are distributed
+        auto a_dot = [&row_block](const il::Array<double> &v) {
+            return mpi_dot(row_block, v);
+        };
+        return gmres(a_dot, Identity_Prec_T{}, rhs, restart, tol, max_iter,
+                     il::io, n_iter, rel_res);
+    }
+
+    // GCRO-DR solution
+    il::Array<double> solve_3dbem_system_mpi
+            (const MPI_Row_Block_T &row_block,
+             const il::Array<double> &rhs,
+             il::int_t restart,
+             double tol,
+             il::int_t max_iter,
+             il::io_t, Krylov_Recycle_T &rec,
+             il::int_t &n_iter, double &rel_res) {
+        // the recycled subspace is replicated on all ranks as well
+        auto a_dot = [&row_block](const il::Array<double> &v) {
+            return mpi_dot(row_block, v);
+        };
+        return gcro_dr(a_dot, Identity_Prec_T{}, rhs, restart, tol, max_iter,
+                       il::io, rec, n_iter, rel_res);
+    }
+
+}
+
+#endif // HFPX3D_USE_MPI
@@ -0,0 +1,89 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Distributed (MPI) assembly & iterative solution of the Volume Control
+// system: each rank keeps a contiguous block of rows (traction at
+// the CP of its "target" elements); vectors are replicated.
+// Compiled only if HFPX3D_USE_MPI is defined (e.g. -DHFPX3D_USE_MPI
+// with mpicxx); the calling program is run by mpirun -np N
+
+#ifndef INC_HFPX3D_MPI_ASSEMBLY_H
+#define INC_HFPX3D_MPI_ASSEMBLY_H
+
+#ifdef HFPX3D_USE_MPI
+
+#include <mpi.h>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+#include "krylov_solvers.h"
+
+namespace hfp3d {
+
+    // row block of the distributed matrix
+    struct MPI_Row_Block_T {
+        MPI_Comm comm;
+        // total number of rows (columns)
+        il::int_t n_tot = 0;
+        // rows of this rank: row0 ... row0 + n_rows - 1
+        il::int_t row0 = 0;
+        il::int_t n_rows = 0;
+        il::Array2D<double> matrix{};
+        // row counts & displacements of all ranks (for MPI_Allgatherv)
+        il::Array<int> rank_cnt{};
+        il::Array<int> rank_disp{};
+    };
+
+    // Partition of DoF rows between the ranks
+    // (element-wise, balanced by the number of rows)
+    void make_mpi_row_partition
+            (const DoF_Handle_T &dof_hndl,
+             MPI_Comm comm,
+             il::io_t, MPI_Row_Block_T &row_block);
+
+    // Assembly of the rows of this rank
+    MPI_Row_Block_T make_3dbem_matrix_vc_mpi
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             MPI_Comm comm);
+
+    // Matrix-vector product (x & the result are replicated on all ranks)
+    il::Array<double> mpi_dot
+            (const MPI_Row_Block_T &row_block,
+             const il::Array<double> &x);
+
+    // GMRES solution (rhs & the result are replicated on all ranks);
+    // the VC matrix is indefinite (zero pressure-pressure entry),
+    // short restarts (restart << n_tot) may stagnate
+    il::Array<double> solve_3dbem_system_mpi
+            (const MPI_Row_Block_T &row_block,
+             const il::Array<double> &rhs,
+             il::int_t restart,
+             double tol,
+             il::int_t max_iter,
+             il::io_t, il::int_t &n_iter, double &rel_res);
+
+    // (same, GCRO-DR with the subspace rec recycled from the previous
+    // solutions, e.g. at the previous time step)
+    il::Array<double> solve_3dbem_system_mpi
+            (const MPI_Row_Block_T &row_block,
+             const il::Array<double> &rhs,
+             il::int_t restart,
+             double tol,
+             il::int_t max_iter,
+             il::io_t, Krylov_Recycle_T &rec,
+             il::int_t &n_iter, double &rel_res);
+
+}
+
+#endif // HFPX3D_USE_MPI
+
+#endif //INC_HFPX3D_MPI_ASSEMBLY_H
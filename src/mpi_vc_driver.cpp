@@ -0,0 +1,104 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Minimal driver of the distributed Volume Control solver
+// (see mpi_assembly.h): a fracture given by numpy mesh files
+// is filled with a unit volume of fluid (zero far-field traction).
+// Build with the sources it depends on, e.g.
+//   mpicxx -std=c++11 -O2 -DHFPX3D_USE_MPI -I<il> src/mpi_vc_driver.cpp
+//       src/mpi_assembly.cpp src/system_assembly.cpp src/mesh_file_io.cpp
+//       src/mesh_utilities.cpp src/element_utilities.cpp
+//       src/tensor_utilities.cpp src/h_potential.cpp
+//       src/elasticity_kernel_integration.cpp src/congruent_pairs.cpp
+//       src/near_field_cache.cpp src/el2el_cache.cpp -o hfp3d_mpi
+// and run as
+//   mpirun -np 4 ./hfp3d_mpi Mesh_Files/ Elems_pennymesh121el_64.npy
+//       Nodes_pennymesh121el_64.npy [restart]
+
+#ifdef HFPX3D_USE_MPI
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <mpi.h>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+#include "mesh_file_io.h"
+#include "mpi_assembly.h"
+
+int main(int argc, char **argv) {
+    MPI_Init(&argc, &argv);
+    int rank = 0, n_ranks = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
+
+    if (argc < 4) {
+        if (rank == 0) {
+            std::printf("usage: %s mesh_dir conn_file nodes_file "
+                                "[restart]\n", argv[0]);
+        }
+        MPI_Finalize();
+        return 1;
+    }
+    const std::string src_dir{argv[1]};
+    const std::string conn_f_name{argv[2]};
+    const std::string node_f_name{argv[3]};
+    const il::int_t restart = (argc > 4) ? std::atol(argv[4]) : 200;
+
+    // elastic parameters & tolerances
+    const double mu = 1.0, nu = 0.35;
+    const double tol = 1.0E-10;
+    const il::int_t max_iter = 10000;
+
+    // every rank reads the mesh (Matlab numbering)
+    hfp3d::Mesh_Geom_T mesh;
+    hfp3d::load_mesh_from_numpy_64
+            (src_dir, conn_f_name, node_f_name, true, il::io, mesh);
+    hfp3d::Num_Param_T n_par;
+    hfp3d::DoF_Handle_T dof_hndl =
+            hfp3d::make_dof_h_crack(mesh, 2, n_par.tip_type);
+
+    double t_0 = MPI_Wtime();
+    hfp3d::MPI_Row_Block_T row_block = hfp3d::make_3dbem_matrix_vc_mpi
+            (mu, nu, mesh, n_par, dof_hndl, MPI_COMM_WORLD);
+    double t_1 = MPI_Wtime();
+
+    // zero traction, unit volume
+    const il::int_t n_tot = row_block.n_tot;
+    il::Array<double> rhs{n_tot, 0.0};
+    rhs[n_tot - 1] = 1.0;
+
+    il::int_t n_iter = 0;
+    double rel_res = 0.0;
+    il::Array<double> x = hfp3d::solve_3dbem_system_mpi
+            (row_block, rhs, restart, tol, max_iter, il::io, n_iter, rel_res);
+    double t_2 = MPI_Wtime();
+
+    if (rank == 0) {
+        double dd_max = 0.0;
+        for (il::int_t i = 0; i < n_tot - 1; ++i) {
+            dd_max = std::fmax(dd_max, std::fabs(x[i]));
+        }
+        std::printf("ranks %d, elements %ld, unknowns %ld\n",
+                    n_ranks, static_cast<long>(mesh.conn.size(1)),
+                    static_cast<long>(n_tot));
+        std::printf("assembly %.3f s, solution %.3f s "
+                            "(%ld mat-vec products, rel. residual %.3g)\n",
+                    t_1 - t_0, t_2 - t_1,
+                    static_cast<long>(n_iter), rel_res);
+        std::printf("pressure %.10g, max. |DD| %.10g\n",
+                    x[n_tot - 1], dd_max);
+    }
+    MPI_Finalize();
+    return (rel_res <= tol) ? 0 : 1;
+}
+
+#endif // HFPX3D_USE_MPI
@@ -0,0 +1,512 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "multi_fracture.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    // element sets of the fractures
+    il::Array<il::Array<il::int_t>> get_frac_el_sets
+            (const Mesh_Geom_T &mesh) {
+        const il::int_t num_ele = mesh.conn.size(1);
+        const bool is_single = mesh.frac_id.size() == 0;
+        IL_EXPECT_FAST(is_single || mesh.frac_id.size() == num_ele);
+        il::int_t n_frac = 1;
+        if (!is_single) {
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                IL_EXPECT_FAST(mesh.frac_id[el] >= 0);
+                if (mesh.frac_id[el] + 1 > n_frac) {
+                    n_frac = mesh.frac_id[el] + 1;
+                }
+            }
+        }
+        il::Array<il::Array<il::int_t>> el_set{n_frac};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            el_set[is_single ? 0 : mesh.frac_id[el]].append(el);
+        }
+        return el_set;
+    }
+
+    // traction at point x (normal nrm_glob) vs DD at the nodes of src_el
+    il::StaticArray2D<double, 3, 18> make_el2p_3dbem_trac
+            (double mu, double nu,
+             const Element_Struct_T &src_el,
+             const il::StaticArray<double, 3> &x,
+             const il::StaticArray<double, 3> &nrm_glob,
+             bool is_dd_local) {
+        HZ hz = make_el_pt_hz(src_el.vert, x, src_el.r_tensor);
+        il::StaticArray<double, 3> nrm_loc =
+                il::dot(src_el.r_tensor, nrm_glob);
+        il::StaticArray2D<double, 3, 18> trac_el2p_loc =
+                make_local_3dbem_trac_submatrix
+                        (1, Elast_Const_T{mu, nu}, hz.h, hz.z,
+                         src_el.tau, src_el.sf_m, nrm_loc);
+        return rotate_el2p_trac_submatrix
+                (trac_el2p_loc, src_el.r_tensor, is_dd_local);
+    }
+
+    // Block system assembly
+    Multi_Frac_System_T make_3dbem_system_mf
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Multi_Frac_Param_T &mf_par,
+             const DoF_Handle_T &dof_hndl) {
+// This function assembles the Volume Control systems of the fractures
+// (self-interaction blocks) and the cross-interaction blocks
+// (traction at fracture a vs DD at fracture b); the latter are
+// dense for close fractures, and low-rank (ACA with partial pivoting)
+// or neglected (if weak) for well-separated ones
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+
+        Multi_Frac_System_T mf_sys;
+        mf_sys.el_set = get_frac_el_sets(mesh);
+        const il::int_t n_frac = mf_sys.el_set.size();
+        mf_sys.n_frac = n_frac;
+
+        // DoF numbering within each fracture
+        // & inverse maps (DoF -> element, local DoF)
+        mf_sys.dof_h = il::Array<DoF_Handle_T>{n_frac};
+        mf_sys.offset = il::Array<il::int_t>{n_frac + 1, 0};
+        il::Array<il::Array<il::int_t>> dof_el{n_frac}, dof_l{n_frac};
+        for (il::int_t f = 0; f < n_frac; ++f) {
+            DoF_Handle_T &dof_f = mf_sys.dof_h[f];
+            dof_f.dof_h = il::Array2D<il::int_t>{num_ele, ndpe, -1};
+            for (il::int_t k = 0; k < mf_sys.el_set[f].size(); ++k) {
+                il::int_t el = mf_sys.el_set[f][k];
+                for (il::int_t l = 0; l < ndpe; ++l) {
+                    if (dof_hndl.dof_h(el, l) >= 0) {
+                        dof_f.dof_h(el, l) = dof_f.n_dof;
+                        ++dof_f.n_dof;
+                        dof_el[f].append(el);
+                        dof_l[f].append(l);
+                    }
+                }
+            }
+            mf_sys.offset[f + 1] = mf_sys.offset[f] + dof_f.n_dof + 1;
+        }
+
+        // self-interaction (Volume Control) matrices
+        mf_sys.self = il::Array<il::Array2D<double>>{n_frac};
+        il::Array<double> self_norm{n_frac, 0.0};
+        for (il::int_t f = 0; f < n_frac; ++f) {
+            const il::int_t n_f = mf_sys.dof_h[f].n_dof;
+            if (n_f == 0) {
+                // no active DoF: the fracture is skipped by the solver
+                mf_sys.self[f] = il::Array2D<double>{1, 1, 0.0};
+                continue;
+            }
+            mf_sys.self[f] = make_3dbem_matrix_vc_act
+                    (mu, nu, mesh, n_par, mf_sys.el_set[f], mf_sys.dof_h[f]);
+            // norm of the traction vs DD part only
+            // (the volume row & the pressure column have other units)
+            const il::Array2D<double> &m = mf_sys.self[f];
+            for (il::int_t j = 0; j < n_f; ++j) {
+                for (il::int_t i = 0; i < n_f; ++i) {
+                    self_norm[f] += m(i, j) * m(i, j);
+                }
+            }
+            self_norm[f] = std::sqrt(self_norm[f]);
+        }
+
+        // element properties
+        il::Array<Element_Struct_T> el_s{num_ele};
+        for (il::int_t f = 0; f < n_frac; ++f) {
+            for (il::int_t k = 0; k < mf_sys.el_set[f].size(); ++k) {
+                il::int_t el = mf_sys.el_set[f][k];
+                el_s[el] = get_mesh_el_struct(mesh, el, n_par.beta);
+            }
+        }
+
+        // bounding spheres of the fractures
+        il::Array<il::StaticArray<double, 3>> f_ctr{n_frac};
+        il::Array<double> f_rad{n_frac, 0.0};
+        for (il::int_t f = 0; f < n_frac; ++f) {
+            il::int_t n_f_el = mf_sys.el_set[f].size();
+            il::StaticArray<double, 3> ctr{0.0};
+            for (il::int_t k = 0; k < n_f_el; ++k) {
+                const Element_Struct_T &e = el_s[mf_sys.el_set[f][k]];
+                for (int j = 0; j < 3; ++j) {
+                    for (int i = 0; i < 3; ++i) {
+                        ctr[i] += e.vert(i, j) / (3.0 * n_f_el);
+                    }
+                }
+            }
+            for (il::int_t k = 0; k < n_f_el; ++k) {
+                const Element_Struct_T &e = el_s[mf_sys.el_set[f][k]];
+                for (int j = 0; j < 3; ++j) {
+                    double r2 = 0.0;
+                    for (int i = 0; i < 3; ++i) {
+                        r2 += (e.vert(i, j) - ctr[i]) * (e.vert(i, j) - ctr[i]);
+                    }
+                    f_rad[f] = std::fmax(f_rad[f], std::sqrt(r2));
+                }
+            }
+            f_ctr[f] = ctr;
+        }
+
+        // cross-interaction blocks
+        mf_sys.cross = il::Array<Frac_Block_T>{n_frac * n_frac};
+        for (il::int_t a = 0; a < n_frac; ++a) {
+            const il::int_t n_a = mf_sys.dof_h[a].n_dof;
+            for (il::int_t b = 0; b < n_frac; ++b) {
+                const il::int_t n_b = mf_sys.dof_h[b].n_dof;
+                if (a == b || n_a == 0 || n_b == 0) continue;
+                Frac_Block_T &blk = mf_sys.cross[a * n_frac + b];
+                const DoF_Handle_T &dof_a = mf_sys.dof_h[a];
+                const DoF_Handle_T &dof_b = mf_sys.dof_h[b];
+
+                double dist = 0.0;
+                for (int i = 0; i < 3; ++i) {
+                    dist += (f_ctr[a][i] - f_ctr[b][i]) *
+                            (f_ctr[a][i] - f_ctr[b][i]);
+                }
+                dist = std::sqrt(dist) - f_rad[a] - f_rad[b];
+                bool is_adm = dist >
+                        mf_par.eta * 2.0 * std::fmax(f_rad[a], f_rad[b]);
+
+                if (!is_adm) {
+                    // dense block
+                    blk.type = 2;
+                    blk.a = il::Array2D<double>{n_a, n_b, 0.0};
+                    for (il::int_t s_k = 0; s_k < mf_sys.el_set[b].size();
+                         ++s_k) {
+                        il::int_t source_elem = mf_sys.el_set[b][s_k];
+                        for (il::int_t t_k = 0;
+                             t_k < mf_sys.el_set[a].size(); ++t_k) {
+                            il::int_t target_elem = mf_sys.el_set[a][t_k];
+                            il::StaticArray2D<double, 18, 18> trac_infl =
+                                    make_el2el_3dbem_submatrix
+                                            (mu, nu, el_s[source_elem],
+                                             el_s[target_elem],
+                                             n_par.is_dd_local);
+                            for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                                il::int_t j1 = dof_b.dof_h(source_elem, i1);
+                                for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                                    il::int_t j0 =
+                                            dof_a.dof_h(target_elem, i0);
+                                    if (j0 >= 0 && j1 >= 0) {
+                                        blk.a(j0, j1) = trac_infl(i0, i1);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    continue;
+                }
+
+                // low-rank approximation (ACA with partial pivoting)
+                il::Array<double> u_c{}, v_c{};
+                il::Array<bool> is_row_used{n_a, false};
+                il::Array<bool> is_col_used{n_b, false};
+                double appr_norm2 = 0.0;
+                il::int_t rank = 0;
+                il::int_t i_piv = 0;
+                const il::int_t max_rank =
+                        std::min(mf_par.max_rank, std::min(n_a, n_b));
+                while (rank < max_rank) {
+                    // residual row i_piv
+                    il::Array<double> row{n_b, 0.0};
+                    {
+                        il::int_t t_el = dof_el[a][i_piv];
+                        il::int_t l = dof_l[a][i_piv];
+                        il::StaticArray<double, 3> nrm_cp;
+                        for (int j = 0; j < 3; ++j) {
+                            nrm_cp[j] = -el_s[t_el].r_tensor(2, j);
+                        }
+                        for (il::int_t s_k = 0;
+                             s_k < mf_sys.el_set[b].size(); ++s_k) {
+                            il::int_t s_el = mf_sys.el_set[b][s_k];
+                            il::StaticArray2D<double, 3, 18> trac =
+                                    make_el2p_3dbem_trac
+                                            (mu, nu, el_s[s_el],
+                                             el_s[t_el].cp_crd[l / 3],
+                                             nrm_cp, n_par.is_dd_local);
+                            for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                                il::int_t j1 = dof_b.dof_h(s_el, i1);
+                                if (j1 >= 0) {
+                                    row[j1] = trac(l % 3, i1);
+                                }
+                            }
+                        }
+                    }
+                    for (il::int_t k = 0; k < rank; ++k) {
+                        double u_ik = u_c[k * n_a + i_piv];
+                        for (il::int_t j = 0; j < n_b; ++j) {
+                            row[j] -= u_ik * v_c[k * n_b + j];
+                        }
+                    }
+                    is_row_used[i_piv] = true;
+
+                    il::int_t j_piv = -1;
+                    for (il::int_t j = 0; j < n_b; ++j) {
+                        if (!is_col_used[j] && (j_piv < 0 ||
+                                std::fabs(row[j]) > std::fabs(row[j_piv]))) {
+                            j_piv = j;
+                        }
+                    }
+                    if (j_piv < 0) break;
+                    if (row[j_piv] == 0.0) {
+                        // zero residual row: trying the next one
+                        i_piv = -1;
+                        for (il::int_t i = 0; i < n_a; ++i) {
+                            if (!is_row_used[i]) {
+                                i_piv = i;
+                                break;
+                            }
+                        }
+                        if (i_piv < 0) break;
+                        continue;
+                    }
+                    const double row_piv = row[j_piv];
+                    for (il::int_t j = 0; j < n_b; ++j) {
+                        row[j] /= row_piv;
+                    }
+
+                    // residual column j_piv
+                    il::Array<double> col{n_a, 0.0};
+                    {
+                        il::int_t s_el = dof_el[b][j_piv];
+                        il::int_t l = dof_l[b][j_piv];
+                        for (il::int_t t_k = 0;
+                             t_k < mf_sys.el_set[a].size(); ++t_k) {
+                            il::int_t t_el = mf_sys.el_set[a][t_k];
+                            il::StaticArray2D<double, 18, 18> trac_infl =
+                                    make_el2el_3dbem_submatrix
+                                            (mu, nu, el_s[s_el], el_s[t_el],
+                                             n_par.is_dd_local);
+                            for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                                il::int_t j0 = dof_a.dof_h(t_el, i0);
+                                if (j0 >= 0) {
+                                    col[j0] = trac_infl(i0, l);
+                                }
+                            }
+                        }
+                    }
+                    for (il::int_t k = 0; k < rank; ++k) {
+                        double v_jk = v_c[k * n_b + j_piv];
+                        for (il::int_t i = 0; i < n_a; ++i) {
+                            col[i] -= v_jk * u_c[k * n_a + i];
+                        }
+                    }
+                    is_col_used[j_piv] = true;
+
+                    // Frobenius norm of the approximation (update)
+                    double u2 = 0.0, v2 = 0.0;
+                    for (il::int_t i = 0; i < n_a; ++i) u2 += col[i] * col[i];
+                    for (il::int_t j = 0; j < n_b; ++j) v2 += row[j] * row[j];
+                    for (il::int_t k = 0; k < rank; ++k) {
+                        double uu = 0.0, vv = 0.0;
+                        for (il::int_t i = 0; i < n_a; ++i) {
+                            uu += col[i] * u_c[k * n_a + i];
+                        }
+                        for (il::int_t j = 0; j < n_b; ++j) {
+                            vv += row[j] * v_c[k * n_b + j];
+                        }
+                        appr_norm2 += 2.0 * uu * vv;
+                    }
+                    appr_norm2 += u2 * v2;
+                    for (il::int_t i = 0; i < n_a; ++i) u_c.append(col[i]);
+                    for (il::int_t j = 0; j < n_b; ++j) v_c.append(row[j]);
+                    ++rank;
+
+                    if (std::sqrt(u2 * v2) <=
+                        mf_par.aca_tol * std::sqrt(std::fabs(appr_norm2))) {
+                        break;
+                    }
+                    // next pivot row: max. of the new column
+                    i_piv = -1;
+                    for (il::int_t i = 0; i < n_a; ++i) {
+                        if (!is_row_used[i] && (i_piv < 0 ||
+                                std::fabs(col[i]) > std::fabs(col[i_piv]))) {
+                            i_piv = i;
+                        }
+                    }
+                    if (i_piv < 0) break;
+                }
+
+                if (rank == 0 || std::sqrt(std::fabs(appr_norm2)) <
+                                 mf_par.skip_tol * self_norm[a]) {
+                    // weak interaction: neglected
+                    blk.type = 0;
+                    continue;
+                }
+                blk.type = 1;
+                blk.u = il::Array2D<double>{n_a, rank};
+                blk.v = il::Array2D<double>{n_b, rank};
+                for (il::int_t k = 0; k < rank; ++k) {
+                    for (il::int_t i = 0; i < n_a; ++i) {
+                        blk.u(i, k) = u_c[k * n_a + i];
+                    }
+                    for (il::int_t j = 0; j < n_b; ++j) {
+                        blk.v(j, k) = v_c[k * n_b + j];
+                    }
+                }
+            }
+        }
+        return mf_sys;
+    }
+
+    // y_a += A_ab * x_b (DD part of x_b to traction part of y_a)
+    void add_cross_dot
+            (const Frac_Block_T &blk,
+             const double *x_b,
+             il::io_t, double *y_a) {
+        if (blk.type == 2) {
+            const il::int_t n_a = blk.a.size(0), n_b = blk.a.size(1);
+            for (il::int_t j = 0; j < n_b; ++j) {
+                double x_j = x_b[j];
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    y_a[i] += blk.a(i, j) * x_j;
+                }
+            }
+        } else if (blk.type == 1) {
+            const il::int_t n_a = blk.u.size(0), n_b = blk.v.size(0);
+            const il::int_t rank = blk.u.size(1);
+            for (il::int_t k = 0; k < rank; ++k) {
+                double vx = 0.0;
+                for (il::int_t j = 0; j < n_b; ++j) {
+                    vx += blk.v(j, k) * x_b[j];
+                }
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    y_a[i] += blk.u(i, k) * vx;
+                }
+            }
+        }
+    }
+
+    // Matrix-vector product
+    il::Array<double> mf_dot
+            (const Multi_Frac_System_T &mf_sys,
+             const il::Array<double> &x) {
+        const il::int_t n_frac = mf_sys.n_frac;
+        IL_EXPECT_FAST(x.size() == mf_sys.offset[n_frac]);
+        il::Array<double> y{x.size(), 0.0};
+        for (il::int_t a = 0; a < n_frac; ++a) {
+            const il::int_t o_a = mf_sys.offset[a];
+            const il::Array2D<double> &m = mf_sys.self[a];
+            for (il::int_t j = 0; j < m.size(1); ++j) {
+                for (il::int_t i = 0; i < m.size(0); ++i) {
+                    y[o_a + i] += m(i, j) * x[o_a + j];
+                }
+            }
+            for (il::int_t b = 0; b < n_frac; ++b) {
+                if (b == a) continue;
+                add_cross_dot(mf_sys.cross[a * n_frac + b],
+                              x.data() + mf_sys.offset[b],
+                              il::io, y.data() + o_a);
+            }
+        }
+        return y;
+    }
+
+    // Block Gauss-Seidel solution
+    il::Array<double> solve_3dbem_system_mf
+            (const Multi_Frac_System_T &mf_sys,
+             const Multi_Frac_Param_T &mf_par,
+             const il::Array<double> &rhs,
+             il::io_t, il::int_t &n_iter, il::Status &status) {
+        const il::int_t n_frac = mf_sys.n_frac;
+        const il::int_t n_tot = mf_sys.offset[n_frac];
+        IL_EXPECT_FAST(rhs.size() == n_tot);
+
+        // LU decomposition of the self-interaction blocks
+        // (except the fractures without active DoF)
+        std::vector<il::Array2D<double>> lu_self;
+        std::vector<il::Array<il::int_t>> piv_self(n_frac);
+        lu_self.reserve(n_frac);
+        for (il::int_t a = 0; a < n_frac; ++a) {
+            lu_self.push_back(mf_sys.self[a]);
+            if (mf_sys.dof_h[a].n_dof == 0) {
+                continue;
+            }
+            la_getrf(mf_par.la, il::io, lu_self[a], piv_self[a], status);
+            if (!status.ok()) {
+                n_iter = 0;
+                return il::Array<double>{n_tot, 0.0};
+            }
+        }
+
+        // equations of the skipped fractures are left out of the residual
+        il::Array<bool> is_eq_act{n_tot, true};
+        for (il::int_t a = 0; a < n_frac; ++a) {
+            if (mf_sys.dof_h[a].n_dof == 0) {
+                is_eq_act[mf_sys.offset[a]] = false;
+            }
+        }
+
+        double rhs_norm = 0.0;
+        for (il::int_t i = 0; i < n_tot; ++i) {
+            if (is_eq_act[i]) {
+                rhs_norm += rhs[i] * rhs[i];
+            }
+        }
+        rhs_norm = std::sqrt(rhs_norm);
+
+        il::Array<double> x{n_tot, 0.0};
+        for (n_iter = 0; n_iter < mf_par.gs_max_iter; ) {
+            // sweep over the fractures (latest values of other blocks)
+            for (il::int_t a = 0; a < n_frac; ++a) {
+                if (mf_sys.dof_h[a].n_dof == 0) {
+                    continue;
+                }
+                const il::int_t o_a = mf_sys.offset[a];
+                const il::int_t n_a = mf_sys.offset[a + 1] - o_a;
+                il::Array<double> r_a{n_a};
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    r_a[i] = -rhs[o_a + i];
+                }
+                for (il::int_t b = 0; b < n_frac; ++b) {
+                    if (b == a) continue;
+                    add_cross_dot(mf_sys.cross[a * n_frac + b],
+                                  x.data() + mf_sys.offset[b],
+                                  il::io, r_a.data());
+                }
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    r_a[i] = -r_a[i];
+                }
+                il::Array<double> x_a =
+                        la_getrs(mf_par.la, lu_self[a], piv_self[a], r_a);
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    x[o_a + i] = x_a[i];
+                }
+            }
+            ++n_iter;
+
+            // residual
+            il::Array<double> ax = mf_dot(mf_sys, x);
+            double res_norm = 0.0;
+            for (il::int_t i = 0; i < n_tot; ++i) {
+                if (is_eq_act[i]) {
+                    res_norm += (rhs[i] - ax[i]) * (rhs[i] - ax[i]);
+                }
+            }
+            res_norm = std::sqrt(res_norm);
+            if (res_norm <= mf_par.gs_tol * rhs_norm) break;
+        }
+        return x;
+    }
+
+}
@@ -0,0 +1,103 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Block-structured Volume Control system for multiple fractures:
+// one system (DD & pressure) per fracture (mesh.frac_id),
+// dense self-interaction blocks and dense, low-rank, or neglected
+// cross-interaction blocks; block Gauss-Seidel solver
+
+#ifndef INC_HFPX3D_MULTI_FRACTURE_H
+#define INC_HFPX3D_MULTI_FRACTURE_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+#include "dense_la.h"
+
+namespace hfp3d {
+
+    // parameters of the block assembly & solution
+    struct Multi_Frac_Param_T {
+        // admissibility: fractures a & b interact via a low-rank block
+        // if distance(a, b) > eta * max(diameter(a), diameter(b))
+        double eta = 2.0;
+        // relative tolerance of low-rank (ACA) approximation
+        double aca_tol = 1.0E-6;
+        // max. rank of the low-rank blocks
+        il::int_t max_rank = 64;
+        // the interaction is neglected if the norm of the block relative
+        // to the norm of the traction vs DD part of the self-interaction
+        // one is below skip_tol
+        double skip_tol = 1.0E-8;
+
+        // block Gauss-Seidel: relative residual tolerance & max. iterations
+        double gs_tol = 1.0E-10;
+        il::int_t gs_max_iter = 200;
+
+        // dense LU of the self-interaction blocks (backend & threads)
+        Dense_LA_T la{};
+    };
+
+    // cross-interaction block
+    // (traction at fracture a vs DD at fracture b)
+    struct Frac_Block_T {
+        // 0 -> neglected; 1 -> low-rank (u * v^T); 2 -> dense (a)
+        int type = 0;
+        il::Array2D<double> a{};
+        il::Array2D<double> u{};
+        il::Array2D<double> v{};
+    };
+
+    // block-structured system
+    struct Multi_Frac_System_T {
+        il::int_t n_frac = 0;
+        // elements of each fracture
+        il::Array<il::Array<il::int_t>> el_set{};
+        // DoF handle for each fracture (numbering within the fracture)
+        il::Array<DoF_Handle_T> dof_h{};
+        // position of the fracture's unknowns (DD & pressure)
+        // in the global vector (size n_frac + 1)
+        il::Array<il::int_t> offset{};
+        // self-interaction (Volume Control) matrices
+        il::Array<il::Array2D<double>> self{};
+        // cross-interaction blocks, (a, b) -> a * n_frac + b
+        il::Array<Frac_Block_T> cross{};
+    };
+
+    // element sets of the fractures
+    il::Array<il::Array<il::int_t>> get_frac_el_sets
+            (const Mesh_Geom_T &mesh);
+
+    // Block system assembly for the DoF listed in dof_hndl
+    Multi_Frac_System_T make_3dbem_system_mf
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Multi_Frac_Param_T &mf_par,
+             const DoF_Handle_T &dof_hndl);
+
+    // Matrix-vector product (vector: [DD_1; p_1; DD_2; p_2; ...])
+    il::Array<double> mf_dot
+            (const Multi_Frac_System_T &mf_sys,
+             const il::Array<double> &x);
+
+    // Block Gauss-Seidel solution with LU of the self-interaction blocks
+    // (rhs: [t_1; V_1; t_2; V_2; ...]); fractures without active DoF
+    // are skipped (zero pressure, their volume equation is ignored);
+    // n_iter == mf_par.gs_max_iter means no convergence
+    il::Array<double> solve_3dbem_system_mf
+            (const Multi_Frac_System_T &mf_sys,
+             const Multi_Frac_Param_T &mf_par,
+             const il::Array<double> &rhs,
+             il::io_t, il::int_t &n_iter, il::Status &status);
+
+}
+
+#endif //INC_HFPX3D_MULTI_FRACTURE_H
@@ -0,0 +1,219 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <il/Array.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "near_field_cache.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    Near_Field_Cache::Near_Field_Cache
+            (double mu, double nu, double beta,
+             double tol, il::int_t max_size) :
+            e_c_(mu, nu), blk_map_(max_size) {
+        IL_EXPECT_FAST(tol > 0.0);
+        beta_ = beta;
+        tol_ = tol;
+        n_hits_ = 0;
+        n_misses_ = 0;
+    }
+
+    int Near_Field_Cache::canon_shift_
+            (const il::StaticArray2D<double, 3, 3> &vert,
+             il::io_t, double &l_max) const {
+        il::StaticArray<double, 3> e_len{0.0};
+        for (int j = 0; j < 3; ++j) {
+            int m = (j + 1) % 3;
+            double l2 = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                double dx = vert(k, m) - vert(k, j);
+                l2 += dx * dx;
+            }
+            e_len[j] = std::sqrt(l2);
+        }
+        l_max = std::fmax(e_len[0], std::fmax(e_len[1], e_len[2]));
+        // (nearly) equal edges: the 1st of them
+        int c = 0;
+        for (int j = 1; j < 3; ++j) {
+            if (e_len[j] > e_len[c] + tol_ * l_max) {
+                c = j;
+            }
+        }
+        return c;
+    }
+
+    bool Near_Field_Cache::is_adjacent
+            (const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el) const {
+        double l_max;
+        canon_shift_(src_el.vert, il::io, l_max);
+        const double d_tol = tol_ * l_max;
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                double d2 = 0.0;
+                for (int k = 0; k < 3; ++k) {
+                    double dx = trg_el.vert(k, i) - src_el.vert(k, j);
+                    d2 += dx * dx;
+                }
+                if (d2 <= d_tol * d_tol) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    il::StaticArray2D<double, 18, 18> Near_Field_Cache::el2el
+            (const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local) {
+        // This function assembles the same 18*18 block
+        // as make_el2el_3dbem_submatrix; for adjacent elements,
+        // the block is calculated for the canonical (re-ordered) source
+        // & target elements w.r. to the canonical local coordinates
+        // of the source element, scaled to unit size, and stored;
+        // then it is re-scaled, rotated, and related
+        // to the nodes of the original elements (see el2el_adj)
+        if (!is_adjacent(src_el, trg_el)) {
+            return make_el2el_3dbem_submatrix
+                    (e_c_, src_el, trg_el, is_dd_local);
+        }
+        return el2el_adj(src_el, trg_el, is_dd_local);
+    }
+
+    il::StaticArray2D<double, 18, 18> Near_Field_Cache::el2el_adj
+            (const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local) {
+        // canonical (cyclically re-ordered) elements
+        double l_s, l_t;
+        const int c_s = canon_shift_(src_el.vert, il::io, l_s);
+        const int c_t = canon_shift_(trg_el.vert, il::io, l_t);
+        il::StaticArray2D<double, 3, 3> c_vert_s, c_vert_t;
+        for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                c_vert_s(k, j) = src_el.vert(k, (j + c_s) % 3);
+                c_vert_t(k, j) = trg_el.vert(k, (j + c_t) % 3);
+            }
+        }
+        il::StaticArray2D<double, 3, 3> r_c = make_el_r_tensor(c_vert_s);
+
+        // shape signature of the pair
+        NF_Key_T key;
+        for (int j = 0; j < 3; ++j) {
+            il::StaticArray<double, 3> dv_s, dv_t;
+            for (int k = 0; k < 3; ++k) {
+                dv_s[k] = (c_vert_s(k, j) - c_vert_s(k, 0)) / l_s;
+                dv_t[k] = (c_vert_t(k, j) - c_vert_s(k, 0)) / l_s;
+            }
+            il::StaticArray<double, 3> p_s = il::dot(r_c, dv_s);
+            il::StaticArray<double, 3> p_t = il::dot(r_c, dv_t);
+            if (j == 2) {
+                key.q[0] = std::llround(p_s[0] / tol_);
+                key.q[1] = std::llround(p_s[1] / tol_);
+            }
+            for (int k = 0; k < 3; ++k) {
+                key.q[2 + 3 * j + k] = std::llround(p_t[k] / tol_);
+            }
+        }
+
+        il::StaticArray2D<double, 18, 18> c_blk;
+        const il::StaticArray2D<double, 18, 18> *blk = blk_map_.find(key);
+        if (blk != nullptr) {
+            ++n_hits_;
+            c_blk = *blk;
+        } else {
+            ++n_misses_;
+            Element_Struct_T c_src = set_ele_struct(c_vert_s, beta_);
+            Element_Struct_T c_trg = set_ele_struct(c_vert_t, beta_);
+            // traction (reference coord-s) vs DD (canonical local coord-s)
+            il::StaticArray2D<double, 18, 18> trac_infl =
+                    make_el2el_3dbem_submatrix(e_c_, c_src, c_trg, true);
+            // traction w.r. to the canonical local coordinates, unit size
+            for (int n_t = 0; n_t < 6; ++n_t) {
+                for (int dof_s = 0; dof_s < 18; ++dof_s) {
+                    for (int k = 0; k < 3; ++k) {
+                        double t_k = 0.0;
+                        for (int i = 0; i < 3; ++i) {
+                            t_k += r_c(k, i) * trac_infl(3 * n_t + i, dof_s);
+                        }
+                        c_blk(3 * n_t + k, dof_s) = t_k * l_s;
+                    }
+                }
+            }
+            blk_map_.insert(key, c_blk);
+        }
+
+        // DD w.r. to the canonical local coordinates vs the unknowns:
+        // r_c.(r_tensor)^T if is_dd_local, r_c otherwise
+        il::StaticArray2D<double, 3, 3> dd_r = r_c;
+        if (is_dd_local) {
+            for (int k = 0; k < 3; ++k) {
+                for (int j = 0; j < 3; ++j) {
+                    double r_kj = 0.0;
+                    for (int i = 0; i < 3; ++i) {
+                        r_kj += r_c(k, i) * src_el.r_tensor(j, i);
+                    }
+                    dd_r(k, j) = r_kj;
+                }
+            }
+        }
+
+        il::StaticArray2D<double, 18, 18> trac_infl_el2el{0.0};
+        for (int n_ct = 0; n_ct < 6; ++n_ct) {
+            // node of the target element matching
+            // the n_ct-th node of the canonical one
+            int n_t = (n_ct < 3) ? (n_ct + c_t) % 3 : 3 + (n_ct - 3 + c_t) % 3;
+            for (int n_cs = 0; n_cs < 6; ++n_cs) {
+                int n_s = (n_cs < 3) ?
+                          (n_cs + c_s) % 3 : 3 + (n_cs - 3 + c_s) % 3;
+                // (r_c)^T . block . dd_r / l_s
+                il::StaticArray2D<double, 3, 3> b_n, b_r;
+                for (int k = 0; k < 3; ++k) {
+                    for (int j = 0; j < 3; ++j) {
+                        b_n(k, j) = c_blk(3 * n_ct + k, 3 * n_cs + j) / l_s;
+                    }
+                }
+                b_r = il::dot(r_c, il::Blas::transpose, il::dot(b_n, dd_r));
+                for (int k = 0; k < 3; ++k) {
+                    for (int j = 0; j < 3; ++j) {
+                        trac_infl_el2el(3 * n_t + k, 3 * n_s + j) = b_r(k, j);
+                    }
+                }
+            }
+        }
+        return trac_infl_el2el;
+    }
+
+    // Self-influence (diagonal) blocks of all elements
+    il::Array<il::StaticArray2D<double, 18, 18>> make_3dbem_diag_blocks
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par) {
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        Near_Field_Cache nf_cache{mu, nu, n_par.beta,
+                                  n_par.nf_tol, n_par.nf_max_size};
+
+        il::Array<il::StaticArray2D<double, 18, 18>> diag_blk{num_ele};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            Element_Struct_T el_s = get_mesh_el_struct(mesh, el, n_par.beta);
+            diag_blk[el] = nf_cache.el2el(el_s, el_s, n_par.is_dd_local);
+        }
+        return diag_blk;
+    }
+
+}
@@ -0,0 +1,118 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Reuse of the singular (self-) and near-singular (adjacent element)
+// influence blocks for similar (up to rigid motion and scaling)
+// element pairs; the influence scales as 1 / (element size)
+
+#ifndef INC_HFPX3D_NEAR_FIELD_CACHE_H
+#define INC_HFPX3D_NEAR_FIELD_CACHE_H
+
+#include <cstdint>
+#include <il/Array.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+#include "element_utilities.h"
+#include "h_potential.h"
+#include "block_cache.h"
+
+namespace hfp3d {
+
+    // quantized shape signature of an adjacent element pair:
+    // tau-coordinates of the 3rd vertex of the source element
+    // and coordinates of the target element's vertices, both
+    // in the "canonical" local coordinate system of the source element
+    // and relative to the length of its longest edge
+    struct NF_Key_T {
+        il::StaticArray<std::int64_t, 11> q;
+        bool operator==(const NF_Key_T &b) const {
+            for (int k = 0; k < 11; ++k) {
+                if (q[k] != b.q[k]) return false;
+            }
+            return true;
+        }
+    };
+
+    struct NF_Key_Hash_T {
+        std::size_t operator()(const NF_Key_T &key) const {
+            std::size_t h = 0;
+            for (int k = 0; k < 11; ++k) {
+                h ^= std::hash<std::int64_t>()(key.q[k]) +
+                        0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+    };
+
+    class Near_Field_Cache {
+    private:
+        // elastic constants (kernel table)
+        Elast_Const_T e_c_;
+        // relative position of the collocation points
+        double beta_;
+        // quantization step (relative to the element size)
+        double tol_;
+
+        // traction vs DD (18*18) at the canonical target element's CP,
+        // both w.r. to the canonical source element's local coordinates,
+        // for unit length of the source element's longest edge
+        Block_Cache<NF_Key_T, il::StaticArray2D<double, 18, 18>,
+                NF_Key_Hash_T> blk_map_;
+
+        il::int_t n_hits_, n_misses_;
+
+        // cyclic shift of the vertices such that the 1st edge
+        // is the longest one (l_max)
+        int canon_shift_
+                (const il::StaticArray2D<double, 3, 3> &vert,
+                 il::io_t, double &l_max) const;
+
+    public:
+        // max_size: max. number of stored 18*18 blocks
+        Near_Field_Cache
+                (double mu, double nu, double beta,
+                 double tol, il::int_t max_size);
+
+        il::int_t size() const { return blk_map_.size(); };
+        il::int_t max_size() const { return blk_map_.max_size(); };
+        il::int_t n_hits() const { return n_hits_; };
+        il::int_t n_misses() const { return n_misses_; };
+
+        // true if the elements share a vertex (or are the same element)
+        bool is_adjacent
+                (const Element_Struct_T &src_el,
+                 const Element_Struct_T &trg_el) const;
+
+        // Element-to-element influence matrix
+        // (same as make_el2el_3dbem_submatrix); taken from the cache
+        // (or computed & stored) for adjacent elements only
+        il::StaticArray2D<double, 18, 18> el2el
+                (const Element_Struct_T &src_el,
+                 const Element_Struct_T &trg_el,
+                 bool is_dd_local);
+
+        // (same, from the cache; the elements are assumed adjacent)
+        il::StaticArray2D<double, 18, 18> el2el_adj
+                (const Element_Struct_T &src_el,
+                 const Element_Struct_T &trg_el,
+                 bool is_dd_local);
+    };
+
+    // Self-influence (diagonal) 18*18 blocks of all elements
+    // (e.g. for block-diagonal preconditioning);
+    // similar elements are computed once
+    il::Array<il::StaticArray2D<double, 18, 18>> make_3dbem_diag_blocks
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par);
+
+}
+
+#endif //INC_HFPX3D_NEAR_FIELD_CACHE_H
@@ -0,0 +1,416 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <complex>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/StaticArray3D.h>
+#include <il/linear_algebra.h>
+#include "planar_assembly.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    // Checks if all nodes of the mesh are in one plane
+    Mesh_Plane_T get_mesh_plane
+            (const Mesh_Geom_T &mesh,
+             double tol) {
+        // the plane is the one of the 1st element
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1);
+        const il::int_t num_nod = mesh.nods.size(1);
+
+        Mesh_Plane_T plane;
+        il::StaticArray2D<double, 3, 3> el_vert;
+        for (il::int_t j = 0; j < 3; ++j) {
+            il::int_t n = mesh.conn(j, 0);
+            for (il::int_t k = 0; k < 3; ++k) {
+                el_vert(k, j) = mesh.nods(k, n);
+            }
+        }
+        il::StaticArray2D<double, 3, 3> el_r_tensor = make_el_r_tensor(el_vert);
+        for (il::int_t k = 0; k < 3; ++k) {
+            plane.origin[k] = el_vert(k, 0);
+        }
+
+        // the normal (its largest component is positive) and
+        // the projection of the reference axis least aligned with it (e1)
+        il::int_t k_max = 0, k_min = 0;
+        for (il::int_t k = 1; k < 3; ++k) {
+            if (std::fabs(el_r_tensor(2, k)) >
+                std::fabs(el_r_tensor(2, k_max))) {
+                k_max = k;
+            }
+            if (std::fabs(el_r_tensor(2, k)) <
+                std::fabs(el_r_tensor(2, k_min))) {
+                k_min = k;
+            }
+        }
+        const double n_sgn = (el_r_tensor(2, k_max) < 0.0) ? -1.0 : 1.0;
+        il::StaticArray<double, 3> e_1{0.0}, e_3;
+        for (il::int_t k = 0; k < 3; ++k) {
+            e_3[k] = n_sgn * el_r_tensor(2, k);
+            e_1[k] = -e_3[k_min] * e_3[k];
+        }
+        e_1[k_min] += 1.0;
+        const double e_1_norm =
+                std::sqrt(e_1[0] * e_1[0] + e_1[1] * e_1[1] + e_1[2] * e_1[2]);
+        for (il::int_t k = 0; k < 3; ++k) {
+            plane.r_tensor(0, k) = e_1[k] / e_1_norm;
+            plane.r_tensor(2, k) = e_3[k];
+        }
+        for (il::int_t k = 0; k < 3; ++k) {
+            int k1 = (k + 1) % 3, k2 = (k + 2) % 3;
+            plane.r_tensor(1, k) = plane.r_tensor(2, k1) * plane.r_tensor(0, k2) -
+                                   plane.r_tensor(2, k2) * plane.r_tensor(0, k1);
+        }
+
+        // distances of the nodes to the plane
+        const double d_tol = tol * get_mesh_length_scale(mesh);
+        plane.is_planar = true;
+        for (il::int_t n = 0; n < num_nod && plane.is_planar; ++n) {
+            double dist = 0.0;
+            for (il::int_t k = 0; k < 3; ++k) {
+                dist += plane.r_tensor(2, k) *
+                        (mesh.nods(k, n) - plane.origin[k]);
+            }
+            plane.is_planar = std::fabs(dist) <= d_tol;
+        }
+        return plane;
+    }
+
+    // Element-to-point influence matrix for a point in the element's plane
+    il::StaticArray2D<double, 3, 18> make_local_3dbem_trac_planar
+            (const Elast_Const_T &e_c, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm) {
+        // This function is make_local_3dbem_submatrix for h = 0
+        // reduced to the rows S13, S23, S33
+
+        il::StaticArray2D<double, 3, 18> stress_el_2_p_infl{0.0};
+
+        const double scale = e_c.scale;
+        const double h_tol = 1.0E-16;
+
+        il::StaticArray<std::complex<double>, 3> tz, d, dtau;
+        std::complex<double> ntau2;
+        for (int j = 0; j < 3; ++j) {
+            int q = (j + 1) % 3;
+            tz[j] = tau[j] - z;
+            dtau[j] = tau[q] - tau[j];
+            ntau2 = dtau[j] / std::conj(dtau[j]);
+            d[j] = 0.5 * (tz[j] - ntau2 * std::conj(tz[j]));
+        }
+        // exp(I * chi) (see make_local_3dbem_submatrix)
+        il::StaticArray<std::complex<double>, 3> eip, eid;
+        for (int j = 0; j < 3; ++j) {
+            double tz_abs = std::abs(tz[j]), d_abs = std::abs(d[j]);
+            eip[j] = (tz_abs > 0.0) ? tz[j] / tz_abs : 1.0;
+            eid[j] = (d_abs > 0.0) ? d[j] / d_abs : 1.0;
+        }
+
+        // [(S13+i*S23)/2; S33] vs SF monomials
+        il::StaticArray3D<std::complex<double>, 6, 2, 3> s_ij_infl_mon{0.0};
+        for (int m = 0; m < 3; ++m) {
+            int n = (m + 1) % 3;
+            std::complex<double> dm = d[m];
+            if (std::abs(dm) >= h_tol) {
+                il::StaticArray3D<std::complex<double>, 6, 4, 3>
+                        s_incr_n = s_ij_lim_h
+                        (e_c, eip[n] * std::conj(eid[m]), dm),
+                        s_incr_m = s_ij_lim_h
+                        (e_c, eip[m] * std::conj(eid[m]), dm);
+                for (int j = 0; j < 6; ++j) {
+                    s_ij_infl_mon(j, 0, 0) += s_incr_n(j, 2, 0) -
+                                              s_incr_m(j, 2, 0);
+                    s_ij_infl_mon(j, 0, 1) += s_incr_n(j, 2, 1) -
+                                              s_incr_m(j, 2, 1);
+                    s_ij_infl_mon(j, 1, 2) += s_incr_n(j, 3, 2) -
+                                              s_incr_m(j, 3, 2);
+                }
+            }
+        }
+
+        // contraction with "shifted" sfm, row by row (3 columns only)
+        il::StaticArray<std::complex<double>, 6> sfm_z_j;
+        for (int j = 0; j < 6; ++j) {
+            shift_el_sfm_row(sfm, j, z, il::io, sfm_z_j);
+            std::complex<double> s_t0 = 0.0, s_t1 = 0.0, s_n2 = 0.0;
+            for (int i = 0; i < 6; ++i) {
+                s_t0 += sfm_z_j[i] * s_ij_infl_mon(i, 0, 0);
+                s_t1 += sfm_z_j[i] * s_ij_infl_mon(i, 0, 1);
+                s_n2 += sfm_z_j[i] * s_ij_infl_mon(i, 1, 2);
+            }
+            int q = j * 3;
+            // [S13; S23; S33] vs \delta{u}_k at j-th node
+            stress_el_2_p_infl(0, q) = scale * 2.0 * std::real(s_t0);
+            stress_el_2_p_infl(1, q) = scale * 2.0 * std::imag(s_t0);
+            stress_el_2_p_infl(0, q + 1) = scale * 2.0 * std::real(s_t1);
+            stress_el_2_p_infl(1, q + 1) = scale * 2.0 * std::imag(s_t1);
+            stress_el_2_p_infl(2, q + 2) = scale * std::real(s_n2);
+        }
+        return stress_el_2_p_infl;
+    }
+
+    // Volume Control matrix assembly for a planar mesh
+    il::Array2D<double> make_3dbem_matrix_vc_planar
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function assembles the same matrix as make_3dbem_matrix_vc.
+// Element properties are calculated once; the local coordinates
+// of collocation points w.r. to the source element are obtained
+// from their in-plane coordinates by a shift & an in-plane (complex)
+// rotation (translation & rotation invariance of the kernel).
+// Tractions (and DD if !is_dd_local) are assembled w.r. to the plane's
+// coordinate system (each source element's one differs by an in-plane
+// rotation, i.e. a complex multiplication) and rotated to the reference
+// coordinate system once, for the whole matrix, if needed.
+
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(1) >= 3); // at least 3 nodes
+
+        const Mesh_Plane_T plane = get_mesh_plane(mesh, n_par.pl_tol);
+        if (!plane.is_planar) {
+            return make_3dbem_matrix_vc(mu, nu, mesh, n_par, il::io, dof_hndl);
+        }
+
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        }
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+
+        // the 3 DoF of a node are rotated together:
+        // they must be all active or all fixed
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (il::int_t n = 0; n < 6; ++n) {
+                int n_act = 0;
+                for (il::int_t k = 0; k < 3; ++k) {
+                    if (dof_hndl.dof_h(el, 3 * n + k) >= 0) {
+                        ++n_act;
+                    }
+                }
+                if (n_act != 0 && n_act != 3) {
+                    return make_3dbem_matrix_vc
+                            (mu, nu, mesh, n_par, il::io, dof_hndl);
+                }
+            }
+        }
+
+        // is the plane's coordinate system the reference one
+        bool is_ref_frame = true;
+        for (il::int_t j = 0; j < 3; ++j) {
+            for (il::int_t k = 0; k < 3; ++k) {
+                double delta = (j == k) ? 1.0 : 0.0;
+                if (std::fabs(plane.r_tensor(j, k) - delta) > 1.0E-15) {
+                    is_ref_frame = false;
+                }
+            }
+        }
+
+        const Elast_Const_T e_c{mu, nu};
+
+        // element properties;
+        // in-plane coordinates of the 1st vertex & the CPs,
+        // in-plane direction of the local e1 axis (exp(I * angle)),
+        // orientation of the element (+1 if its normal is the plane's one)
+        il::Array<Element_Struct_T> el_s{num_ele};
+        il::Array<std::complex<double>> w_v0{num_ele}, e1_dir{num_ele};
+        il::Array2D<std::complex<double>> w_cp{6, num_ele};
+        il::Array<double> el_or{num_ele};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            el_s[el] = get_mesh_el_struct(mesh, el, n_par.beta);
+            const Element_Struct_T &ele = el_s[el];
+            double x = 0.0, y = 0.0, c1 = 0.0, s1 = 0.0, o = 0.0;
+            for (il::int_t k = 0; k < 3; ++k) {
+                double dx = ele.vert(k, 0) - plane.origin[k];
+                x += plane.r_tensor(0, k) * dx;
+                y += plane.r_tensor(1, k) * dx;
+                c1 += plane.r_tensor(0, k) * ele.r_tensor(0, k);
+                s1 += plane.r_tensor(1, k) * ele.r_tensor(0, k);
+                o += plane.r_tensor(2, k) * ele.r_tensor(2, k);
+            }
+            w_v0[el] = std::complex<double>(x, y);
+            e1_dir[el] = std::complex<double>(c1, s1) /
+                         std::abs(std::complex<double>(c1, s1));
+            el_or[el] = (o < 0.0) ? -1.0 : 1.0;
+            for (il::int_t n = 0; n < 6; ++n) {
+                x = 0.0;
+                y = 0.0;
+                for (il::int_t k = 0; k < 3; ++k) {
+                    double dx = (ele.cp_crd[n])[k] - plane.origin[k];
+                    x += plane.r_tensor(0, k) * dx;
+                    y += plane.r_tensor(1, k) * dx;
+                }
+                w_cp(n, el) = std::complex<double>(x, y);
+            }
+        }
+
+        il::Array2D<double> global_matrix {num_dof + 1, num_dof + 1, 0.0};
+
+        // Loop over "source" elements
+//#pragma omp parallel for
+        for (il::int_t source_elem = 0;
+             source_elem < num_ele; ++source_elem) {
+            const Element_Struct_T &src_el = el_s[source_elem];
+            const std::complex<double> e1_s = e1_dir[source_elem];
+            const std::complex<double> e1_c = std::conj(e1_s);
+            const double or_s = el_or[source_elem];
+
+            // Loop over "Target" elements
+            for (il::int_t target_elem = 0;
+                 target_elem < num_ele; ++target_elem) {
+                // normal at CP vs source element's normal
+                // (traction = -or_t * or_s * [S13; S23; S33])
+                const double t_sgn = -el_or[target_elem] * or_s;
+                for (int n_t = 0; n_t < 6; ++n_t) {
+                    // CP in the source element's local coordinates
+                    std::complex<double> z =
+                            (w_cp(n_t, target_elem) - w_v0[source_elem]) *
+                            e1_c;
+                    z = (or_s < 0.0) ? std::conj(z) : z;
+                    il::StaticArray2D<double, 3, 18> trac_loc =
+                            make_local_3dbem_trac_planar
+                                    (e_c, z, src_el.tau, src_el.sf_m);
+
+                    // traction w.r. to the plane's coordinate system:
+                    // in-plane rotation (& reflection if or_s < 0)
+                    il::StaticArray2D<double, 3, 18> trac_cp_pl;
+                    for (int l = 0; l < 18; ++l) {
+                        std::complex<double> t_c(trac_loc(0, l),
+                                                 trac_loc(1, l));
+                        t_c = (or_s < 0.0) ? std::conj(t_c) : t_c;
+                        t_c *= t_sgn * e1_s;
+                        trac_cp_pl(0, l) = std::real(t_c);
+                        trac_cp_pl(1, l) = std::imag(t_c);
+                        trac_cp_pl(2, l) = t_sgn * or_s * trac_loc(2, l);
+                    }
+                    if (!n_par.is_dd_local) {
+                        // DD w.r. to the plane's coordinate system
+                        // (the same rotation for each node's columns)
+                        for (int n_s = 0; n_s < 6; ++n_s) {
+                            int q = 3 * n_s;
+                            for (int k = 0; k < 3; ++k) {
+                                std::complex<double> t_c
+                                        (trac_cp_pl(k, q),
+                                         trac_cp_pl(k, q + 1));
+                                t_c = (or_s < 0.0) ? std::conj(t_c) : t_c;
+                                t_c *= e1_s;
+                                trac_cp_pl(k, q) = std::real(t_c);
+                                trac_cp_pl(k, q + 1) = std::imag(t_c);
+                                trac_cp_pl(k, q + 2) *= or_s;
+                            }
+                        }
+                    }
+
+                    for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                        il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                        if (j1 < 0) continue;
+                        for (il::int_t k = 0; k < 3; ++k) {
+                            il::int_t j0 = dof_hndl.dof_h
+                                    (target_elem, 3 * n_t + k);
+                            if (j0 >= 0) {
+                                global_matrix(j0, j1) += trac_cp_pl(k, i1);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (!is_ref_frame) {
+            // rotation of tractions (rows of each node)
+            // to the reference coordinate system
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                for (il::int_t n = 0; n < 6; ++n) {
+                    il::int_t r_0 = dof_hndl.dof_h(el, 3 * n),
+                            r_1 = dof_hndl.dof_h(el, 3 * n + 1),
+                            r_2 = dof_hndl.dof_h(el, 3 * n + 2);
+                    if (r_0 < 0) {
+                        continue;
+                    }
+                    for (il::int_t j = 0; j < num_dof; ++j) {
+                        double t_0 = global_matrix(r_0, j),
+                                t_1 = global_matrix(r_1, j),
+                                t_2 = global_matrix(r_2, j);
+                        global_matrix(r_0, j) = plane.r_tensor(0, 0) * t_0 +
+                                                plane.r_tensor(1, 0) * t_1 +
+                                                plane.r_tensor(2, 0) * t_2;
+                        global_matrix(r_1, j) = plane.r_tensor(0, 1) * t_0 +
+                                                plane.r_tensor(1, 1) * t_1 +
+                                                plane.r_tensor(2, 1) * t_2;
+                        global_matrix(r_2, j) = plane.r_tensor(0, 2) * t_0 +
+                                                plane.r_tensor(1, 2) * t_1 +
+                                                plane.r_tensor(2, 2) * t_2;
+                    }
+                }
+            }
+            if (!n_par.is_dd_local) {
+                // rotation of DD (columns of each node)
+                for (il::int_t el = 0; el < num_ele; ++el) {
+                    for (il::int_t n = 0; n < 6; ++n) {
+                        il::int_t c_0 = dof_hndl.dof_h(el, 3 * n),
+                                c_1 = dof_hndl.dof_h(el, 3 * n + 1),
+                                c_2 = dof_hndl.dof_h(el, 3 * n + 2);
+                        if (c_0 < 0) {
+                            continue;
+                        }
+                        for (il::int_t j = 0; j < num_dof; ++j) {
+                            double t_0 = global_matrix(j, c_0),
+                                    t_1 = global_matrix(j, c_1),
+                                    t_2 = global_matrix(j, c_2);
+                            global_matrix(j, c_0) =
+                                    t_0 * plane.r_tensor(0, 0) +
+                                    t_1 * plane.r_tensor(1, 0) +
+                                    t_2 * plane.r_tensor(2, 0);
+                            global_matrix(j, c_1) =
+                                    t_0 * plane.r_tensor(0, 1) +
+                                    t_1 * plane.r_tensor(1, 1) +
+                                    t_2 * plane.r_tensor(2, 1);
+                            global_matrix(j, c_2) =
+                                    t_0 * plane.r_tensor(0, 2) +
+                                    t_1 * plane.r_tensor(1, 2) +
+                                    t_2 * plane.r_tensor(2, 2);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Influence of DD & pressure on tractions & volume
+        for (il::int_t source_elem = 0;
+             source_elem < num_ele; ++source_elem) {
+            il::StaticArray2D<double, 2, 18> vc_infl =
+                    make_el_vc_submatrix(el_s[source_elem], n_par.is_dd_local);
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t s_dof = dof_hndl.dof_h(source_elem, l);
+                if (s_dof >= 0) {
+                    // Volume vs DD
+                    global_matrix(num_dof, s_dof) = vc_infl(0, l);
+                    // Tractions vs pressure
+                    global_matrix(s_dof, num_dof) = vc_infl(1, l);
+                }
+            }
+        }
+        return global_matrix;
+    }
+
+}
@@ -0,0 +1,63 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Matrix assembly for planar (coplanar) meshes: all collocation points
+// are on the planes of all elements (h = 0), only the stress components
+// S13, S23, S33 (w.r. to the source element) contribute to traction,
+// and element's local coordinates differ by an in-plane rotation only
+
+#ifndef INC_HFPX3D_PLANAR_ASSEMBLY_H
+#define INC_HFPX3D_PLANAR_ASSEMBLY_H
+
+#include <complex>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+#include "h_potential.h"
+
+namespace hfp3d {
+
+    // plane of the mesh
+    struct Mesh_Plane_T {
+        bool is_planar = false;
+        // rotation tensor (rows: in-plane axes e1, e2 & the normal);
+        // the normal's largest component is positive and e1 is
+        // the projection of the reference axis least aligned with it
+        // (the reference coordinate system for a plane normal to an axis)
+        il::StaticArray2D<double, 3, 3> r_tensor{0.0};
+        // a point in the plane
+        il::StaticArray<double, 3> origin{0.0};
+    };
+
+    // Checks if all nodes of the mesh are in one plane
+    // (tol is relative to the max. element edge length in the mesh)
+    Mesh_Plane_T get_mesh_plane
+            (const Mesh_Geom_T &mesh,
+             double tol);
+
+    // Element-to-point influence matrix for a point in the element's plane:
+    // S13, S23, S33 (rows) vs DD at the element nodes
+    // (w.r. to the element's local coordinates)
+    il::StaticArray2D<double, 3, 18> make_local_3dbem_trac_planar
+            (const Elast_Const_T &e_c, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm);
+
+    // Volume Control matrix assembly for a planar mesh
+    // (falls back to make_3dbem_matrix_vc if the mesh is not planar)
+    il::Array2D<double> make_3dbem_matrix_vc_planar
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+}
+
+#endif //INC_HFPX3D_PLANAR_ASSEMBLY_H
@@ -0,0 +1,445 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Python module "hfp3d" (pybind11): mesh, assembly, Volume Control
+// time stepping & stress evaluation.
+// Compiled only if HFPX3D_USE_PYTHON is defined, e.g. by setup.py
+// (IL_INCLUDE_DIR=<il> pip install .; smoke test in
+// tests/test_python_bindings.py) or
+// c++ -O3 -shared -fPIC -std=c++11 -DHFPX3D_USE_PYTHON
+//     $(python3 -m pybind11 --includes) src/*.cpp
+//     -o hfp3d$(python3-config --extension-suffix)
+// il::Array2D is column-major: the arrays are exposed to numpy as
+// F-ordered views of the il buffers (no copy); the arrays returned
+// by assembly & stress routines own the il buffers they view.
+// The numpy arrays passed in (mesh, points) are copied once into
+// the il arrays; the node coordinates & the fields of MeshData can
+// then be changed in place through their views (the connectivity is
+// a read-only view, its indices being checked once). Arrays that
+// a setter may re-allocate (Load.inj_rate & inj_time) are returned
+// as copies.
+// Invalid parameters raise ValueError before the solver is called.
+// The GIL is released during assembly, solution & stress evaluation
+
+#ifdef HFPX3D_USE_PYTHON
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+#include "system_assembly.h"
+#include "time_stepping.h"
+#include "leak_off.h"
+
+namespace py = pybind11;
+
+namespace hfp3d {
+
+    // numpy arrays accepted as input (converted to F-order if needed)
+    template <typename T>
+    using Py_Array_F_T =
+    py::array_t<T, py::array::f_style | py::array::forcecast>;
+
+    // numpy view of an il::Array2D kept alive by owner
+    template <typename T>
+    py::array_t<T> py_view_2d
+            (il::Array2D<T> &a,
+             py::handle owner) {
+        const py::ssize_t s = sizeof(T);
+        return py::array_t<T>
+                ({static_cast<py::ssize_t>(a.size(0)),
+                  static_cast<py::ssize_t>(a.size(1))},
+                 {s, s * static_cast<py::ssize_t>(a.capacity(0))},
+                 a.data(), owner);
+    }
+
+    // numpy view of an il::Array kept alive by owner
+    template <typename T>
+    py::array_t<T> py_view_1d
+            (il::Array<T> &a,
+             py::handle owner) {
+        return py::array_t<T>
+                ({static_cast<py::ssize_t>(a.size())},
+                 {static_cast<py::ssize_t>(sizeof(T))},
+                 a.data(), owner);
+    }
+
+    // numpy array taking over the buffer of an il::Array2D
+    template <typename T>
+    py::array_t<T> py_from_il_2d
+            (il::Array2D<T> &&a) {
+        il::Array2D<T> *p = new il::Array2D<T>{std::move(a)};
+        py::capsule owner(p, [](void *q) {
+            delete static_cast<il::Array2D<T> *>(q);
+        });
+        return py_view_2d(*p, owner);
+    }
+
+    // numpy copy of an il::Array
+    template <typename T>
+    py::array_t<T> py_copy_1d
+            (const il::Array<T> &a) {
+        py::array_t<T> b(static_cast<py::ssize_t>(a.size()));
+        if (a.size() > 0) {
+            std::memcpy(b.mutable_data(), a.data(), a.size() * sizeof(T));
+        }
+        return b;
+    }
+
+    // copy of a 2D numpy array to an il::Array2D
+    template <typename T>
+    il::Array2D<T> il_from_py_2d
+            (const Py_Array_F_T<T> &a) {
+        if (a.ndim() != 2) {
+            throw std::invalid_argument("2D array expected");
+        }
+        const il::int_t n_r = a.shape(0);
+        const il::int_t n_c = a.shape(1);
+        il::Array2D<T> b{n_r, n_c};
+        for (il::int_t j = 0; j < n_c; ++j) {
+            std::memcpy(b.data() + j * b.capacity(0), a.data() + j * n_r,
+                        n_r * sizeof(T));
+        }
+        return b;
+    }
+
+    // copy of a 1D numpy array to an il::Array
+    template <typename T>
+    il::Array<T> il_from_py_1d
+            (const Py_Array_F_T<T> &a) {
+        if (a.ndim() != 1) {
+            throw std::invalid_argument("1D array expected");
+        }
+        il::Array<T> b{static_cast<il::int_t>(a.shape(0))};
+        std::memcpy(b.data(), a.data(), b.size() * sizeof(T));
+        return b;
+    }
+
+    // checks of the input (ValueError instead of a failed
+    // IL_EXPECT_FAST in the solver)
+    void py_check_num_param
+            (const Num_Param_T &n_par) {
+        if (!(n_par.beta > 0.0 && n_par.beta < 1.0) ||
+            n_par.tip_type < 0 || n_par.tip_type > 2) {
+            throw std::invalid_argument
+                    ("beta in (0, 1), tip_type 0, 1, or 2 expected");
+        }
+    }
+
+    void py_check_time_step_param
+            (const Time_Step_Param_T &ts_par) {
+        if (!(ts_par.dt_min > 0.0) || !(ts_par.dt_ini >= ts_par.dt_min) ||
+            !(ts_par.dt_max >= ts_par.dt_ini)) {
+            throw std::invalid_argument
+                    ("0 < dt_min <= dt_ini <= dt_max expected");
+        }
+        if (ts_par.n_iter_max < 1 || ts_par.n_iter_target < 1) {
+            throw std::invalid_argument
+                    ("n_iter_max >= 1, n_iter_target >= 1 expected");
+        }
+        if (!(ts_par.dt_shrink > 0.0 && ts_par.dt_shrink < 1.0) ||
+            !(ts_par.dt_grow_max >= 1.0)) {
+            throw std::invalid_argument
+                    ("dt_shrink in (0, 1), dt_grow_max >= 1 expected");
+        }
+        if (ts_par.pred_order < 0 || ts_par.pred_order > 2 ||
+            ts_par.n_fact_max < 1) {
+            throw std::invalid_argument
+                    ("pred_order 0, 1, or 2, n_fact_max >= 1 expected");
+        }
+    }
+
+    void py_check_load
+            (const Load_T &load) {
+        if (load.inj_time.size() > 0 &&
+            load.inj_time.size() != load.inj_rate.size()) {
+            throw std::invalid_argument
+                    ("inj_time empty or of the size of inj_rate expected");
+        }
+    }
+
+    // solution state bound to its mesh
+    struct Py_Mesh_Data_T {
+        Mesh_Data_T m_data{};
+        Leak_Off_T leak_off{};
+    };
+
+}
+
+PYBIND11_MODULE(hfp3d, m) {
+    using namespace hfp3d;
+    m.doc() = "HFPx3D: 3D BEM Volume Control solver for pressurized fractures";
+
+    py::class_<Mesh_Geom_T>(m, "Mesh")
+            .def(py::init([](const Py_Array_F_T<double> &nods,
+                             const Py_Array_F_T<il::int_t> &conn,
+                             bool is_matlab) {
+                     Mesh_Geom_T mesh;
+                     mesh.nods = il_from_py_2d(nods);
+                     mesh.conn = il_from_py_2d(conn);
+                     if (mesh.nods.size(0) < 3 || mesh.conn.size(0) < 3 ||
+                         mesh.conn.size(1) < 1) {
+                         throw std::invalid_argument
+                                 ("nods (3+, n_nodes) & conn (3+, n_el > 0) "
+                                  "expected");
+                     }
+                     // (vertex indices, renumbered if is_matlab,
+                     // as in hfp3d_create)
+                     const il::int_t base = is_matlab ? 1 : 0;
+                     const il::int_t n_nods = mesh.nods.size(1);
+                     for (il::int_t k = 0; k < mesh.conn.size(1); ++k) {
+                         for (il::int_t j = 0; j < 3; ++j) {
+                             const il::int_t n = mesh.conn(j, k);
+                             if (n < base || n >= n_nods + base) {
+                                 throw std::invalid_argument
+                                         ("conn: node index out of range");
+                             }
+                             mesh.conn(j, k) = n - base;
+                         }
+                     }
+                     return mesh;
+                 }),
+                 py::arg("nods"), py::arg("conn"),
+                 py::arg("is_matlab") = false)
+            .def_property_readonly("nods", [](py::object self) {
+                return py_view_2d(self.cast<Mesh_Geom_T &>().nods, self);
+            })
+            .def_property_readonly("conn", [](py::object self) {
+                py::array_t<il::int_t> conn =
+                        py_view_2d(self.cast<Mesh_Geom_T &>().conn, self);
+                conn.attr("setflags")(py::arg("write") = false);
+                return conn;
+            })
+            .def_property_readonly("n_el", [](const Mesh_Geom_T &mesh) {
+                return mesh.conn.size(1);
+            });
+
+    // (is_ff_float & ff_eta are left out: the BSR storage they are for
+    // is not exposed, and the dense assemblers reject is_ff_float)
+    py::class_<Num_Param_T>(m, "NumParam")
+            .def(py::init<>())
+            .def_readwrite("beta", &Num_Param_T::beta)
+            .def_readwrite("tip_type", &Num_Param_T::tip_type)
+            .def_readwrite("is_dd_local", &Num_Param_T::is_dd_local)
+            .def_readwrite("is_cp_reuse", &Num_Param_T::is_cp_reuse)
+            .def_readwrite("is_nf_reuse", &Num_Param_T::is_nf_reuse);
+
+    py::class_<Load_T>(m, "Load")
+            .def(py::init<>())
+            .def_property("s_inf", [](py::object self) {
+                              Load_T &load = self.cast<Load_T &>();
+                              return py::array_t<double>
+                                      ({static_cast<py::ssize_t>(6)},
+                                       {static_cast<py::ssize_t>
+                                                (sizeof(double))},
+                                       load.s_inf.data(), self);
+                          },
+                          [](Load_T &load, const Py_Array_F_T<double> &s) {
+                              if (s.ndim() != 1 || s.shape(0) != 6) {
+                                  throw std::invalid_argument
+                                          ("6 stress components expected");
+                              }
+                              for (il::int_t k = 0; k < 6; ++k) {
+                                  load.s_inf[k] = s.data()[k];
+                              }
+                          })
+            .def_property("inj_rate", [](const Load_T &load) {
+                              return py_copy_1d(load.inj_rate);
+                          },
+                          [](Load_T &load, const Py_Array_F_T<double> &r) {
+                              load.inj_rate = il_from_py_1d(r);
+                          })
+            .def_property("inj_time", [](const Load_T &load) {
+                              return py_copy_1d(load.inj_time);
+                          },
+                          [](Load_T &load, const Py_Array_F_T<double> &t) {
+                              load.inj_time = il_from_py_1d(t);
+                          });
+
+    py::class_<Time_Step_Param_T>(m, "TimeStepParam")
+            .def(py::init<>())
+            .def_readwrite("t_end", &Time_Step_Param_T::t_end)
+            .def_readwrite("dt_ini", &Time_Step_Param_T::dt_ini)
+            .def_readwrite("dt_min", &Time_Step_Param_T::dt_min)
+            .def_readwrite("dt_max", &Time_Step_Param_T::dt_max)
+            .def_readwrite("n_iter_max", &Time_Step_Param_T::n_iter_max)
+            .def_readwrite("n_iter_target",
+                           &Time_Step_Param_T::n_iter_target)
+            .def_readwrite("rate_target", &Time_Step_Param_T::rate_target)
+            .def_readwrite("dt_grow_max", &Time_Step_Param_T::dt_grow_max)
+            .def_readwrite("dt_shrink", &Time_Step_Param_T::dt_shrink)
+            .def_readwrite("pred_order", &Time_Step_Param_T::pred_order)
+            .def_readwrite("n_fact_max", &Time_Step_Param_T::n_fact_max);
+
+    // (the mesh is kept alive by the solution state)
+    py::class_<Py_Mesh_Data_T>(m, "MeshData")
+            .def(py::init([](const Mesh_Geom_T &mesh) {
+                     Py_Mesh_Data_T md;
+                     const il::int_t n_nod = 6 * mesh.conn.size(1);
+                     md.m_data.mesh = &mesh;
+                     md.m_data.dd = il::Array2D<double>{n_nod, 3, 0.0};
+                     md.m_data.pp = il::Array<double>{n_nod, 0.0};
+                     return md;
+                 }),
+                 py::arg("mesh"), py::keep_alive<1, 2>())
+            .def_property("time", [](const Py_Mesh_Data_T &md) {
+                              return md.m_data.time;
+                          },
+                          [](Py_Mesh_Data_T &md, double t) {
+                              md.m_data.time = t;
+                          })
+            .def_property_readonly("dd", [](py::object self) {
+                return py_view_2d
+                        (self.cast<Py_Mesh_Data_T &>().m_data.dd, self);
+            })
+            .def_property_readonly("pp", [](py::object self) {
+                return py_view_1d
+                        (self.cast<Py_Mesh_Data_T &>().m_data.pp, self);
+            })
+            .def("set_leak_off", [](Py_Mesh_Data_T &md,
+                                    const Num_Param_T &n_par,
+                                    const Py_Array_F_T<il::int_t> &fe_set,
+                                    double c_l) {
+                     py_check_num_param(n_par);
+                     if (!(c_l >= 0.0)) {
+                         throw std::invalid_argument("c_l >= 0 expected");
+                     }
+                     il::Array<il::int_t> fe = il_from_py_1d(fe_set);
+                     const il::int_t n_el = md.m_data.mesh->conn.size(1);
+                     for (il::int_t k = 0; k < fe.size(); ++k) {
+                         if (fe[k] < 0 || fe[k] >= n_el) {
+                             throw std::invalid_argument
+                                     ("fe_set: element out of range");
+                         }
+                     }
+                     md.leak_off = make_leak_off
+                             (*md.m_data.mesh, n_par, fe, c_l);
+                 },
+                 py::arg("n_par"), py::arg("fe_set"), py::arg("c_l"))
+            .def_property_readonly("vol_lost", [](const Py_Mesh_Data_T &md) {
+                return md.leak_off.vol_lost;
+            });
+
+    m.def("assemble_vc", [](double mu, double nu,
+                            const Mesh_Geom_T &mesh,
+                            const Num_Param_T &n_par) {
+              py_check_num_param(n_par);
+              DoF_Handle_T dof_h = make_dof_h_crack(mesh, 2, n_par.tip_type);
+              il::Array2D<double> matrix{};
+              {
+                  py::gil_scoped_release release;
+                  matrix = make_3dbem_matrix_vc
+                          (mu, nu, mesh, n_par, il::io, dof_h);
+              }
+              return py::make_tuple(py_from_il_2d(std::move(matrix)),
+                                    py_from_il_2d(std::move(dof_h.dof_h)));
+          },
+          "Volume Control matrix (DoF + 1)^2 & DoF handle (n_el, 18)",
+          py::arg("mu"), py::arg("nu"), py::arg("mesh"), py::arg("n_par"));
+
+    m.def("assemble_s", [](double mu, double nu,
+                           const Mesh_Geom_T &mesh,
+                           const Num_Param_T &n_par) {
+              py_check_num_param(n_par);
+              DoF_Handle_T dof_h = make_dof_h_crack(mesh, 2, n_par.tip_type);
+              il::Array2D<double> matrix{};
+              {
+                  py::gil_scoped_release release;
+                  matrix = make_3dbem_matrix_s
+                          (mu, nu, mesh, n_par, il::io, dof_h);
+              }
+              return py::make_tuple(py_from_il_2d(std::move(matrix)),
+                                    py_from_il_2d(std::move(dof_h.dof_h)));
+          },
+          "traction vs DD matrix & DoF handle (n_el, 18)",
+          py::arg("mu"), py::arg("nu"), py::arg("mesh"), py::arg("n_par"));
+
+    m.def("stress_matrix", [](double mu, double nu,
+                              const Mesh_Geom_T &mesh,
+                              const Num_Param_T &n_par,
+                              const Py_Array_F_T<double> &pts) {
+              py_check_num_param(n_par);
+              il::Array2D<double> m_pts_crd = il_from_py_2d(pts);
+              if (m_pts_crd.size(0) != 3) {
+                  throw std::invalid_argument("points (3, n_pts) expected");
+              }
+              il::Array2D<double> s_m{};
+              {
+                  py::gil_scoped_release release;
+                  s_m = make_3dbem_stress_f_s
+                          (mu, nu, mesh, n_par, m_pts_crd);
+              }
+              return py_from_il_2d(std::move(s_m));
+          },
+          "stress (6 * n_pts) vs nodal DD (18 * n_el) at points (3, n_pts)",
+          py::arg("mu"), py::arg("nu"), py::arg("mesh"), py::arg("n_par"),
+          py::arg("pts"));
+
+    m.def("stress", [](double mu, double nu,
+                       const Num_Param_T &n_par,
+                       const Py_Mesh_Data_T &md,
+                       const Py_Array_F_T<double> &pts) {
+              py_check_num_param(n_par);
+              il::Array2D<double> m_pts_crd = il_from_py_2d(pts);
+              if (m_pts_crd.size(0) != 3) {
+                  throw std::invalid_argument("points (3, n_pts) expected");
+              }
+              il::Array2D<double> stress{};
+              {
+                  py::gil_scoped_release release;
+                  stress = get_3dbem_stress_s
+                          (mu, nu, *md.m_data.mesh, n_par, md.m_data,
+                           m_pts_crd);
+              }
+              return py_from_il_2d(std::move(stress));
+          },
+          "stress (6, n_pts) at points (3, n_pts) for the DD of MeshData",
+          py::arg("mu"), py::arg("nu"), py::arg("n_par"), py::arg("m_data"),
+          py::arg("pts"));
+
+    m.def("vc_time_stepping", [](double mu, double nu,
+                                 const Num_Param_T &n_par,
+                                 const Load_T &load,
+                                 const Time_Step_Param_T &ts_par,
+                                 Py_Mesh_Data_T &md) {
+              py_check_num_param(n_par);
+              py_check_time_step_param(ts_par);
+              py_check_load(load);
+              Time_Step_Stat_T ts_stat;
+              il::Status status{};
+              {
+                  py::gil_scoped_release release;
+                  vc_time_stepping(mu, nu, *md.m_data.mesh, n_par, load,
+                                   ts_par, il::io, md.m_data, md.leak_off,
+                                   ts_stat, status);
+              }
+              if (!status.ok()) {
+                  throw std::runtime_error("VC time stepping failed");
+              }
+              py::dict stat;
+              stat["n_steps"] = ts_stat.n_steps;
+              stat["n_rejected"] = ts_stat.n_rejected;
+              stat["n_iter"] = ts_stat.n_iter;
+              stat["n_fact"] = ts_stat.n_fact;
+              stat["n_solves"] = ts_stat.n_solves;
+              return stat;
+          },
+          "VC time stepping from m_data.time to ts_par.t_end; "
+          "returns the statistics",
+          py::arg("mu"), py::arg("nu"), py::arg("n_par"), py::arg("load"),
+          py::arg("ts_par"), py::arg("m_data"));
+}
+
+#endif // HFPX3D_USE_PYTHON
@@ -22,184 +22,694 @@
 #include "tensor_utilities.h"
 #include "element_utilities.h"
 #include "elasticity_kernel_integration.h"
+#include "el2el_cache.h"
 
 namespace hfp3d {
 
-    // Element-to-point influence matrix (submatrix of the global one)
-    il::StaticArray2D<double, 6, 18>
-    make_local_3dbem_submatrix
+    // Edge geometry of a triangular element w.r. to a point
+    // (see make_local_3dbem_infl_nod_v)
+    struct El_Edge_Geom_T {
+        // d[m]: projection of the point onto the m-th edge line,
+        // eip[m] = exp(I * phi[m]), eix(k, m) = exp(I * chi(k, m))
+        il::StaticArray<std::complex<double>, 3> d, eip;
+        il::StaticArray2D<std::complex<double>, 2, 3> eix;
+        il::StaticArray2D<bool, 2, 3> is_90_ang;
+        bool is_degen;
+    };
+
+    // Number of doubles in the work buffer of fill_local_3dbem_infl_nod
+    // per point: inputs (h, |d|, a, cos(chi), sin(chi)) and outputs
+    // (9 general & 5 "reduced" functions) for 6 tuples
+    const il::int_t infl_nod_buf_size = 6 * (5 + 9 + 5);
+
+    // Element-to-point influences (combined stress components in c_mask
+    // vs DD at the element nodes) for n_pt points, not scaled;
+    // geom (n_pt) and v_buf (n_pt * infl_nod_buf_size) are work arrays
+    void fill_local_3dbem_infl_nod
             (const int kernel_id,
-             double mu, double nu, double h, std::complex<double> z,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
              const il::StaticArray<std::complex<double>, 3> &tau,
-             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm) {
-        // This function assembles a local "stiffness" sub-matrix
-        // (influence of DD at the element nodes to stresses at the point z)
-        // in terms of a triangular element's local coordinates
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             int c_mask,
+             il::io_t, El_Edge_Geom_T *geom, double *v_buf,
+             il::StaticArray3D<std::complex<double>, 6, 4, 3> *s_ij_infl_nod) {
+        // This function calculates the influence of DD at the element nodes
+        // to stresses at the points z[p] combined as
+        // [(S11+S22)/2; (S11-S22)/2+i*S12; (S13+i*S23)/2; S33]
+        // (2nd index of the result) in terms of a triangular element's
+        // local coordinates; only the components in c_mask
+        // (s_mask_* in h_potential.h) are calculated, the rest are zero
         //
         // tau (3) are coordinates of element's vertices and
         // the rows of sfm (6*6) are coefficients of shape functions
         // in terms of the element's own local coordinate system (tau-coordinates);
-        // h and z define the position of the (collocation) point x
+        // h[p] and z[p] define the position of the p-th point
         // in the same coordinates
-
-        il::StaticArray2D<double, 6, 18> stress_el_2_el_infl{0.0};
+        //
+        // The constituing functions of the integrals are evaluated
+        // for both ends of all edges of all points at once:
+        // tuple 6 * p + 2 * m + k is tau[m] (k = 0) or tau[m + 1] (k = 1)
+        // of the edge m w.r. to the point p
 
         // const std::complex<double> I(0.0, 1.0);
 
-        // scaling ("-" sign comes from traction Somigliana ID, H-term)
-        double scale = -mu / (4.0 * M_PI * (1.0 - nu));
         // tolerance parameters
         const double h_tol = 1.0E-16, a_tol = 1.0E-8;
 
-        // tz[m] and d[m] can be calculated here
-        il::StaticArray<std::complex<double>, 3> tz, d, dtau;
-        std::complex<double> ntau2;
-        for (int j = 0; j < 3; ++j) {
-            int q = (j + 1) % 3;
-            tz[j] = tau[j] - z;
-            dtau[j] = tau[q] - tau[j];
-            ntau2 = dtau[j] / std::conj(dtau[j]);
-            d[j] = 0.5 * (tz[j] - ntau2 * std::conj(tz[j]));
-        }
-        // also, "shifted" sfm from z, tau[m], and local sfm
-        il::StaticArray2D<std::complex<double>, 6, 6> shft_z = shift_el_sfm(z);
-        il::StaticArray2D<std::complex<double>, 6, 6> sfm_z =
-                il::dot(sfm, shft_z);
-
-        // searching for "degenerate" edges:
-        // point x (collocation pt) projects onto an edge line or a vertex
-        bool IsDegen = std::abs(d[0]) < h_tol || std::abs(d[1]) < h_tol ||
-                       std::abs(d[2]) < h_tol; // (d[0]*d[1]*d[2]==0);
-        il::StaticArray2D<bool, 2, 3> is_90_ang{false};
-
-        // calculating angles (phi, psi, chi)
-        il::StaticArray<double, 3> phi{0.0}, psi{0.0};
-        il::StaticArray2D<double, 2, 3> chi{0.0};
-        for (int j = 0; j < 3; ++j) {
-            phi[j] = std::arg(tz[j]);
-            psi[j] = std::arg(d[j]);
-        }
-        for (int j = 0; j < 3; ++j) {
-            for (int k = 0; k < 2; ++k) {
-                int q = (j + k) % 3;
-                chi(k, j) = phi[q] - psi[j];
-                // make sure it's between -pi and pi (add or subtract 2*pi)
-                if (chi(k, j) <= -M_PI)
-                    while (chi(k, j) <= -M_PI)
-                        chi(k, j) += 2.0 * M_PI;
-                else if (chi(k, j) > M_PI)
-                    while (chi(k, j) > M_PI)
-                        chi(k, j) -= 2.0 * M_PI;
-                // reprooving for "degenerate" edges
-                // (chi angles too close to 90 degrees)
-                if (fabs(M_PI_2 - std::fabs(chi(k, j))) < a_tol) {
-                    is_90_ang(k, j) = true;
-                    IsDegen = true;
+        const il::int_t n_tup = 6 * n_pt;
+        // inputs & outputs of the batched evaluation
+        double *v_h = v_buf, *v_d = v_h + n_tup, *v_a = v_d + n_tup,
+                *v_c = v_a + n_tup, *v_s = v_c + n_tup,
+                *f_v = v_s + n_tup, *f_v_red = f_v + 9 * n_tup;
+        bool is_red_needed = false;
+
+        for (il::int_t p = 0; p < n_pt; ++p) {
+            El_Edge_Geom_T &g = geom[p];
+            // tz[m] and d[m] can be calculated here
+            il::StaticArray<std::complex<double>, 3> tz, dtau;
+            std::complex<double> ntau2;
+            for (int j = 0; j < 3; ++j) {
+                int q = (j + 1) % 3;
+                tz[j] = tau[j] - z[p];
+                dtau[j] = tau[q] - tau[j];
+                ntau2 = dtau[j] / std::conj(dtau[j]);
+                g.d[j] = 0.5 * (tz[j] - ntau2 * std::conj(tz[j]));
+            }
+            // searching for "degenerate" edges:
+            // point x (collocation pt) projects onto an edge line or a vertex
+            g.is_degen = std::abs(g.d[0]) < h_tol ||
+                         std::abs(g.d[1]) < h_tol ||
+                         std::abs(g.d[2]) < h_tol; // (d[0]*d[1]*d[2]==0);
+            g.is_90_ang = il::StaticArray2D<bool, 2, 3>{false};
+
+            // unit complex numbers exp(I * phi), exp(I * psi)
+            // in the directions of tz & d (phi = psi = 0 for zero tz or d)
+            il::StaticArray<std::complex<double>, 3> eid;
+            for (int j = 0; j < 3; ++j) {
+                double tz_abs = std::abs(tz[j]), d_abs = std::abs(g.d[j]);
+                g.eip[j] = (tz_abs > 0.0) ? tz[j] / tz_abs : 1.0;
+                eid[j] = (d_abs > 0.0) ? g.d[j] / d_abs : 1.0;
+            }
+            // exp(I * chi), chi = phi - psi (no angles are calculated)
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 2; ++k) {
+                    int q = (j + k) % 3;
+                    g.eix(k, j) = g.eip[q] * std::conj(eid[j]);
+                    // reprooving for "degenerate" edges
+                    // (chi angles too close to 90 degrees: cos(chi) ~ 0)
+                    if (std::fabs(std::real(g.eix(k, j))) < a_tol) {
+                        g.is_90_ang(k, j) = true;
+                        g.is_degen = true;
+                    }
+                }
+            }
+
+            // arguments of the constituing functions (out-of-plane case;
+            // the values for points with h ~ 0 are not used)
+            for (int m = 0; m < 3; ++m) {
+                for (int k = 0; k < 2; ++k) {
+                    int q = (m + k) % 3;
+                    il::int_t i = 6 * p + 2 * m + k;
+                    v_h[i] = h[p];
+                    v_d[i] = std::abs(g.d[m]);
+                    v_a[i] = std::abs(tz[q] - g.d[m]);
+                    v_c[i] = std::real(g.eix(k, m));
+                    v_s[i] = std::imag(g.eix(k, m));
+                    v_a[i] = (v_s[i] < 0.0) ? -v_a[i] : v_a[i];
                 }
             }
+            if (g.is_degen && std::fabs(h[p]) >= h_tol) {
+                is_red_needed = true;
+            }
         }
 
-        // DD-to-stress influence
-        // [(S11+S22)/2; (S11-S22)/2+i*S12; (S13+i*S23)/2; S33]
-        // vs SF monomials (s_ij_infl_mon) and nodal values (s_ij_infl_nod)
-        il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_infl_mon{0.0};
-
-        // summation over edges
-        for (int m = 0; m < 3; ++m) {
-            int n = (m + 1) % 3;
-            std::complex<double> dm = d[m];
-            if (std::abs(dm) >= h_tol && ~is_90_ang(0, m) && ~is_90_ang(1, m)) {
-                std::complex<double>
-                // exp(I * chi(0, m))
-                        eixm = std::exp(std::complex<double>(0.0, chi(0, m))),
-                // exp(I * chi(1, m))
-                        eixn = std::exp(std::complex<double>(0.0, chi(1, m)));
-                // limit case (point x on the element's plane)
-                if (std::fabs(h) < h_tol) {
-                    il::StaticArray3D<std::complex<double>, 6, 4, 3>
-                            s_incr_n =
-                            s_integral_lim(kernel_id, nu, eixn, dm),
-                            s_incr_m =
-                            s_integral_lim(kernel_id, nu, eixm, dm);
-                    for (int j = 0; j < 6; ++j) {
-                        for (int k = 0; k < 4; ++k) {
-                            for (int l = 0; l < 3; ++l) {
-                                s_ij_infl_mon(j, k, l) += s_incr_n(j, k, l) -
-                                                          s_incr_m(j, k, l);
+        // constituing functions of the integrals for all tuples
+        integral_cst_fun_v(n_tup, v_h, v_d, v_a, v_c, v_s, il::io, f_v);
+        if (is_red_needed) {
+            integral_cst_fun_red_v(n_tup, v_h, v_d, v_a, il::io, f_v_red);
+        }
+
+        for (il::int_t p = 0; p < n_pt; ++p) {
+            const El_Edge_Geom_T &g = geom[p];
+            const double h_p = h[p];
+            const double *f_v_p = f_v + 6 * p, *f_v_red_p = f_v_red + 6 * p;
+
+            // DD-to-stress influence
+            // [(S11+S22)/2; (S11-S22)/2+i*S12; (S13+i*S23)/2; S33]
+            // vs SF monomials (s_ij_infl_mon) and nodal values (s_ij_infl_nod)
+            il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_infl_mon{0.0};
+
+            // summation over edges
+            for (int m = 0; m < 3; ++m) {
+                int n = (m + 1) % 3;
+                std::complex<double> dm = g.d[m];
+                if (std::abs(dm) >= h_tol &&
+                    !g.is_90_ang(0, m) && !g.is_90_ang(1, m)) {
+                    std::complex<double>
+                    // exp(I * chi(0, m))
+                            eixm = g.eix(0, m),
+                    // exp(I * chi(1, m))
+                            eixn = g.eix(1, m);
+                    // limit case (point x on the element's plane)
+                    if (std::fabs(h_p) < h_tol) {
+                        il::StaticArray3D<std::complex<double>, 6, 4, 3>
+                                s_incr_n =
+                                s_integral_lim(kernel_id, e_c, eixn, dm),
+                                s_incr_m =
+                                s_integral_lim(kernel_id, e_c, eixm, dm);
+                        for (int j = 0; j < 6; ++j) {
+                            for (int k = 0; k < 4; ++k) {
+                                for (int l = 0; l < 3; ++l) {
+                                    s_ij_infl_mon(j, k, l) +=
+                                            s_incr_n(j, k, l) -
+                                            s_incr_m(j, k, l);
+                                }
                             }
                         }
+                    } else { // out-of-plane case
+                        // coefficients, by 2nd index:
+                        // 0: S11+S22; 1: S11-S22+2*I*S12; 2: S13+S23; 3: S33
+                        il::StaticArray4D<std::complex<double>, 6, 4, 3, 9>
+                                c_n = s_integral_gen(kernel_id, e_c, eixn,
+                                                     h_p, dm, c_mask),
+                                c_m = s_integral_gen(kernel_id, e_c, eixm,
+                                                     h_p, dm, c_mask);
+                        // combining constituing functions (f_v) & coefficients
+                        add_s_integral_dot(1.0, c_n, f_v_p + 2 * m + 1, n_tup,
+                                           c_mask, il::io, s_ij_infl_mon);
+                        add_s_integral_dot(-1.0, c_m, f_v_p + 2 * m, n_tup,
+                                           c_mask, il::io, s_ij_infl_mon);
+                        // additional terms for "degenerate" case
+                        if (g.is_degen) {
+                            std::complex<double>
+                            // exp(I * phi[n])
+                                    eipn = g.eip[n],
+                            // exp(I * phi[m])
+                                    eipm = g.eip[m];
+                            il::StaticArray4D<std::complex<double>, 6, 4, 3, 5>
+                                    c_n_red = s_integral_red(kernel_id, e_c,
+                                                             eipn, h_p, c_mask),
+                                    c_m_red = s_integral_red(kernel_id, e_c,
+                                                             eipm, h_p, c_mask);
+                            add_s_integral_dot(1.0, c_n_red,
+                                               f_v_red_p + 2 * m + 1, n_tup,
+                                               c_mask, il::io, s_ij_infl_mon);
+                            add_s_integral_dot(-1.0, c_m_red,
+                                               f_v_red_p + 2 * m, n_tup,
+                                               c_mask, il::io, s_ij_infl_mon);
+                        }
                     }
-                    // il::blas(1.0, s_incr_n, 1.0, il::io, s_ij_infl_mon);
-                    // il::blas(-1.0, s_incr_m, 1.0, il::io, s_ij_infl_mon);
-                } else { // out-of-plane case
-                    double an = std::abs(tz[n] - dm),
-                            am = std::abs(tz[m] - dm);
-                    an = (chi(1, m) < 0) ? -an : an;
-                    am = (chi(0, m) < 0) ? -am : am;
-                    // constituing functions of the integrals
-                    il::StaticArray<std::complex<double>, 9>
-                            f_n = integral_cst_fun(h, dm, an, chi(1, m), eixn),
-                            f_m = integral_cst_fun(h, dm, am, chi(0, m), eixm);
-                    // coefficients, by 2nd index:
-                    // 0: S11+S22; 1: S11-S22+2*I*S12; 2: S13+S23; 3: S33
-                    il::StaticArray4D<std::complex<double>, 6, 4, 3, 9>
-                            c_n = s_integral_gen(kernel_id, nu, eixn, h, dm),
-                            c_m = s_integral_gen(kernel_id, nu, eixm, h, dm);
-                    // combining constituing functions & coefficients
-                    il::blas(1.0, c_n, f_n, 1.0, il::io, s_ij_infl_mon);
-                    il::blas(-1.0, c_m, f_m, 1.0, il::io, s_ij_infl_mon);
-                    // additional terms for "degenerate" case
-                    if (IsDegen) {
-                        std::complex<double>
-                        // exp(I * phi[n])
-                                eipn = std::exp(std::complex<double>
-                                                        (0.0, phi[n])),
-                        // exp(I * phi[m])
-                                eipm = std::exp(std::complex<double>
-                                                        (0.0, phi[m]));
-                        il::StaticArray<std::complex<double>, 5>
-                                f_n_red = integral_cst_fun_red(h, dm, an),
-                                f_m_red = integral_cst_fun_red(h, dm, am);
-                        il::StaticArray4D<std::complex<double>, 6, 4, 3, 5>
-                                c_n_red = s_integral_red(kernel_id, nu, eipn, h),
-                                c_m_red = s_integral_red(kernel_id, nu, eipm, h);
-                        il::blas(1.0, c_n_red, f_n_red, 1.0,
-                                 il::io, s_ij_infl_mon);
-                        il::blas(-1.0, c_m_red, f_m_red, 1.0,
-                                 il::io, s_ij_infl_mon);
+                }
+            }
+
+            // contraction with "shifted" sfm (left), row by row
+            // (see shift_el_sfm_row)
+            il::StaticArray3D<std::complex<double>, 6, 4, 3> &s_nod =
+                    s_ij_infl_nod[p];
+            il::StaticArray<std::complex<double>, 6> sfm_z_j;
+            for (int j = 0; j < 6; ++j) {
+                shift_el_sfm_row(sfm, j, z[p], il::io, sfm_z_j);
+                for (int l = 0; l < 3; ++l) {
+                    for (int k = 0; k < 4; ++k) {
+                        std::complex<double> s_jkl = 0.0;
+                        if (c_mask & (1 << k)) {
+                            for (int i = 0; i < 6; ++i) {
+                                s_jkl += sfm_z_j[i] * s_ij_infl_mon(i, k, l);
+                            }
+                        }
+                        s_nod(j, k, l) = s_jkl;
                     }
                 }
             }
         }
+    }
 
-        // contraction with "shifted" sfm (left)
-        il::StaticArray3D<std::complex<double>, 6, 4, 3>
-                s_ij_infl_nod = il::dot(sfm_z, s_ij_infl_mon);
+    void make_local_3dbem_infl_nod_v
+            (const int kernel_id,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             int c_mask,
+             il::io_t,
+             il::StaticArray3D<std::complex<double>, 6, 4, 3> *s_ij_infl_nod) {
+        // (see fill_local_3dbem_infl_nod)
+        il::Array<El_Edge_Geom_T> geom{n_pt};
+        il::Array<double> v_buf{infl_nod_buf_size * n_pt, 0.0};
+        fill_local_3dbem_infl_nod(kernel_id, e_c, n_pt, h, z, tau, sfm,
+                                  c_mask, il::io, geom.data(), v_buf.data(),
+                                  s_ij_infl_nod);
+    }
 
-        // re-shaping and scaling of the resulting matrix
+    // Element-to-point influence (combined stress components in c_mask
+    // vs DD at the element nodes), not scaled
+    il::StaticArray3D<std::complex<double>, 6, 4, 3>
+    make_local_3dbem_infl_nod
+            (const int kernel_id,
+             const Elast_Const_T &e_c, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             int c_mask) {
+        // (see fill_local_3dbem_infl_nod; the work arrays are on the stack)
+        il::StaticArray<El_Edge_Geom_T, 1> geom;
+        il::StaticArray<double, infl_nod_buf_size> v_buf{0.0};
+        il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_infl_nod;
+        fill_local_3dbem_infl_nod(kernel_id, e_c, 1, &h, &z, tau, sfm,
+                                  c_mask, il::io, geom.data(), v_buf.data(),
+                                  &s_ij_infl_nod);
+        return s_ij_infl_nod;
+    }
+
+    // Stress influence matrix [S11; S22; S33; S12; S13; S23] vs DD
+    // at the element nodes from the combined components (s_nod)
+    void set_stress_infl
+            (double scale,
+             const il::StaticArray3D<std::complex<double>, 6, 4, 3> &s_nod,
+             il::io_t, il::StaticArray2D<double, 6, 18> &stress) {
         for (int j = 0; j < 6; ++j) {
             int q = j * 3;
             for (int k = 0; k < 3; ++k) {
                 // [S11; S22; S33; S12; S13; S23] vs \delta{u}_k at j-th node
-                stress_el_2_el_infl(0, q + k) =
-                        scale * (std::real(s_ij_infl_nod(j, 0, k)) +
-                                 std::real(s_ij_infl_nod(j, 1, k)));
-                stress_el_2_el_infl(1, q + k) =
-                        scale * (std::real(s_ij_infl_nod(j, 0, k)) -
-                                 std::real(s_ij_infl_nod(j, 1, k)));
-                stress_el_2_el_infl(2, q + k) =
-                        scale * std::real(s_ij_infl_nod(j, 3, k));
-                stress_el_2_el_infl(3, q + k) =
-                        scale * std::imag(s_ij_infl_nod(j, 1, k));
-                stress_el_2_el_infl(4, q + k) =
-                        scale * 2.0 * std::real(s_ij_infl_nod(j, 2, k));
-                stress_el_2_el_infl(5, q + k) =
-                        scale * 2.0 * std::imag(s_ij_infl_nod(j, 2, k));
+                stress(0, q + k) = scale * (std::real(s_nod(j, 0, k)) +
+                                            std::real(s_nod(j, 1, k)));
+                stress(1, q + k) = scale * (std::real(s_nod(j, 0, k)) -
+                                            std::real(s_nod(j, 1, k)));
+                stress(2, q + k) = scale * std::real(s_nod(j, 3, k));
+                stress(3, q + k) = scale * std::imag(s_nod(j, 1, k));
+                stress(4, q + k) = scale * 2.0 * std::real(s_nod(j, 2, k));
+                stress(5, q + k) = scale * 2.0 * std::imag(s_nod(j, 2, k));
             }
         }
+    }
+
+    // Element-to-point influence matrices (submatrices of the global one)
+    // for n_pt points
+    void make_local_3dbem_submatrix_v
+            (const int kernel_id,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             il::io_t, il::StaticArray2D<double, 6, 18> *stress_el_2_el_infl) {
+        // This function assembles local "stiffness" sub-matrices
+        // (influence of DD at the element nodes to stresses at the points z)
+        // in terms of a triangular element's local coordinates
+        // (see make_local_3dbem_infl_nod_v)
+
+        // scaling ("-" sign comes from traction Somigliana ID, H-term)
+        const double scale = e_c.scale;
+
+        il::Array<il::StaticArray3D<std::complex<double>, 6, 4, 3>>
+                s_ij_infl_nod{n_pt};
+        make_local_3dbem_infl_nod_v(kernel_id, e_c, n_pt, h, z, tau, sfm,
+                                    s_mask_all, il::io, s_ij_infl_nod.data());
+
+        // re-shaping and scaling of the resulting matrices
+        for (il::int_t p = 0; p < n_pt; ++p) {
+            set_stress_infl(scale, s_ij_infl_nod[p], il::io,
+                            stress_el_2_el_infl[p]);
+        }
+    }
+
+    // Element-to-point influence matrix (submatrix of the global one)
+    il::StaticArray2D<double, 6, 18>
+    make_local_3dbem_submatrix
+            (const int kernel_id,
+             const Elast_Const_T &e_c, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm) {
+        // (see make_local_3dbem_submatrix_v)
+        il::StaticArray2D<double, 6, 18> stress_el_2_el_infl;
+        set_stress_infl(e_c.scale,
+                        make_local_3dbem_infl_nod(kernel_id, e_c, h, z,
+                                                  tau, sfm, s_mask_all),
+                        il::io, stress_el_2_el_infl);
         return stress_el_2_el_infl;
     }
 
+    il::StaticArray2D<double, 6, 18>
+    make_local_3dbem_submatrix
+            (const int kernel_id,
+             double mu, double nu, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm) {
+        return make_local_3dbem_submatrix
+                (kernel_id, Elast_Const_T{mu, nu}, h, z, tau, sfm);
+    }
+
+    // In-plane (complex, n_c) & normal (n_3) components of nrm_loc
+    // and the mask of the stress components needed for the traction
+    int get_trac_c_mask
+            (const il::StaticArray<double, 3> &nrm_loc,
+             il::io_t, std::complex<double> &n_c, double &n_3) {
+        // tolerance for the normal vector's components
+        const double n_tol = 1.0E-14;
+
+        n_c = std::complex<double>(nrm_loc[0], nrm_loc[1]);
+        n_3 = nrm_loc[2];
+        if (std::abs(n_c) < n_tol) {
+            n_c = 0.0;
+        }
+        if (std::fabs(n_3) < n_tol) {
+            n_3 = 0.0;
+        }
+        int c_mask = 0;
+        if (n_c != 0.0) {
+            c_mask |= s_mask_11_22 | s_mask_11_m22 | s_mask_13_23;
+        }
+        if (n_3 != 0.0) {
+            c_mask |= s_mask_13_23 | s_mask_33;
+        }
+        return c_mask;
+    }
+
+    // Traction influence matrix (3*18) vs DD at the element nodes
+    // from the combined stress components (s_nod)
+    void set_trac_infl
+            (double scale,
+             const il::StaticArray3D<std::complex<double>, 6, 4, 3> &s_nod,
+             std::complex<double> n_c, double n_3,
+             il::io_t, il::StaticArray2D<double, 3, 18> &trac) {
+        // T1 + I*T2 = (S11+S22)/2*n_c + ((S11-S22)/2+I*S12)*conj(n_c)
+        // + (S13+I*S23)*n_3;
+        // T3 = Re[(S13-I*S23)*n_c] + S33*n_3
+        for (int j = 0; j < 6; ++j) {
+            int q = j * 3;
+            for (int k = 0; k < 3; ++k) {
+                std::complex<double> s_13_23 = 2.0 * s_nod(j, 2, k);
+                std::complex<double> t_12 =
+                        std::real(s_nod(j, 0, k)) * n_c +
+                        s_nod(j, 1, k) * std::conj(n_c) +
+                        s_13_23 * n_3;
+                double t_3 = std::real(std::conj(s_13_23) * n_c) +
+                             std::real(s_nod(j, 3, k)) * n_3;
+                trac(0, q + k) = scale * std::real(t_12);
+                trac(1, q + k) = scale * std::imag(t_12);
+                trac(2, q + k) = scale * t_3;
+            }
+        }
+    }
+
+    // Element-to-point traction influence matrices (3*18) for n_pt points
+    // w.r. to the element's local coordinates
+    void make_local_3dbem_trac_submatrix_v
+            (const int kernel_id,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             const il::StaticArray<double, 3> &nrm_loc,
+             il::io_t, il::StaticArray2D<double, 3, 18> *trac_el_2_el_infl) {
+        // This function assembles the influence of DD at the element nodes
+        // to traction at the points z[p] on the planes with the normal
+        // nrm_loc (both w.r. to the element's local coordinates) directly,
+        // without the full stress influence matrix: only the stress
+        // components with non-zero weight vs nrm_loc are calculated
+        // (e.g. S13, S23 & S33 for a point on a parallel plane)
+
+        // scaling ("-" sign comes from traction Somigliana ID, H-term)
+        const double scale = e_c.scale;
+
+        std::complex<double> n_c;
+        double n_3;
+        int c_mask = get_trac_c_mask(nrm_loc, il::io, n_c, n_3);
+
+        il::Array<il::StaticArray3D<std::complex<double>, 6, 4, 3>>
+                s_ij_infl_nod{n_pt};
+        make_local_3dbem_infl_nod_v(kernel_id, e_c, n_pt, h, z, tau, sfm,
+                                    c_mask, il::io, s_ij_infl_nod.data());
+
+        for (il::int_t p = 0; p < n_pt; ++p) {
+            set_trac_infl(scale, s_ij_infl_nod[p], n_c, n_3, il::io,
+                          trac_el_2_el_infl[p]);
+        }
+    }
+
+    // Element-to-point traction influence matrix (3*18)
+    // w.r. to the element's local coordinates
+    il::StaticArray2D<double, 3, 18>
+    make_local_3dbem_trac_submatrix
+            (const int kernel_id,
+             const Elast_Const_T &e_c, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             const il::StaticArray<double, 3> &nrm_loc) {
+        // (see make_local_3dbem_trac_submatrix_v)
+        std::complex<double> n_c;
+        double n_3;
+        int c_mask = get_trac_c_mask(nrm_loc, il::io, n_c, n_3);
+        il::StaticArray2D<double, 3, 18> trac_el_2_el_infl;
+        set_trac_infl(e_c.scale,
+                      make_local_3dbem_infl_nod(kernel_id, e_c, h, z,
+                                                tau, sfm, c_mask),
+                      n_c, n_3, il::io, trac_el_2_el_infl);
+        return trac_el_2_el_infl;
+    }
+
+    // Element properties for the element el of the mesh
+    Element_Struct_T get_mesh_el_struct
+            (const Mesh_Geom_T &mesh,
+             il::int_t el,
+             double beta) {
+        // Vertices' coordinates
+        il::StaticArray2D<double, 3, 3> el_vert;
+        //il::StaticArray<double, 3> vert_wts;
+        for (il::int_t j = 0; j < 3; ++j) {
+            il::int_t n = mesh.conn(j, el);
+            for (il::int_t k = 0; k < 3; ++k) {
+                el_vert(k, j) = mesh.nods(k, n);
+            }
+            // set vert_wts[j]
+        }
+        return set_ele_struct(el_vert, beta);
+    }
+
+    // Element-to-point traction influence matrix (3*18)
+    // from the stress one (6*18) w.r. to the source element's local
+    // coordinate system
+    il::StaticArray2D<double, 3, 18> make_el2p_trac_submatrix
+            (const il::StaticArray2D<double, 6, 18> &stress_infl_el2p_loc,
+             const il::StaticArray2D<double, 3, 3> &src_r_tensor,
+             const il::StaticArray<double, 3> &nrm_cp_glob,
+             bool is_dd_local) {
+        // This function calculates traction (w.r. to the reference
+        // coordinate system) at a point with the normal nrm_cp_glob
+        // vs DD at the nodes of the "source" element;
+        // DD are w.r. to the source element's local coordinate system
+        // if is_dd_local, and w.r. to the reference one otherwise
+
+        // Multiplication by normal at CP
+
+        // Alternative 1: rotating stress at coll. pt.
+        // to the reference ("global") coordinate system
+        //stress_infl_el2p_glob = hfp3d::rotate_sim
+        // (src_r_tensor, stress_infl_el2p_loc);
+        //trac_cp_glob = hfp3d::nv_dot_sim(nrm_cp_glob, SIM_CP_G);
+
+        // Alternative 2: rotating nrm_cp_glob to
+        // the source element's local coordinate system
+        il::StaticArray<double, 3> nrm_cp_loc =
+                il::dot(src_r_tensor, nrm_cp_glob);
+        il::StaticArray2D<double, 3, 18> trac_el2p_loc =
+                nv_dot_sim(nrm_cp_loc, stress_infl_el2p_loc);
+
+        // Alternative 3: traction vector
+        // in terms of local coordinates at CP
+        //trac_cp_x_loc = il::dot
+        // (trg_r_tensor, il::Blas::transpose, trac_cp_glob);
+
+        return rotate_el2p_trac_submatrix
+                (trac_el2p_loc, src_r_tensor, is_dd_local);
+    }
+
+    // Element-to-point traction influence matrix (3*18)
+    // from the one w.r. to the source element's local coordinates
+    il::StaticArray2D<double, 3, 18> rotate_el2p_trac_submatrix
+            (const il::StaticArray2D<double, 3, 18> &trac_el2p_loc,
+             const il::StaticArray2D<double, 3, 3> &src_r_tensor,
+             bool is_dd_local) {
+        // This function rotates traction (and DD if !is_dd_local)
+        // from the source element's local coordinate system
+        // to the reference one
+        il::StaticArray2D<double, 3, 18> trac_cp_glob = il::dot
+                (src_r_tensor, il::Blas::transpose, trac_el2p_loc);
+
+        if (!is_dd_local) {
+            // Re-relating DD-to traction influence to DD
+            // w.r. to the reference coordinate system
+            il::StaticArray2D<double, 3, 3> trac_infl_n2p,
+                    trac_infl_n2p_glob;
+            for (int n_s = 0; n_s < 6; ++n_s) {
+                // taking a block (one node of the "source" element)
+                for (int j = 0; j < 3; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        trac_infl_n2p(k, j) =
+                                trac_cp_glob(k, 3 * n_s + j);
+                    }
+                }
+
+                // Coordinate rotation (for the unknown)
+                trac_infl_n2p_glob =
+                        il::dot(trac_infl_n2p, src_r_tensor);
+
+                for (int j = 0; j < 3; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        trac_cp_glob(k, 3 * n_s + j) =
+                                trac_infl_n2p_glob(k, j);
+                    }
+                }
+            }
+        }
+        return trac_cp_glob;
+    }
+
+    // Element-to-element influence matrix (traction at the CP
+    // of the "target" element vs DD at the nodes of the "source" one)
+    il::StaticArray2D<double, 18, 18> make_el2el_3dbem_submatrix
+            (const Elast_Const_T &e_c,
+             const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local) {
+        // This function assembles the 18*18 block of the global matrix
+        // relating tractions (w.r. to the reference coordinate system)
+        // at the collocation points of the "target" element (trg_el)
+        // to DD at the nodes of the "source" element (src_el);
+        // DD are w.r. to the source element's local coordinate system
+        // if is_dd_local, and w.r. to the reference one otherwise
+
+        // Normal vector at collocation point (x)
+        il::StaticArray<double, 3> nrm_cp_glob;
+        for (int j = 0; j < 3; ++j) {
+            nrm_cp_glob[j] = -trg_el.r_tensor(2, j);
+        }
+
+        // ... w.r. to the source element's local coordinate system
+        il::StaticArray<double, 3> nrm_cp_loc =
+                il::dot(src_el.r_tensor, nrm_cp_glob);
+
+        // Shifting to the collocation points of the "target" element
+        il::StaticArray<double, 6> cp_h;
+        il::StaticArray<std::complex<double>, 6> cp_z;
+        for (int n_t = 0; n_t < 6; ++n_t) {
+            HZ hz = make_el_pt_hz
+                    (src_el.vert, trg_el.cp_crd[n_t], src_el.r_tensor);
+            cp_h[n_t] = hz.h;
+            cp_z[n_t] = hz.z;
+        }
+
+        // Calculating DD-to traction influence at all 6 points
+        // w.r. to the source element's local coordinate system
+        il::StaticArray<il::StaticArray2D<double, 3, 18>, 6> trac_el2p_loc;
+        make_local_3dbem_trac_submatrix_v
+                (1, e_c, 6, cp_h.data(), cp_z.data(), src_el.tau, src_el.sf_m,
+                 nrm_cp_loc, il::io, trac_el2p_loc.data());
+
+        il::StaticArray2D<double, 18, 18> trac_infl_el2el{0.0};
+        // Loop over nodes of the "target" element
+        for (int n_t = 0; n_t < 6; ++n_t) {
+            // Rotation to the reference coordinate system
+            il::StaticArray2D<double, 3, 18> trac_cp_glob =
+                    rotate_el2p_trac_submatrix
+                            (trac_el2p_loc[n_t], src_el.r_tensor, is_dd_local);
+
+            // Adding the block to the element-to-element
+            // influence sub-matrix
+            for (int dof_s = 0; dof_s < 18; ++dof_s) {
+                for (int k = 0; k < 3; ++k) {
+                    trac_infl_el2el(3 * n_t + k, dof_s) =
+                            trac_cp_glob(k, dof_s);
+                }
+            }
+        }
+        return trac_infl_el2el;
+    }
+
+    il::StaticArray2D<double, 18, 18> make_el2el_3dbem_submatrix
+            (double mu, double nu,
+             const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local) {
+        return make_el2el_3dbem_submatrix
+                (Elast_Const_T{mu, nu}, src_el, trg_el, is_dd_local);
+    }
+
+    // Element pairs of the dense assemblers below: for each "source"
+    // element of el_set (all elements if el_set is empty) accepted by
+    // is_src(s_el), src_f(s_el, src_el) is called; then, for each
+    // "target" element of el_set accepted by is_trg(s_el, t_el),
+    // add_blk(s_el, t_el, src_el, trg_el, trac_infl_el2el) receives
+    // the element-to-element influence sub-matrix (from el_cache)
+    template <typename Is_Src_F, typename Src_F,
+            typename Is_Trg_F, typename Add_Blk_F>
+    void for_each_el_pair
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &el_set,
+             bool is_dd_local,
+             Is_Src_F is_src,
+             Src_F src_f,
+             Is_Trg_F is_trg,
+             Add_Blk_F add_blk,
+             il::io_t, El2El_Cache &el_cache) {
+        const il::int_t num_ele = mesh.conn.size(1);
+        const bool is_all = el_set.size() == 0;
+        const il::int_t n_set = is_all ? num_ele : el_set.size();
+
+        // Loop over "source" elements
+//#pragma omp parallel for
+        for (il::int_t s_k = 0; s_k < n_set; ++s_k) {
+            il::int_t source_elem = is_all ? s_k : el_set[s_k];
+            IL_EXPECT_FAST(source_elem >= 0 && source_elem < num_ele);
+            if (!is_src(source_elem)) {
+                continue;
+            }
+            // Vertices, basis (shape) functions, rotation tensor, etc.
+            Element_Struct_T src_el =
+                    get_mesh_el_struct(mesh, source_elem, n_par.beta);
+            src_f(source_elem, src_el);
+
+            // Loop over "Target" elements
+            for (il::int_t t_k = 0; t_k < n_set; ++t_k) {
+                il::int_t target_elem = is_all ? t_k : el_set[t_k];
+                if (!is_trg(source_elem, target_elem)) {
+                    continue;
+                }
+                // Vertices, rotation tensor, collocation points, etc.
+                Element_Struct_T trg_el =
+                        get_mesh_el_struct(mesh, target_elem, n_par.beta);
+
+                il::StaticArray2D<double, 18, 18> trac_infl_el2el =
+                        el_cache.el2el(src_el, trg_el, is_dd_local);
+                add_blk(source_elem, target_elem, src_el, trg_el,
+                        trac_infl_el2el);
+            }
+        }
+    }
+
+    // Adding the element-to-element influence sub-matrix
+    // to the global influence matrix (free DoF of dof_hndl)
+    void add_el2el_block
+            (const DoF_Handle_T &dof_hndl,
+             il::int_t source_elem,
+             il::int_t target_elem,
+             const il::StaticArray2D<double, 18, 18> &trac_infl_el2el,
+             il::io_t, il::Array2D<double> &global_matrix) {
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+            il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+            if (j1 < 0) {
+                continue;
+            }
+            for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                if (j0 >= 0) {
+                    global_matrix(j0, j1) += trac_infl_el2el(i0, i1);
+                }
+            }
+        }
+    }
+
     // Static matrix assembly
     il::Array2D<double> make_3dbem_matrix_s
             (double mu, double nu,
@@ -209,8 +719,10 @@ namespace hfp3d {
 // This function performs BEM matrix assembly from boundary mesh geometry data:
 // mesh connectivity (mesh.conn) and nodes' coordinates (mesh.nods)
 
-// Naive way: no ACA. For parallel assembly uncomment line 237
+// Naive way: no ACA. For parallel assembly, see for_each_el_pair
 
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
         IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
         IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
         IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
@@ -220,7 +732,6 @@ namespace hfp3d {
             dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
         }
 
-        const il::int_t num_ele = mesh.conn.size(1);
         const il::int_t num_dof = dof_hndl.n_dof;
         //const il::int_t num_dof = 18 * num_ele;
         const il::int_t ndpe = dof_hndl.dof_h.size(1);
@@ -233,149 +744,25 @@ namespace hfp3d {
         //il::StaticArray2D<double, num_dof, num_dof> global_matrix;
         //il::StaticArray<double, num_dof> right_hand_side;
 
-        // Loop over "source" elements
-//#pragma omp parallel for
-        for (il::int_t source_elem = 0;
-             source_elem < num_ele; ++source_elem) {
-            // Vertices' coordinates
-            il::StaticArray2D<double, 3, 3> el_vert_s;
-            //il::StaticArray<double, 3> vert_wts_s;
-            for (il::int_t j = 0; j < 3; ++j) {
-                il::int_t n = mesh.conn(j, source_elem);
-                for (il::int_t k = 0; k < 3; ++k) {
-                    el_vert_s(k, j) = mesh.nods(k, n);
-                }
-                // set vert_wts_s[j]
-            }
-
-            // Basis (shape) functions and rotation tensor of the el-t
-            il::StaticArray2D<double, 3, 3> r_tensor_s;
-            il::StaticArray2D<std::complex<double>, 6, 6> sfm =
-                    make_el_sfm_uniform(el_vert_s, il::io, r_tensor_s);
-            //il::StaticArray2D<std::complex<double>, 6, 6> sfm =
-            // make_el_sfm_nonuniform(r_tensor, el_vert, vert_wts_s);
-
-            // Complex-valued positions of "source" element nodes
-            il::StaticArray<std::complex<double>, 3> tau =
-                    make_el_tau_crd(el_vert_s, r_tensor_s);
-
-            // Loop over "Target" elements
-            for (il::int_t target_elem = 0;
-                 target_elem < num_ele; ++target_elem) {
-                // Vertices' coordinates
-                il::StaticArray2D<double, 3, 3> el_vert_t;
-                //il::StaticArray<double, 3> vert_wts_t;
-                for (il::int_t j = 0; j < 3; ++j) {
-                    il::int_t n = mesh.conn(j, target_elem);
-                    for (il::int_t k = 0; k < 3; ++k) {
-                        el_vert_t(k, j) = mesh.nods(k, n);
-                    }
-                    // set vert_wts_t[j]
-                }
-
-                // Rotation tensor for the target element
-                il::StaticArray2D<double, 3, 3> r_tensor_t =
-                        make_el_r_tensor(el_vert_t);
-
-                // Normal vector at collocation point (x)
-                il::StaticArray<double, 3> nrm_cp_glob;
-                for (int j = 0; j < 3; ++j) {
-                    nrm_cp_glob[j] = -r_tensor_t(2, j);
-                }
-
-                // Collocation points' coordinates
-                il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd =
-                        el_cp_uniform(el_vert_t, n_par.beta);
-                //il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd =
-                // el_cp_nonuniform(el_vert_t,vert_wts_t,beta);
-
-                il::StaticArray2D<double, 18, 18> trac_infl_el2el;
-                // Loop over nodes of the "target" element
-                for (int n_t = 0; n_t < 6; ++n_t) {
-                    // Shifting to the n_t-th collocation pt
-                    HZ hz = make_el_pt_hz
-                            (el_vert_s, el_cp_crd[n_t], r_tensor_s);
-
-                    // Calculating DD-to stress influence
-                    // w.r. to the source element's local coordinate system
-                    il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc_h =
-                            make_local_3dbem_submatrix
-                                    (1, mu, nu, hz.h, hz.z, tau, sfm);
-                    //stress_infl_el2p_loc_t = make_local_3dbem_submatrix
-                    // (0, mu, nu, hz.h, hz.z, tau, sfm);
-
-                    // Multiplication by nrm_cp_glob
-
-                    // Alternative 1: rotating stress at coll. pt.
-                    // to the reference ("global") coordinate system
-                    //stress_infl_el2p_glob = hfp3d::rotate_sim
-                    // (s_ele_s.r_tensor, stress_infl_el2p_loc_h);
-                    //trac_cp_glob = hfp3d::nv_dot_sim(nrm_cp_glob, SIM_CP_G);
-
-                    // Alternative 2: rotating nrm_cp_glob to
-                    // the source element's local coordinate system
-                    il::StaticArray<double, 3> nrm_cp_loc =
-                            il::dot(r_tensor_s, nrm_cp_glob);
-                    il::StaticArray2D<double, 3, 18> trac_el2p_loc =
-                            nv_dot_sim(nrm_cp_loc, stress_infl_el2p_loc_h);
-                    il::StaticArray2D<double, 3, 18> trac_cp_glob =
-                            il::dot(r_tensor_s, il::Blas::transpose,
-                                    trac_el2p_loc);
-
-                    // Alternative 3: calculating traction
-                    // in terms of local coordinates at CP
-                    //trac_cp_x_loc = il::dot
-                    // (r_tensor_t, il::Blas::transpose, trac_cp_glob);
-
-                    // Re-relating DD-to traction influence to DD
-                    // w.r. to the reference coordinate system
-                    il::StaticArray2D<double, 3, 3> trac_infl_n2p,
-                            trac_infl_n2p_glob;
-                    for (int n_s = 0; n_s < 6; ++n_s) {
-                        // taking a block (one node of the "source" element)
-                        for (int j = 0; j < 3; ++j) {
-                            for (int k = 0; k < 3; ++k) {
-                                trac_infl_n2p(k, j) =
-                                        trac_cp_glob(k, 3 * n_s + j);
-                            }
-                        }
-
-                        // Coordinate rotation (for the unknown)
-                        trac_infl_n2p_glob =
-                                il::dot(trac_infl_n2p, r_tensor_s);
-
-                        // Adding the block to the element-to-element
-                        // influence sub-matrix
-                        for (int j = 0; j < 3; ++j) {
-                            for (int k = 0; k < 3; ++k) {
-                                trac_infl_el2el(3 * n_t + k, 3 * n_s + j) =
-                                        trac_infl_n2p_glob(k, j);
-                            }
-                        }
-                    }
-                }
-
-                // Adding the element-to-element influence sub-matrix
-                // to the global influence matrix
-                //IL_EXPECT_FAST
-                // (ndpe * (target_elem + 1) <= global_matrix.size(0));
-                //IL_EXPECT_FAST
-                // (ndpe * (source_elem + 1) <= global_matrix.size(1));
-                for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
-                    il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
-                    for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
-                        il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
-                        if (j0 >= 0 && j1 >= 0) {
-                            global_matrix(j0, j1) +=
-                                    trac_infl_el2el(i0, i1);
-                        }
-                    }
-                }
-            }
-        }
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        // (DD w.r. to the reference coordinate system)
+        for_each_el_pair
+                (mesh, n_par, il::Array<il::int_t>{}, false,
+                 [](il::int_t) { return true; },
+                 [](il::int_t, const Element_Struct_T &) {},
+                 [](il::int_t, il::int_t) { return true; },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &, const Element_Struct_T &,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     add_el2el_block(dof_hndl, s_el, t_el, blk,
+                                     il::io, global_matrix);
+                 },
+                 il::io, el_cache);
         return global_matrix;
     }
-
     // Stress at given points (m_pts_crd) vs DD at nodal points (mesh.nods)
     il::Array2D<double> make_3dbem_stress_f_s
             (double mu, double nu,
@@ -401,6 +788,14 @@ namespace hfp3d {
 
         il::Array2D<double> stress_infl_matrix(6 * num_of_m_pts, num_dof);
 
+        const Elast_Const_T e_c{mu, nu};
+        // monitoring points w.r. to the source element
+        // and their influence sub-matrices
+        il::Array<double> m_pts_h{num_of_m_pts};
+        il::Array<std::complex<double>> m_pts_z{num_of_m_pts};
+        il::Array<il::StaticArray2D<double, 6, 18>>
+                stress_infl_el2p_loc_h{num_of_m_pts};
+
         // Loop over elements
 //#pragma omp parallel for
         for (il::int_t source_elem = 0; source_elem < num_ele; ++source_elem) {
@@ -427,35 +822,39 @@ namespace hfp3d {
             il::StaticArray<std::complex<double>, 3> tau =
                     make_el_tau_crd(el_vert_s, r_tensor_s);
 
-            // Loop over monitoring points
+            // Shifting to the monitoring points
             for (il::int_t m_pt = 0; m_pt < num_of_m_pts; ++m_pt) {
                 // Monitoring points' coordinates
                 il::StaticArray<double, 3> m_p_crd;
                 for (il::int_t j = 0; j < 3; ++j) {
                     m_p_crd[j] = m_pts_crd(j, m_pt);
                 }
-
-                // Shifting to the monitoring point
                 HZ hz = make_el_pt_hz(el_vert_s, m_p_crd, r_tensor_s);
+                m_pts_h[m_pt] = hz.h;
+                m_pts_z[m_pt] = hz.z;
+            }
 
-                // Calculating DD-to stress influence
-                // w.r. to the source element's local coordinate system
-                il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc_h =
-                        make_local_3dbem_submatrix
-                                (1, mu, nu, hz.h, hz.z, tau, sfm);
-                //il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc_t =
-                // make_local_3dbem_submatrix
-                // (0, mu, nu, hz.h, hz.z, tau, sfm);
+            // Calculating DD-to stress influence at all points
+            // w.r. to the source element's local coordinate system
+            make_local_3dbem_submatrix_v
+                    (1, e_c, num_of_m_pts, m_pts_h.data(), m_pts_z.data(),
+                     tau, sfm, il::io, stress_infl_el2p_loc_h.data());
+            //make_local_3dbem_submatrix_v
+            // (0, e_c, num_of_m_pts, m_pts_h.data(), m_pts_z.data(),
+            // tau, sfm, il::io, stress_infl_el2p_loc_t.data());
 
+            // Loop over monitoring points
+            for (il::int_t m_pt = 0; m_pt < num_of_m_pts; ++m_pt) {
                 // Rotating stress at m_pt
                 // to the reference ("global") coordinate system
                 il::StaticArray2D<double, 6, 18> stress_infl_el2p_glob =
-                        rotate_sim(r_tensor_s, stress_infl_el2p_loc_h);
+                        rotate_sim(r_tensor_s, stress_infl_el2p_loc_h[m_pt]);
 
                 if (!n_par.is_dd_local) {
                     // Re-relating DD-to stress influence to DD
                     // w.r. to the reference coordinate system
-                    il::StaticArray2D<double, 3, 3> stress_infl_n2p,
+                    // (6 stress components vs 3 DD of a node)
+                    il::StaticArray2D<double, 6, 3> stress_infl_n2p,
                             stress_infl_n2p_glob;
                     for (int n_s = 0; n_s < 6; ++n_s) {
                         // taking a block (one node of the "source" element)
@@ -515,6 +914,109 @@ namespace hfp3d {
         // return stress_array;
     }
 
+    // Stress at given points for DD of m_data
+    il::Array2D<double> get_3dbem_stress_s
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Mesh_Data_T &m_data,
+             const il::Array2D<double> &m_pts_crd) {
+        IL_EXPECT_FAST(m_data.dd.size(0) == 6 * mesh.conn.size(1));
+        il::Array2D<double> s_m = make_3dbem_stress_f_s
+                (mu, nu, mesh, n_par, m_pts_crd);
+        return get_3dbem_stress_s(s_m, m_data);
+    }
+
+    // (same, with a stored stress matrix)
+    il::Array2D<double> get_3dbem_stress_s
+            (const il::Array2D<double> &stress_infl_matrix,
+             const Mesh_Data_T &m_data) {
+        const il::Array2D<double> &s_m = stress_infl_matrix;
+        const il::int_t n_nod = m_data.dd.size(0);
+        const il::int_t n_pts = s_m.size(0) / 6;
+        IL_EXPECT_FAST(m_data.dd.size(1) == 3);
+        IL_EXPECT_FAST(s_m.size(1) == 3 * n_nod);
+        // (columns of s_m: 3 * node + DD component)
+        il::Array2D<double> stress{6, n_pts, 0.0};
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            for (int j = 0; j < 3; ++j) {
+                const double dd = m_data.dd(n, j);
+                if (dd == 0.0) {
+                    continue;
+                }
+                for (il::int_t p = 0; p < n_pts; ++p) {
+                    for (int k = 0; k < 6; ++k) {
+                        stress(k, p) += s_m(6 * p + k, 3 * n + j) * dd;
+                    }
+                }
+            }
+        }
+        return stress;
+    }
+
+    // Influence of DD on the volume & of pressure on tractions
+    il::StaticArray2D<double, 2, 18> make_el_vc_submatrix
+            (const Element_Struct_T &src_el,
+             bool is_dd_local) {
+        // This function calculates the contribution of the element
+        // to the additional row (volume vs nodal DD, row 0)
+        // and column (traction at CP vs pressure, row 1)
+        // of the Volume Control matrix
+        il::StaticArray2D<double, 2, 18> vc_infl{0.0};
+        il::StaticArray<double, 6> el_sf_integral =
+                el_p2_sf_integral(src_el.sf_m, src_el.tau);
+        for (int n_s = 0; n_s < 6; ++n_s) {
+            // Integral of n_s-th shape function over the s-element
+            double sf_integral = el_sf_integral[n_s];
+            il::StaticArray<double, 3> sf_i_v {0.0};
+            // Integral of normal DD (opening) over the element
+            // for the n_s-th shape function
+            if (!is_dd_local) {
+                // dot([0, 0, sf_integral], r_tensor_s)
+                for (int j = 0; j < 3; ++j) {
+                    sf_i_v[j] = sf_integral * src_el.r_tensor(2, j);
+                }
+            } else {
+                // [0, 0, sf_integral]
+                sf_i_v[2] = sf_integral;
+            }
+            for (int j = 0; j < 3; ++j) {
+                int l = n_s * 3 + j;
+                // Volume vs DD
+                vc_infl(0, l) = sf_i_v[j];
+                // Tractions vs pressure
+                vc_infl(1, l) = -src_el.r_tensor(2, j); // Normal at element
+            }
+        }
+        return vc_infl;
+    }
+
+    // Element's entries of the additional row & column
+    // of the Volume Control matrix (last row & column of global_matrix;
+    // the volume is multiplied by vol_factor)
+    void set_el_vc_entries
+            (const DoF_Handle_T &dof_hndl,
+             il::int_t source_elem,
+             const Element_Struct_T &src_el,
+             bool is_dd_local,
+             double vol_factor,
+             il::io_t, il::Array2D<double> &global_matrix) {
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        // Influence of DD & pressure on tractions & volume
+        il::StaticArray2D<double, 2, 18> vc_infl =
+                make_el_vc_submatrix(src_el, is_dd_local);
+        for (il::int_t l = 0; l < ndpe; ++l) {
+            il::int_t s_dof = dof_hndl.dof_h(source_elem, l);
+            if (s_dof >= 0) {
+                // Volume vs DD
+                global_matrix(num_dof, s_dof) = vol_factor * vc_infl(0, l);
+                // Tractions vs pressure
+                global_matrix(s_dof, num_dof) = vc_infl(1, l);
+            }
+        }
+    }
+
     // Volume Control matrix assembly (additional row $ column)
     il::Array2D<double> make_3dbem_matrix_vc
             (double mu, double nu,
@@ -525,8 +1027,10 @@ namespace hfp3d {
 // from boundary mesh geometry data:
 // mesh connectivity (mesh.conn) and nodes' coordinates (mesh.nods)
 
-// Naive way: no ACA. For parallel assembly, uncomment line 412
+// Naive way: no ACA. For parallel assembly, see for_each_el_pair
 
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
         IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
         IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
         IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
@@ -536,7 +1040,6 @@ namespace hfp3d {
             dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
         }
 
-        const il::int_t num_ele = mesh.conn.size(1);
         const il::int_t num_dof = dof_hndl.n_dof;
         const il::int_t ndpe = dof_hndl.dof_h.size(1);
         IL_EXPECT_FAST(ndpe == 18);
@@ -547,187 +1050,539 @@ namespace hfp3d {
         //alg_sys.matrix = il::Array2D<double>{num_dof+1, num_dof+1, 0.0};
         //alg_sys.rhside = il::Array<double>{num_dof+1, 0.0};
 
-        // Loop over "source" elements
-//#pragma omp parallel for
-        for (il::int_t source_elem = 0;
-             source_elem < num_ele; ++source_elem) {
-            // Vertices' coordinates
-            il::StaticArray2D<double, 3, 3> el_vert_s;
-            //il::StaticArray<double, 3> vert_wts_s;
-            for (il::int_t j = 0; j < 3; ++j) {
-                il::int_t n = mesh.conn(j, source_elem);
-                for (il::int_t k = 0; k < 3; ++k) {
-                    el_vert_s(k, j) = mesh.nods(k, n);
-                }
-                // set vert_wts_s[j]
-            }
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        for_each_el_pair
+                (mesh, n_par, il::Array<il::int_t>{}, n_par.is_dd_local,
+                 [](il::int_t) { return true; },
+                 [&](il::int_t s_el, const Element_Struct_T &src_el) {
+                     set_el_vc_entries(dof_hndl, s_el, src_el,
+                                       n_par.is_dd_local, 1.0,
+                                       il::io, global_matrix);
+                 },
+                 [](il::int_t, il::int_t) { return true; },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &, const Element_Struct_T &,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     add_el2el_block(dof_hndl, s_el, t_el, blk,
+                                     il::io, global_matrix);
+                 },
+                 il::io, el_cache);
+        // global_matrix(num_dof, num_dof) = compressibility * volume
+        return global_matrix;
+    }
 
-            // Basis (shape) functions and rotation tensor of the el-t
-            il::StaticArray2D<double, 3, 3> r_tensor_s;
-            il::StaticArray2D<std::complex<double>, 6, 6> sfm = 
-                    make_el_sfm_uniform(el_vert_s, il::io, r_tensor_s);
-            //il::StaticArray2D<std::complex<double>, 6, 6> sfm = 
-            // make_el_sfm_nonuniform(r_tensor, el_vert, vert_wts_s);
+    void make_3dbem_matrix_vc_parts
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl,
+             il::Array2D<double> &a,
+             il::Array2D<double> &vc) {
+// This function assembles the same entries as make_3dbem_matrix_vc
+// in a (num_dof * num_dof) & vc (2 * num_dof)
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(1) >= 3); // at least 3 nodes
 
-            // Complex-valued positions of "source" element nodes
-            il::StaticArray<std::complex<double>, 3> tau = 
-                    make_el_tau_crd(el_vert_s, r_tensor_s);
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        }
 
-            // Loop over "Target" elements
-            for (il::int_t target_elem = 0; 
-                 target_elem < num_ele; ++target_elem) {
-                // Vertices' coordinates
-                il::StaticArray2D<double, 3, 3> el_vert_t;
-                //il::StaticArray<double, 3> vert_wts_t;
-                for (il::int_t j = 0; j < 3; ++j) {
-                    il::int_t n = mesh.conn(j, target_elem);
-                    for (il::int_t k = 0; k < 3; ++k) {
-                        el_vert_t(k, j) = mesh.nods(k, n);
-                    }
-                    // set vert_wts_t[j]
-                }
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
 
-                // Rotation tensor for the target element
-                il::StaticArray2D<double, 3, 3> r_tensor_t = 
-                        make_el_r_tensor(el_vert_t);
+        a = il::Array2D<double>{num_dof, num_dof, 0.0};
+        vc = il::Array2D<double>{2, num_dof, 0.0};
+
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        for_each_el_pair
+                (mesh, n_par, il::Array<il::int_t>{}, n_par.is_dd_local,
+                 [](il::int_t) { return true; },
+                 [&](il::int_t s_el, const Element_Struct_T &src_el) {
+                     // Influence of DD & pressure on tractions & volume
+                     il::StaticArray2D<double, 2, 18> vc_infl =
+                             make_el_vc_submatrix(src_el, n_par.is_dd_local);
+                     for (il::int_t l = 0; l < ndpe; ++l) {
+                         il::int_t s_dof = dof_hndl.dof_h(s_el, l);
+                         if (s_dof >= 0) {
+                             vc(0, s_dof) = vc_infl(0, l);
+                             vc(1, s_dof) = vc_infl(1, l);
+                         }
+                     }
+                 },
+                 [](il::int_t, il::int_t) { return true; },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &, const Element_Struct_T &,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     add_el2el_block(dof_hndl, s_el, t_el, blk, il::io, a);
+                 },
+                 il::io, el_cache);
+    }
 
-                // Normal vector at collocation point (x)
-                il::StaticArray<double, 3> nrm_cp_glob;
-                for (int j = 0; j < 3; ++j) {
-                    nrm_cp_glob[j] = -r_tensor_t(2, j);
-                }
+    // Volume Control matrix assembly for "active" elements only
+    il::Array2D<double> make_3dbem_matrix_vc_act
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &ae_set,
+             const DoF_Handle_T &dof_hndl) {
+// This function performs Volume Control BEM matrix assembly
+// directly into the truncated system: only the elements listed in ae_set
+// (e.g. m_data.ae_set) are visited, and only the rows & columns
+// of DoF listed in dof_hndl (e.g. m_data.dof_h_dd) are computed
+        DoF_Handle_T prev_dof_hndl{};
+        il::Array2D<double> prev_matrix{};
+        return extend_3dbem_matrix_vc_act
+                (mu, nu, mesh, n_par, ae_set,
+                 prev_matrix, prev_dof_hndl, dof_hndl);
+    }
 
-                // Collocation points' coordinates
-                il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd = 
-                        el_cp_uniform(el_vert_t, n_par.beta);
-                //il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd = 
-                // el_cp_nonuniform(el_vert_t,vert_wts_t,beta);
-
-                il::StaticArray2D<double, 18, 18> trac_infl_el2el;
-                // Loop over nodes of the "target" element
-                for (int n_t = 0; n_t < 6; ++n_t) {
-                    // Shifting to the n_t-th collocation pt
-                    HZ hz = make_el_pt_hz
-                            (el_vert_s, el_cp_crd[n_t], r_tensor_s);
-
-                    // Calculating DD-to stress influence
-                    // w.r. to the source element's local coordinate system
-                    il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc_h =
-                            make_local_3dbem_submatrix
-                                    (1, mu, nu, hz.h, hz.z, tau, sfm);
-                    //stress_infl_el2p_loc_t = make_local_3dbem_submatrix
-                    // (0, mu, nu, hz.h, hz.z, tau, sfm);
-
-                    // Multiplication by normal at CP
-
-                    // Alternative 1: rotating stress at coll. pt.
-                    // to the reference ("global") coordinate system
-                    //stress_infl_el2p_glob = hfp3d::rotate_sim
-                    // (r_tensor_s, stress_infl_el2p_loc_h);
-                    //trac_cp_glob = hfp3d::nv_dot_sim(nrm_cp_glob, SIM_CP_G);
-
-                    // Alternative 2: rotating nrm_cp_glob to
-                    // the source element's local coordinate system
-                    il::StaticArray<double, 3> nrm_cp_loc = 
-                            il::dot(r_tensor_s, nrm_cp_glob);
-                    il::StaticArray2D<double, 3, 18> trac_el2p_loc =
-                            nv_dot_sim(nrm_cp_loc, stress_infl_el2p_loc_h);
-                    il::StaticArray2D<double, 3, 18> trac_cp_glob = il::dot
-                            (r_tensor_s, il::Blas::transpose, trac_el2p_loc);
-
-                    // Alternative 3: traction vector
-                    // in terms of local coordinates at CP
-                    //trac_cp_x_loc = il::dot
-                    // (r_tensor_t, il::Blas::transpose, trac_cp_glob);
-
-                    if (!n_par.is_dd_local) {
-                        // Re-relating DD-to traction influence to DD
-                        // w.r. to the reference coordinate system
-                        il::StaticArray2D<double, 3, 3> trac_infl_n2p,
-                                trac_infl_n2p_glob;
-                        for (int n_s = 0; n_s < 6; ++n_s) {
-                            // taking a block (one node of the "source" element)
-                            for (int j = 0; j < 3; ++j) {
-                                for (int k = 0; k < 3; ++k) {
-                                    trac_infl_n2p(k, j) =
-                                            trac_cp_glob(k, 3 * n_s + j);
-                                }
-                            }
+    // Extension of the "active" Volume Control matrix
+    il::Array2D<double> extend_3dbem_matrix_vc_act
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &ae_set,
+             const il::Array2D<double> &prev_matrix,
+             const DoF_Handle_T &prev_dof_hndl,
+             const DoF_Handle_T &dof_hndl) {
+// This function re-assembles the Volume Control matrix
+// of the "active" elements (ae_set) after the set of active DoF
+// has grown from prev_dof_hndl to dof_hndl;
+// element-to-element blocks are only computed for the pairs
+// involving an element whose active DoF have changed,
+// all other entries are copied from prev_matrix;
+// an empty prev_dof_hndl means assembly from scratch
+
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
 
-                            // Coordinate rotation (for the unknown)
-                            trac_infl_n2p_glob = il::dot(trac_infl_n2p,
-                                                         r_tensor_s);
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t num_ae = ae_set.size();
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+
+        const bool is_ext = prev_dof_hndl.dof_h.size(0) > 0;
+        const il::int_t prev_num_dof = prev_dof_hndl.n_dof;
+        if (is_ext) {
+            IL_EXPECT_FAST(prev_dof_hndl.dof_h.size(0) == num_ele);
+            IL_EXPECT_FAST(prev_dof_hndl.dof_h.size(1) == ndpe);
+            IL_EXPECT_FAST(prev_matrix.size(0) == prev_num_dof + 1);
+            IL_EXPECT_FAST(prev_matrix.size(1) == prev_num_dof + 1);
+        }
 
-                            // Adding the block to the element-to-element
-                            // influence sub-matrix
-                            for (int j = 0; j < 3; ++j) {
-                                for (int k = 0; k < 3; ++k) {
-                                    trac_infl_el2el(3 * n_t + k, 3 * n_s + j) =
-                                            trac_infl_n2p_glob(k, j);
-                                }
-                            }
-                        }
-                    } else {
-                        for (int dof_s = 0; dof_s < ndpe; ++dof_s) {
-                            for (int n_t = 0; n_t < 6; ++n_t) {
-                                for (int k = 0; k < 3; ++k)
-                                trac_infl_el2el(3 * n_t + k, dof_s) =
-                                        trac_cp_glob(k, dof_s);
-                            }
-                        }
+        // elements whose set of active DoF has changed
+        il::Array<bool> is_upd{num_ele, !is_ext};
+        if (is_ext) {
+            for (il::int_t k = 0; k < num_ae; ++k) {
+                il::int_t el = ae_set[k];
+                for (il::int_t l = 0; l < ndpe; ++l) {
+                    if ((dof_hndl.dof_h(el, l) >= 0) !=
+                        (prev_dof_hndl.dof_h(el, l) >= 0)) {
+                        is_upd[el] = true;
                     }
                 }
+            }
+        }
 
-                // Adding the element-to-element influence sub-matrix
-                // to the global influence matrix
-                //IL_EXPECT_FAST
-                // (ndpe * (target_elem + 1) <= global_matrix.size(0));
-                //IL_EXPECT_FAST
-                // (ndpe * (source_elem + 1) <= global_matrix.size(1));
+        il::Array2D<double> global_matrix {num_dof + 1, num_dof + 1, 0.0};
+
+        // copying the blocks of the pairs of unchanged elements
+        // from the previous matrix
+        for (il::int_t s_k = 0; s_k < num_ae && is_ext; ++s_k) {
+            il::int_t source_elem = ae_set[s_k];
+            IL_EXPECT_FAST(source_elem >= 0 && source_elem < num_ele);
+            if (is_upd[source_elem]) {
+                continue;
+            }
+            for (il::int_t t_k = 0; t_k < num_ae; ++t_k) {
+                il::int_t target_elem = ae_set[t_k];
+                if (is_upd[target_elem]) {
+                    continue;
+                }
                 for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
                     il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                    il::int_t o_j1 = prev_dof_hndl.dof_h(source_elem, i1);
                     for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
                         il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                        il::int_t o_j0 = prev_dof_hndl.dof_h(target_elem, i0);
                         if (j0 >= 0 && j1 >= 0) {
-                            global_matrix(j0, j1) +=
-                                    trac_infl_el2el(i0, i1);
+                            global_matrix(j0, j1) += prev_matrix(o_j0, o_j1);
                         }
                     }
                 }
             }
+        }
 
-            // Influence of DD & pressure on tractions & volume
-            il::StaticArray<double, 6> el_sf_integral =
-                    el_p2_sf_integral(sfm, tau);
-            for (int n_s = 0; n_s < 6; ++n_s) {
-                // Integral of n_s-th shape function over the s-element
-                double sf_integral = el_sf_integral[n_s];
-                il::StaticArray<double, 3> sf_i_v {0.0};
-                // Integral of normal DD (opening) over the element
-                // for the n_s-th shape function
-                if (!n_par.is_dd_local) {
-                    // dot([0, 0, sf_integral], r_tensor_s)
-                    for (int j = 0; j < 3; ++j) {
-                        sf_i_v[j] = sf_integral * r_tensor_s(2, j);
-                    }
-                } else {
-                    // [0, 0, sf_integral]
-                    sf_i_v[2] = sf_integral;
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        // the pairs involving an updated element
+        // (adding their sub-matrices to the truncated influence matrix)
+        for_each_el_pair
+                (mesh, n_par, ae_set, n_par.is_dd_local,
+                 [](il::int_t) { return true; },
+                 [&](il::int_t s_el, const Element_Struct_T &src_el) {
+                     set_el_vc_entries(dof_hndl, s_el, src_el,
+                                       n_par.is_dd_local, 1.0,
+                                       il::io, global_matrix);
+                 },
+                 [&](il::int_t s_el, il::int_t t_el) {
+                     return is_upd[s_el] || is_upd[t_el];
+                 },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &, const Element_Struct_T &,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     add_el2el_block(dof_hndl, s_el, t_el, blk,
+                                     il::io, global_matrix);
+                 },
+                 il::io, el_cache);
+        return global_matrix;
+    }
+
+    // Column panel of the Volume Control matrix
+    il::Array2D<double> make_3dbem_matrix_vc_panel
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::int_t col0,
+             il::int_t n_cols) {
+// This function assembles the columns col0 ... col0 + n_cols - 1
+// of the Volume Control matrix (as make_3dbem_matrix_vc does);
+// only the "source" elements having DoF in this range are visited,
+// so that the whole matrix never has to be kept in memory
+
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+        IL_EXPECT_FAST(col0 >= 0 && n_cols >= 0);
+        IL_EXPECT_FAST(col0 + n_cols <= num_dof + 1);
+        const il::int_t col1 = col0 + n_cols;
+        const bool is_p_col = col1 == num_dof + 1;
+
+        il::Array2D<double> panel {num_dof + 1, n_cols, 0.0};
+
+        // "source" elements having DoF in this range
+        il::Array<bool> is_in_panel{num_ele, false};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t s_dof = dof_hndl.dof_h(el, l);
+                if (s_dof >= col0 && s_dof < col1) {
+                    is_in_panel[el] = true;
                 }
-                for (int j = 0; j < 3; ++j) {
-                    int l = n_s * 3 + j;
-                    il::int_t s_dof = dof_hndl.dof_h(source_elem, l);
-                    if (s_dof >= 0) {
-                        // Volume vs DD
-                        global_matrix(num_dof, s_dof) = sf_i_v[j];
-                        // Tractions vs pressure
-                        global_matrix(s_dof, num_dof) =
-                                -r_tensor_s(2, j); // Normal at element
+            }
+        }
+
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        for_each_el_pair
+                (mesh, n_par, il::Array<il::int_t>{}, n_par.is_dd_local,
+                 [&](il::int_t s_el) {
+                     return is_in_panel[s_el] || is_p_col;
+                 },
+                 [&](il::int_t s_el, const Element_Struct_T &src_el) {
+                     // Influence of DD & pressure on tractions & volume
+                     il::StaticArray2D<double, 2, 18> vc_infl =
+                             make_el_vc_submatrix(src_el, n_par.is_dd_local);
+                     for (il::int_t l = 0; l < ndpe; ++l) {
+                         il::int_t s_dof = dof_hndl.dof_h(s_el, l);
+                         if (s_dof < 0) {
+                             continue;
+                         }
+                         if (s_dof >= col0 && s_dof < col1) {
+                             // Volume vs DD
+                             panel(num_dof, s_dof - col0) = vc_infl(0, l);
+                         }
+                         if (is_p_col) {
+                             // Tractions vs pressure
+                             panel(s_dof, num_dof - col0) = vc_infl(1, l);
+                         }
+                     }
+                 },
+                 [&](il::int_t s_el, il::int_t) {
+                     return is_in_panel[s_el];
+                 },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &, const Element_Struct_T &,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                         il::int_t j1 = dof_hndl.dof_h(s_el, i1);
+                         if (j1 < col0 || j1 >= col1) {
+                             continue;
+                         }
+                         for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                             il::int_t j0 = dof_hndl.dof_h(t_el, i0);
+                             if (j0 >= 0) {
+                                 panel(j0, j1 - col0) += blk(i0, i1);
+                             }
+                         }
+                     }
+                 },
+                 il::io, el_cache);
+        return panel;
+    }
+
+    // Row block of the Volume Control matrix
+    il::Array2D<double> make_3dbem_matrix_vc_rows
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::int_t row0,
+             il::int_t n_rows) {
+// This function assembles the rows row0 ... row0 + n_rows - 1
+// of the Volume Control matrix (as make_3dbem_matrix_vc does);
+// only the "target" elements having DoF in this range are visited
+
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+        IL_EXPECT_FAST(row0 >= 0 && n_rows >= 0);
+        IL_EXPECT_FAST(row0 + n_rows <= num_dof + 1);
+        const il::int_t row1 = row0 + n_rows;
+        const bool is_v_row = row1 == num_dof + 1;
+
+        il::Array2D<double> row_block {n_rows, num_dof + 1, 0.0};
+
+        // "target" elements having DoF in the range
+        il::Array<bool> is_in_block{num_ele, false};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t t_dof = dof_hndl.dof_h(el, l);
+                if (t_dof >= row0 && t_dof < row1) {
+                    is_in_block[el] = true;
+                }
+            }
+        }
+
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        for_each_el_pair
+                (mesh, n_par, il::Array<il::int_t>{}, n_par.is_dd_local,
+                 [](il::int_t) { return true; },
+                 [&](il::int_t s_el, const Element_Struct_T &src_el) {
+                     // Influence of DD & pressure on tractions & volume
+                     il::StaticArray2D<double, 2, 18> vc_infl =
+                             make_el_vc_submatrix(src_el, n_par.is_dd_local);
+                     for (il::int_t l = 0; l < ndpe; ++l) {
+                         il::int_t s_dof = dof_hndl.dof_h(s_el, l);
+                         if (s_dof < 0) {
+                             continue;
+                         }
+                         if (is_v_row) {
+                             // Volume vs DD
+                             row_block(num_dof - row0, s_dof) = vc_infl(0, l);
+                         }
+                         if (s_dof >= row0 && s_dof < row1) {
+                             // Tractions vs pressure
+                             row_block(s_dof - row0, num_dof) = vc_infl(1, l);
+                         }
+                     }
+                 },
+                 [&](il::int_t, il::int_t t_el) {
+                     return is_in_block[t_el];
+                 },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &, const Element_Struct_T &,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                         il::int_t j1 = dof_hndl.dof_h(s_el, i1);
+                         if (j1 < 0) {
+                             continue;
+                         }
+                         for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                             il::int_t j0 = dof_hndl.dof_h(t_el, i0);
+                             if (j0 >= row0 && j0 < row1) {
+                                 row_block(j0 - row0, j1) += blk(i0, i1);
+                             }
+                         }
+                     }
+                 },
+                 il::io, el_cache);
+        return row_block;
+    }
+
+    // Image (mirrored) elements of the element el_s
+    il::Array<Element_Struct_T> make_el_images
+            (const Element_Struct_T &el_s,
+             const Mesh_Sym_T &sym,
+             double beta,
+             il::io_t, il::Array<il::StaticArray<double, 3>> &refl) {
+        // This function generates the images of el_s w.r. to
+        // all combinations of the symmetry planes (1, 3, or 7 images);
+        // refl[k] is the diagonal of the reflection tensor of k-th image;
+        // for an odd number of reflections, the 2nd and 3rd vertices
+        // are swapped to keep the image's normal equal to
+        // the reflected normal of el_s, so that the nodes
+        // {0, 1, 2, 3, 4, 5} of the image correspond to
+        // the nodes {0, 2, 1, 3, 5, 4} of el_s
+        il::Array<Element_Struct_T> images{};
+        refl = il::Array<il::StaticArray<double, 3>>{};
+        for (int mask = 1; mask < 8; ++mask) {
+            bool is_valid = true;
+            il::StaticArray<double, 3> m_diag{1.0};
+            for (int k = 0; k < 3; ++k) {
+                if (mask & (1 << k)) {
+                    is_valid = is_valid && sym.is_mirror[k];
+                    m_diag[k] = -1.0;
+                }
+            }
+            if (!is_valid) continue;
+            bool is_odd = m_diag[0] * m_diag[1] * m_diag[2] < 0.0;
+            il::StaticArray2D<double, 3, 3> img_vert;
+            for (int j = 0; j < 3; ++j) {
+                int v = is_odd ? (3 - j) % 3 : j;
+                for (int k = 0; k < 3; ++k) {
+                    img_vert(k, j) = m_diag[k] * el_s.vert(k, v) +
+                            (1.0 - m_diag[k]) * sym.mirror_crd[k];
+                }
+            }
+            images.append(set_ele_struct(img_vert, beta));
+            refl.append(m_diag);
+        }
+        return images;
+    }
+
+    // Folding the influence of an image element (DD w.r. to
+    // the reference coordinate system) into the one of its original
+    void fold_el_image_block
+            (const il::StaticArray2D<double, 18, 18> &trac_infl_img,
+             const Element_Struct_T &src_el,
+             const il::StaticArray<double, 3> &m_diag,
+             bool is_dd_local,
+             il::io_t, il::StaticArray2D<double, 18, 18> &trac_infl_el2el) {
+        bool is_odd = m_diag[0] * m_diag[1] * m_diag[2] < 0.0;
+        // image DD (reference coordinates) vs
+        // source DD: M or M.R_s^T (for local DD)
+        il::StaticArray2D<double, 3, 3> dd_tr{0.0};
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                dd_tr(i, j) = is_dd_local ?
+                              m_diag[i] * src_el.r_tensor(j, i) :
+                              (i == j ? m_diag[i] : 0.0);
+            }
+        }
+        for (int n_i = 0; n_i < 6; ++n_i) {
+            // matching node of the source element
+            int n_s = (is_odd && n_i % 3 != 0) ?
+                      n_i + (n_i % 3 == 1 ? 1 : -1) : n_i;
+            for (int j = 0; j < 3; ++j) {
+                for (int i = 0; i < 3; ++i) {
+                    double t_ij = dd_tr(i, j);
+                    if (t_ij == 0.0) continue;
+                    for (int l = 0; l < 18; ++l) {
+                        trac_infl_el2el(l, 3 * n_s + j) +=
+                                trac_infl_img(l, 3 * n_i + i) * t_ij;
                     }
                 }
             }
         }
-        // global_matrix(num_dof, num_dof) = compressibility * volume
+    }
+
+    // Volume Control matrix assembly for a symmetric problem
+    il::Array2D<double> make_3dbem_matrix_vc_sym
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Mesh_Sym_T &sym,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function performs Volume Control BEM matrix assembly
+// for the "reduced" mesh (one side of the symmetry plane(s));
+// the influence of the image elements (with DD mirrored
+// from the ones of their originals) is added to the columns
+// of the original elements, and the volume is multiplied
+// by the number of the mesh copies
+
+        // (double precision storage, see make_3dbem_matrix_vc_bsr)
+        IL_EXPECT_FAST(!n_par.is_ff_float);
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(1) >= 3); // at least 3 nodes
+        // no element in (or across) a symmetry plane
+        IL_EXPECT_FAST(is_mesh_sym_valid(mesh, sym));
+
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        }
+
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+
+        il::Array2D<double> global_matrix {num_dof + 1, num_dof + 1, 0.0};
+
+        // reuse of the influence for congruent & similar adjacent
+        // element pairs
+        El2El_Cache el_cache{mu, nu, mesh, n_par};
+
+        // image elements of the current "source" element
+        // & their reflection tensors
+        il::Array<il::StaticArray<double, 3>> refl;
+        il::Array<Element_Struct_T> img_el;
+
+        for_each_el_pair
+                (mesh, n_par, il::Array<il::int_t>{}, n_par.is_dd_local,
+                 [](il::int_t) { return true; },
+                 [&](il::int_t s_el, const Element_Struct_T &src_el) {
+                     img_el = make_el_images
+                             (src_el, sym, n_par.beta, il::io, refl);
+                     // (the volume of the whole fracture,
+                     // i.e. of n_img+1 copies)
+                     set_el_vc_entries(dof_hndl, s_el, src_el,
+                                       n_par.is_dd_local, img_el.size() + 1.0,
+                                       il::io, global_matrix);
+                 },
+                 [](il::int_t, il::int_t) { return true; },
+                 [&](il::int_t s_el, il::int_t t_el,
+                     const Element_Struct_T &src_el,
+                     const Element_Struct_T &trg_el,
+                     il::StaticArray2D<double, 18, 18> &blk) {
+                     // Folding the influence of the images
+                     for (il::int_t k = 0; k < img_el.size(); ++k) {
+                         fold_el_image_block
+                                 (el_cache.el2el(img_el[k], trg_el, false),
+                                  src_el, refl[k], n_par.is_dd_local,
+                                  il::io, blk);
+                     }
+                     add_el2el_block(dof_hndl, s_el, t_el, blk,
+                                     il::io, global_matrix);
+                 },
+                 il::io, el_cache);
         return global_matrix;
     }
 
@@ -747,7 +1602,7 @@ namespace hfp3d {
         const il::int_t full_ndof = num_of_ele * ndpe;
         const il::int_t orig_ndof = orig_dof_hndl.n_dof;
         IL_EXPECT_FAST(orig_ndof > 0 && orig_ndof <= full_ndof);
-        IL_EXPECT_FAST(orig_ndof == orig_matrix.size(0));
+        IL_EXPECT_FAST(orig_ndof + 1 == orig_matrix.size(0));
         const il::int_t used_ndof = dof_hndl.n_dof;
         // check if the used matrix is smaller that the original matrix
         IL_EXPECT_FAST(used_ndof > 0 && used_ndof <= orig_ndof);
@@ -781,10 +1636,10 @@ namespace hfp3d {
                     }
                     // Volume vs DD
                     alg_system.matrix(used_ndof, s_dof) +=
-                            orig_matrix(full_ndof, o_s_dof);
+                            orig_matrix(orig_ndof, o_s_dof);
                     // Traction vs pressure
                     alg_system.matrix(s_dof, used_ndof) +=
-                            orig_matrix(o_s_dof, full_ndof);
+                            orig_matrix(o_s_dof, orig_ndof);
                     // RHS (sought traction delta)
                     if (tsize == full_ndof) {
                         il::int_t f_s_dof = s_ele * ndpe + j;
@@ -18,7 +18,10 @@
 #include <il/Array2D.h>
 #include <il/StaticArray.h>
 #include <il/StaticArray2D.h>
+#include <il/StaticArray3D.h>
 #include "mesh_utilities.h"
+#include "element_utilities.h"
+#include "h_potential.h"
 
 namespace hfp3d {
 
@@ -31,13 +34,107 @@ namespace hfp3d {
 
 /////// Elastostatics utilities ///////
 
+    // Element-to-point influences (as make_local_3dbem_infl_nod)
+    // for n_pt points (h[p], z[p]) at once; the constituing functions
+    // of the integrals are evaluated for all points in one batch
+    void make_local_3dbem_infl_nod_v
+            (const int kernel_id,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             int c_mask,
+             il::io_t,
+             il::StaticArray3D<std::complex<double>, 6, 4, 3> *s_ij_infl_nod);
+
+    // Element-to-point influence: combined stress components
+    // [(S11+S22)/2; (S11-S22)/2+i*S12; (S13+i*S23)/2; S33] in c_mask
+    // vs DD at the element nodes (not scaled)
+    il::StaticArray3D<std::complex<double>, 6, 4, 3>
+    make_local_3dbem_infl_nod
+            (const int kernel_id,
+             const Elast_Const_T &e_c, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             int c_mask);
+
     // Element-to-point influence matrix (submatrix of the global one)
+    il::StaticArray2D<double, 6, 18> make_local_3dbem_submatrix
+            (const int kernel_id,
+             const Elast_Const_T &e_c, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm);
+
+    // (same for n_pt points at once)
+    void make_local_3dbem_submatrix_v
+            (const int kernel_id,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             il::io_t, il::StaticArray2D<double, 6, 18> *stress_el_2_el_infl);
+
+    // (same, the constants are calculated from mu & nu on each call)
     il::StaticArray2D<double, 6, 18> make_local_3dbem_submatrix
             (const int kernel_id,
              double mu, double nu, double h, std::complex<double> z,
              const il::StaticArray<std::complex<double>, 3> &tau,
              const il::StaticArray2D<std::complex<double>, 6, 6> &sfm);
 
+    // Element-to-point traction influence matrix (3*18) at a point
+    // with the normal nrm_loc, w.r. to the element's local coordinates
+    // (only the stress components needed for the traction are calculated)
+    il::StaticArray2D<double, 3, 18> make_local_3dbem_trac_submatrix
+            (const int kernel_id,
+             const Elast_Const_T &e_c, double h, std::complex<double> z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             const il::StaticArray<double, 3> &nrm_loc);
+
+    // (same for n_pt points at once)
+    void make_local_3dbem_trac_submatrix_v
+            (const int kernel_id,
+             const Elast_Const_T &e_c, il::int_t n_pt,
+             const double *h, const std::complex<double> *z,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             const il::StaticArray<double, 3> &nrm_loc,
+             il::io_t, il::StaticArray2D<double, 3, 18> *trac_el_2_el_infl);
+
+    // Element properties (vertices, CP, SF, etc.) for element el of mesh
+    Element_Struct_T get_mesh_el_struct
+            (const Mesh_Geom_T &mesh,
+             il::int_t el,
+             double beta);
+
+    // Element-to-point traction influence matrix (3*18)
+    // from the stress one w.r. to the source element's local coordinates
+    il::StaticArray2D<double, 3, 18> make_el2p_trac_submatrix
+            (const il::StaticArray2D<double, 6, 18> &stress_infl_el2p_loc,
+             const il::StaticArray2D<double, 3, 3> &src_r_tensor,
+             const il::StaticArray<double, 3> &nrm_cp_glob,
+             bool is_dd_local);
+
+    // (same, from the traction influence matrix
+    // w.r. to the source element's local coordinates)
+    il::StaticArray2D<double, 3, 18> rotate_el2p_trac_submatrix
+            (const il::StaticArray2D<double, 3, 18> &trac_el2p_loc,
+             const il::StaticArray2D<double, 3, 3> &src_r_tensor,
+             bool is_dd_local);
+
+    // Element-to-element influence matrix (18*18 block of the global one)
+    il::StaticArray2D<double, 18, 18> make_el2el_3dbem_submatrix
+            (const Elast_Const_T &e_c,
+             const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local);
+
+    il::StaticArray2D<double, 18, 18> make_el2el_3dbem_submatrix
+            (double mu, double nu,
+             const Element_Struct_T &src_el,
+             const Element_Struct_T &trg_el,
+             bool is_dd_local);
+
     // Static matrix assembly
     il::Array2D<double> make_3dbem_matrix_s
             (double mu, double nu,
@@ -53,8 +150,29 @@ namespace hfp3d {
              //const Mesh_Data_T &m_data,
              const il::Array2D<double> &m_pts_crd);
 
+    // Stress at given points (m_pts_crd) for DD of m_data
+    // (6 components * number of points)
+    il::Array2D<double> get_3dbem_stress_s
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Mesh_Data_T &m_data,
+             const il::Array2D<double> &m_pts_crd);
+
+    // (same, with the matrix of make_3dbem_stress_f_s built beforehand,
+    // e.g. kept for a fixed set of points)
+    il::Array2D<double> get_3dbem_stress_s
+            (const il::Array2D<double> &stress_infl_matrix,
+             const Mesh_Data_T &m_data);
+
 /////// Volume Control scheme utilities ///////
 
+    // Element's contribution to the additional row & column
+    // (volume vs DD; traction vs pressure)
+    il::StaticArray2D<double, 2, 18> make_el_vc_submatrix
+            (const Element_Struct_T &src_el,
+             bool is_dd_local);
+
     // Volume Control matrix assembly (additional row $ column)
     il::Array2D<double> make_3dbem_matrix_vc
             (double mu, double nu,
@@ -62,6 +180,77 @@ namespace hfp3d {
              const Num_Param_T &n_par,
              il::io_t, DoF_Handle_T &dof_hndl);
 
+    // The same in parts (without the copy of the whole matrix):
+    // the elastic block a (traction vs DD) and the additional row & column,
+    // vc(0, k) = volume vs DD, vc(1, k) = traction vs pressure
+    void make_3dbem_matrix_vc_parts
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl,
+             il::Array2D<double> &a,
+             il::Array2D<double> &vc);
+
+    // Volume Control matrix assembly restricted to "active" elements
+    // (rows & columns of the DoF listed in dof_hndl only)
+    il::Array2D<double> make_3dbem_matrix_vc_act
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &ae_set,
+             const DoF_Handle_T &dof_hndl);
+
+    // Extension of the "active" Volume Control matrix
+    // after more elements (DoF) have been activated
+    il::Array2D<double> extend_3dbem_matrix_vc_act
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array<il::int_t> &ae_set,
+             const il::Array2D<double> &prev_matrix,
+             const DoF_Handle_T &prev_dof_hndl,
+             const DoF_Handle_T &dof_hndl);
+
+    // Column panel of the Volume Control matrix
+    // (columns col0 ... col0 + n_cols - 1; column dof_hndl.n_dof
+    // is the one of pressure)
+    il::Array2D<double> make_3dbem_matrix_vc_panel
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::int_t col0,
+             il::int_t n_cols);
+
+    // Row block of the Volume Control matrix
+    // (rows row0 ... row0 + n_rows - 1; row dof_hndl.n_dof
+    // is the one of volume)
+    il::Array2D<double> make_3dbem_matrix_vc_rows
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::int_t row0,
+             il::int_t n_rows);
+
+    // Image (mirrored) elements of the element el_s
+    // for the symmetry planes defined by sym
+    il::Array<Element_Struct_T> make_el_images
+            (const Element_Struct_T &el_s,
+             const Mesh_Sym_T &sym,
+             double beta,
+             il::io_t, il::Array<il::StaticArray<double, 3>> &refl);
+
+    // Volume Control matrix assembly for a symmetric problem
+    // (mesh represents 1/2, 1/4, or 1/8 of the fracture surface
+    // and has to pass is_mesh_sym_valid)
+    il::Array2D<double> make_3dbem_matrix_vc_sym
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Mesh_Sym_T &sym,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
     // Volume Control system modification (for DD increments)
     SAE_T mod_3dbem_system_vc
             (const il::Array2D<double> &orig_matrix,
@@ -0,0 +1,234 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "task_lu.h"
+#include "dense_la.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    // Assembly & LU decomposition of the Volume Control matrix
+    Panel_LU_T make_3dbem_lu_vc_tasks
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::int_t p_width,
+             il::io_t, il::Status &status) {
+// This function creates, for each panel k, the tasks
+// assemble(k) -> update(0, k) -> ... -> update(k - 1, k) -> factor(k);
+// update(j, k) also waits for factor(j), and factor(k) for factor(k - 1)
+// (via update(k - 1, k)), so that the pivots are chosen in the same order
+// as in the left-looking (sequential) algorithm of ooc_lu;
+// the tasks of different panels run concurrently;
+// update(j, k) is a triangular solve for the pivot rows of panel j
+// and a matrix product (la_gemm) for the rows not yet pivoted
+        IL_EXPECT_FAST(p_width >= 1);
+        const il::int_t n = dof_hndl.n_dof + 1;
+        const il::int_t n_p = (n + p_width - 1) / p_width;
+
+        Panel_LU_T lu;
+        lu.n = n;
+        lu.p_width = p_width;
+        lu.panel = il::Array<il::Array2D<double>>{n_p};
+        lu.piv = il::Array<il::int_t>{n, -1};
+        // ord[r] == n means row r has not been a pivot yet;
+        // the factorization of a panel sets the entries of its pivots
+        // while the updates of the next panels read them: an update by
+        // panel j only checks ord[r] >= (last column of j) + 1, which
+        // holds for both the old value (n) and the new one
+        std::vector<std::atomic<il::int_t>> ord(n);
+        for (il::int_t r = 0; r < n; ++r) {
+            ord[r].store(n, std::memory_order_relaxed);
+        }
+        std::atomic<bool> is_singular{false};
+        // the updates (tasks) run concurrently, the backend sequentially
+        const Dense_LA_T la{};
+
+        // (the panels are also the dependency objects of the tasks)
+        il::Array2D<double> *panel = lu.panel.data();
+
+#pragma omp parallel
+#pragma omp single
+        for (il::int_t k = 0; k < n_p; ++k) {
+            const il::int_t c0 = k * p_width;
+            const il::int_t w = (n - c0 < p_width) ? n - c0 : p_width;
+
+            // assembly of the panel
+#pragma omp task default(shared) firstprivate(k, c0, w) depend(out: panel[k])
+            {
+                panel[k] = make_3dbem_matrix_vc_panel
+                        (mu, nu, mesh, n_par, dof_hndl, c0, w);
+            }
+
+            // update by the previous panels
+            for (il::int_t j = 0; j < k; ++j) {
+#pragma omp task default(shared) firstprivate(k, j, w) \
+depend(in: panel[j]) depend(inout: panel[k])
+                {
+                    if (!is_singular) {
+                        il::Array2D<double> &a_k = panel[k];
+                        const il::Array2D<double> &a_j = panel[j];
+                        const il::int_t d0 = j * p_width;
+                        const il::int_t w_j = a_j.size(1);
+                        // block of U: the pivot rows of panel j
+                        // with L_jj^(-1) applied (unit lower triangular)
+                        il::Array2D<double> u_jk{w_j, w};
+                        for (il::int_t c = 0; c < w; ++c) {
+                            for (il::int_t lt = 0; lt < w_j; ++lt) {
+                                const il::int_t p = lu.piv[d0 + lt];
+                                double u_tc = a_k(p, c);
+                                for (il::int_t l = 0; l < lt; ++l) {
+                                    u_tc -= a_j(p, l) * u_jk(l, c);
+                                }
+                                u_jk(lt, c) = u_tc;
+                                a_k(p, c) = u_tc;
+                            }
+                        }
+                        // rows not chosen as pivots up to panel j
+                        std::vector<il::int_t> rows;
+                        for (il::int_t r = 0; r < n; ++r) {
+                            if (ord[r].load(std::memory_order_relaxed) >=
+                                d0 + w_j) {
+                                rows.push_back(r);
+                            }
+                        }
+                        const il::int_t n_r = rows.size();
+                        if (n_r > 0) {
+                            // a_k(rows, :) -= a_j(rows, :) . u_jk
+                            il::Array2D<double> l_rj{n_r, w_j};
+                            il::Array2D<double> a_rk{n_r, w};
+                            for (il::int_t lt = 0; lt < w_j; ++lt) {
+                                for (il::int_t i = 0; i < n_r; ++i) {
+                                    l_rj(i, lt) = a_j(rows[i], lt);
+                                }
+                            }
+                            for (il::int_t c = 0; c < w; ++c) {
+                                for (il::int_t i = 0; i < n_r; ++i) {
+                                    a_rk(i, c) = a_k(rows[i], c);
+                                }
+                            }
+                            la_gemm(la, -1.0, l_rj, false, u_jk, false,
+                                    1.0, il::io, a_rk);
+                            for (il::int_t c = 0; c < w; ++c) {
+                                for (il::int_t i = 0; i < n_r; ++i) {
+                                    a_k(rows[i], c) = a_rk(i, c);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // factorization of the panel
+#pragma omp task default(shared) firstprivate(k, c0, w) depend(inout: panel[k])
+            {
+                il::Array2D<double> &a_k = panel[k];
+                for (il::int_t lt = 0; lt < w && !is_singular; ++lt) {
+                    const il::int_t t = c0 + lt;
+                    il::int_t p = -1;
+                    double a_max = 0.0;
+                    for (il::int_t r = 0; r < n; ++r) {
+                        if (ord[r].load(std::memory_order_relaxed) == n &&
+                            std::fabs(a_k(r, lt)) > a_max) {
+                            a_max = std::fabs(a_k(r, lt));
+                            p = r;
+                        }
+                    }
+                    if (p < 0) {
+                        is_singular = true;
+                        break;
+                    }
+                    lu.piv[t] = p;
+                    ord[p].store(t, std::memory_order_relaxed);
+                    const double a_pp = a_k(p, lt);
+                    for (il::int_t r = 0; r < n; ++r) {
+                        if (ord[r].load(std::memory_order_relaxed) == n) {
+                            a_k(r, lt) /= a_pp;
+                        }
+                    }
+                    for (il::int_t c = lt + 1; c < w; ++c) {
+                        const double u_tc = a_k(p, c);
+                        if (u_tc == 0.0) continue;
+                        for (il::int_t r = 0; r < n; ++r) {
+                            if (ord[r].load(std::memory_order_relaxed) == n) {
+                                a_k(r, c) -= a_k(r, lt) * u_tc;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        lu.ord = il::Array<il::int_t>{n};
+        for (il::int_t r = 0; r < n; ++r) {
+            lu.ord[r] = ord[r].load(std::memory_order_relaxed);
+        }
+        if (is_singular) {
+            status.set_error(il::Error::MatrixSingular);
+            IL_SET_SOURCE(status);
+            return lu;
+        }
+        status.set_ok();
+        return lu;
+    }
+
+    // Solution of the system with LU-decomposed matrix
+    il::Array<double> panel_lu_solve
+            (const Panel_LU_T &lu,
+             const il::Array<double> &rhs) {
+        const il::int_t n = lu.n;
+        const il::int_t n_p = lu.panel.size();
+        IL_EXPECT_FAST(rhs.size() == n);
+
+        // forward substitution (L)
+        il::Array<double> z = rhs;
+        il::Array<double> y{n, 0.0};
+        for (il::int_t k = 0; k < n_p; ++k) {
+            const il::Array2D<double> &a_k = lu.panel[k];
+            const il::int_t c0 = k * lu.p_width;
+            for (il::int_t lt = 0; lt < a_k.size(1); ++lt) {
+                const il::int_t t = c0 + lt;
+                const double y_t = z[lu.piv[t]];
+                y[t] = y_t;
+                if (y_t == 0.0) continue;
+                for (il::int_t r = 0; r < n; ++r) {
+                    if (lu.ord[r] > t) {
+                        z[r] -= a_k(r, lt) * y_t;
+                    }
+                }
+            }
+        }
+
+        // backward substitution (U)
+        il::Array<double> x{n, 0.0};
+        for (il::int_t k = n_p - 1; k >= 0; --k) {
+            const il::Array2D<double> &a_k = lu.panel[k];
+            const il::int_t c0 = k * lu.p_width;
+            for (il::int_t lt = a_k.size(1) - 1; lt >= 0; --lt) {
+                const il::int_t t = c0 + lt;
+                const double x_t = y[t] / a_k(lu.piv[t], lt);
+                x[t] = x_t;
+                if (x_t == 0.0) continue;
+                for (il::int_t r = 0; r < n; ++r) {
+                    if (lu.ord[r] < t) {
+                        y[lu.ord[r]] -= a_k(r, lt) * x_t;
+                    }
+                }
+            }
+        }
+        return x;
+    }
+
+}
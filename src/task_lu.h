@@ -0,0 +1,56 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Pipelined assembly & LU decomposition of the Volume Control matrix
+// stored in (in-memory) column panels: assembly, update & factorization
+// of the panels are OpenMP tasks linked by data dependencies, so that
+// the factorization of the first panels overlaps with the assembly
+// of the next ones (sequential if compiled without OpenMP)
+
+#ifndef INC_HFPX3D_TASK_LU_H
+#define INC_HFPX3D_TASK_LU_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // LU-decomposed matrix in column panels
+    struct Panel_LU_T {
+        // matrix size & (max.) number of columns in a panel
+        il::int_t n = 0;
+        il::int_t p_width = 1;
+        // L & U factors (rows are not interchanged, see ooc_lu)
+        il::Array<il::Array2D<double>> panel{};
+        // piv[t]: row chosen as the pivot for column t
+        il::Array<il::int_t> piv{};
+        // ord[p]: column for which row p has been the pivot
+        il::Array<il::int_t> ord{};
+    };
+
+    // Assembly & LU decomposition of the Volume Control matrix
+    // (dof_hndl has to be set, e.g. by make_dof_h_crack)
+    Panel_LU_T make_3dbem_lu_vc_tasks
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::int_t p_width,
+             il::io_t, il::Status &status);
+
+    // Solution of the system with LU-decomposed matrix
+    il::Array<double> panel_lu_solve
+            (const Panel_LU_T &lu,
+             const il::Array<double> &rhs);
+
+}
+
+#endif //INC_HFPX3D_TASK_LU_H
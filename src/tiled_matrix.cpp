@@ -0,0 +1,452 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cerrno>
+#include <cmath>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "tiled_matrix.h"
+#include "dense_la.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    Tiled_Matrix::Tiled_Matrix
+            (const std::string &f_name,
+             il::int_t n_row, il::int_t n_col,
+             il::int_t p_width,
+             il::io_t, il::Status &status) {
+        IL_EXPECT_FAST(n_row >= 1 && n_col >= 1 && p_width >= 1);
+        f_name_ = f_name;
+        n_row_ = n_row;
+        n_col_ = n_col;
+        p_width_ = p_width;
+        fd_ = open(f_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0 ||
+            ftruncate(fd_, static_cast<off_t>(sizeof(double) * n_row * n_col))
+            != 0) {
+            status.set_error(il::Error::FilesystemNoWriteAccess);
+            IL_SET_SOURCE(status);
+            return;
+        }
+        status.set_ok();
+    }
+
+    Tiled_Matrix::~Tiled_Matrix() {
+        if (fd_ >= 0) {
+            close(fd_);
+            unlink(f_name_.c_str());
+        }
+    }
+
+    // Reading (is_write == false) or writing of n_bytes at the position
+    // pos of the file fd: continued after partial transfers and retried
+    // if interrupted by a signal; false on an I/O error (e.g. a full disk)
+    // or at the end of the file
+    bool transfer_bytes
+            (int fd, bool is_write,
+             char *buf, std::size_t n_bytes, off_t pos) {
+        while (n_bytes > 0) {
+            ssize_t n_t = is_write ? pwrite(fd, buf, n_bytes, pos) :
+                          pread(fd, buf, n_bytes, pos);
+            if (n_t < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n_t <= 0) {
+                return false;
+            }
+            buf += n_t;
+            pos += n_t;
+            n_bytes -= static_cast<std::size_t>(n_t);
+        }
+        return true;
+    }
+
+    void Tiled_Matrix::write_panel
+            (il::int_t k, const il::Array2D<double> &panel,
+             il::io_t, il::Status &status) {
+        IL_EXPECT_FAST(k >= 0 && k < n_panels());
+        IL_EXPECT_FAST(panel.size(0) == n_row_);
+        IL_EXPECT_FAST(panel.size(1) == panel_width(k));
+        // (the buffer is not modified by pwrite)
+        char *buf = const_cast<char *>
+                (reinterpret_cast<const char *>(panel.data()));
+        std::size_t n_bytes = sizeof(double) * n_row_ * panel_width(k);
+        off_t pos = static_cast<off_t>(sizeof(double) * n_row_ * panel_col0(k));
+        if (!transfer_bytes(fd_, true, buf, n_bytes, pos)) {
+            status.set_error(il::Error::FilesystemNoWriteAccess);
+            IL_SET_SOURCE(status);
+            return;
+        }
+        status.set_ok();
+    }
+
+    il::Array2D<double> Tiled_Matrix::read_panel
+            (il::int_t k, il::io_t, il::Status &status) const {
+        IL_EXPECT_FAST(k >= 0 && k < n_panels());
+        il::Array2D<double> panel{n_row_, panel_width(k)};
+        char *buf = reinterpret_cast<char *>(panel.data());
+        std::size_t n_bytes = sizeof(double) * n_row_ * panel_width(k);
+        off_t pos = static_cast<off_t>(sizeof(double) * n_row_ * panel_col0(k));
+        if (!transfer_bytes(fd_, false, buf, n_bytes, pos)) {
+            status.set_error(il::Error::Undefined);
+            IL_SET_SOURCE(status);
+            return il::Array2D<double>{};
+        }
+        status.set_ok();
+        return panel;
+    }
+
+    std::future<il::Array2D<double>> Tiled_Matrix::read_panel_async
+            (il::int_t k) const {
+        return std::async(std::launch::async, [this, k]() {
+            il::Status status{};
+            il::Array2D<double> panel = read_panel(k, il::io, status);
+            if (!status.ok()) {
+                return il::Array2D<double>{};
+            }
+            return panel;
+        });
+    }
+
+    // Panel read by read_panel_async (status set to error
+    // if the reading failed, i.e. the panel is empty)
+    il::Array2D<double> get_panel
+            (std::future<il::Array2D<double>> &panel_f,
+             il::io_t, il::Status &status) {
+        il::Array2D<double> panel = panel_f.get();
+        if (panel.size(1) == 0) {
+            status.set_error(il::Error::Undefined);
+            IL_SET_SOURCE(status);
+            return panel;
+        }
+        status.set_ok();
+        return panel;
+    }
+
+    // Volume Control matrix assembly directly to disk
+    void make_3dbem_matrix_vc_ooc
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::io_t, Tiled_Matrix &matrix, il::Status &status) {
+        // panels are assembled one by one; writing of a panel
+        // overlaps with the assembly of the next one
+        const il::int_t num_dof = dof_hndl.n_dof;
+        IL_EXPECT_FAST(matrix.size(0) == num_dof + 1);
+        IL_EXPECT_FAST(matrix.size(1) == num_dof + 1);
+        // (true if the panel has been written)
+        std::future<bool> w_done;
+        il::Array2D<double> panel_w{};
+        bool is_written = true;
+        for (il::int_t k = 0; k < matrix.n_panels(); ++k) {
+            il::Array2D<double> panel = make_3dbem_matrix_vc_panel
+                    (mu, nu, mesh, n_par, dof_hndl,
+                     matrix.panel_col0(k), matrix.panel_width(k));
+            if (w_done.valid()) {
+                is_written = w_done.get();
+            }
+            if (!is_written) {
+                break;
+            }
+            panel_w = std::move(panel);
+            w_done = std::async(std::launch::async,
+                                [&matrix, &panel_w, k]() {
+                                    il::Status w_status{};
+                                    matrix.write_panel(k, panel_w,
+                                                       il::io, w_status);
+                                    return w_status.ok();
+                                });
+        }
+        if (w_done.valid()) {
+            is_written = w_done.get();
+        }
+        if (!is_written) {
+            status.set_error(il::Error::FilesystemNoWriteAccess);
+            IL_SET_SOURCE(status);
+            return;
+        }
+        status.set_ok();
+    }
+
+    // Matrix-vector product
+    il::Array<double> ooc_dot
+            (const Tiled_Matrix &matrix,
+             const il::Array<double> &x,
+             il::io_t, il::Status &status) {
+        const il::int_t n_row = matrix.size(0);
+        const il::int_t n_p = matrix.n_panels();
+        IL_EXPECT_FAST(x.size() == matrix.size(1));
+        il::Array<double> y{n_row, 0.0};
+        std::future<il::Array2D<double>> next = matrix.read_panel_async(0);
+        for (il::int_t k = 0; k < n_p; ++k) {
+            il::Array2D<double> panel = get_panel(next, il::io, status);
+            if (!status.ok()) {
+                return y;
+            }
+            if (k + 1 < n_p) {
+                next = matrix.read_panel_async(k + 1);
+            }
+            const il::int_t c0 = matrix.panel_col0(k);
+            for (il::int_t j = 0; j < panel.size(1); ++j) {
+                const double x_j = x[c0 + j];
+                for (il::int_t i = 0; i < n_row; ++i) {
+                    y[i] += panel(i, j) * x_j;
+                }
+            }
+        }
+        status.set_ok();
+        return y;
+    }
+
+    // Left-looking LU decomposition with partial pivoting
+    OOC_LU_T ooc_lu
+            (il::io_t, Tiled_Matrix &matrix, il::Status &status) {
+// This function factorizes the matrix panel by panel:
+// each panel is updated with all the previous (factorized) ones,
+// streamed from disk, and then factorized itself;
+// rows are not interchanged physically: L & U entries stay
+// in the rows of origin, and the pivot order is kept in lu.piv & lu.ord;
+// the update by panel j is a triangular solve for the pivot rows of j
+// and a matrix product (la_gemm) for the rows not yet pivoted (gathered
+// in a contiguous block, as in make_3dbem_lu_vc_tasks); the panel
+// is factorized with its rows not yet pivoted gathered as well
+        const il::int_t n = matrix.size(0);
+        const il::int_t n_p = matrix.n_panels();
+        IL_EXPECT_FAST(matrix.size(1) == n);
+
+        OOC_LU_T lu;
+        lu.piv = il::Array<il::int_t>{n, -1};
+        // ord[r] == n means row r has not been a pivot yet
+        lu.ord = il::Array<il::int_t>{n, n};
+
+        // order of panel reads: k, 0, 1, ..., k-1 for each k
+        std::vector<il::int_t> r_seq;
+        for (il::int_t k = 0; k < n_p; ++k) {
+            r_seq.push_back(k);
+            for (il::int_t j = 0; j < k; ++j) {
+                r_seq.push_back(j);
+            }
+        }
+        std::size_t r_pos = 0;
+        const Dense_LA_T la{};
+        std::future<il::Array2D<double>> next =
+                matrix.read_panel_async(r_seq[0]);
+
+        for (il::int_t k = 0; k < n_p; ++k) {
+            il::Array2D<double> a_k = get_panel(next, il::io, status);
+            if (!status.ok()) {
+                return lu;
+            }
+            ++r_pos;
+            if (r_pos < r_seq.size()) {
+                next = matrix.read_panel_async(r_seq[r_pos]);
+            }
+            const il::int_t c0 = matrix.panel_col0(k);
+            const il::int_t w = matrix.panel_width(k);
+
+            // update by the previous panels
+            for (il::int_t j = 0; j < k; ++j) {
+                il::Array2D<double> a_j = get_panel(next, il::io, status);
+                if (!status.ok()) {
+                    return lu;
+                }
+                ++r_pos;
+                if (r_pos < r_seq.size()) {
+                    next = matrix.read_panel_async(r_seq[r_pos]);
+                }
+                const il::int_t d0 = matrix.panel_col0(j);
+                const il::int_t w_j = a_j.size(1);
+                // block of U: the pivot rows of panel j
+                // with L_jj^(-1) applied (unit lower triangular)
+                il::Array2D<double> u_jk{w_j, w};
+                for (il::int_t c = 0; c < w; ++c) {
+                    for (il::int_t lt = 0; lt < w_j; ++lt) {
+                        const il::int_t p = lu.piv[d0 + lt];
+                        double u_tc = a_k(p, c);
+                        for (il::int_t l = 0; l < lt; ++l) {
+                            u_tc -= a_j(p, l) * u_jk(l, c);
+                        }
+                        u_jk(lt, c) = u_tc;
+                        a_k(p, c) = u_tc;
+                    }
+                }
+                // rows not chosen as pivots up to panel j
+                std::vector<il::int_t> rows;
+                for (il::int_t r = 0; r < n; ++r) {
+                    if (lu.ord[r] >= d0 + w_j) {
+                        rows.push_back(r);
+                    }
+                }
+                const il::int_t n_r = rows.size();
+                if (n_r > 0) {
+                    // a_k(rows, :) -= a_j(rows, :) . u_jk
+                    il::Array2D<double> l_rj{n_r, w_j};
+                    il::Array2D<double> a_rk{n_r, w};
+                    for (il::int_t lt = 0; lt < w_j; ++lt) {
+                        for (il::int_t i = 0; i < n_r; ++i) {
+                            l_rj(i, lt) = a_j(rows[i], lt);
+                        }
+                    }
+                    for (il::int_t c = 0; c < w; ++c) {
+                        for (il::int_t i = 0; i < n_r; ++i) {
+                            a_rk(i, c) = a_k(rows[i], c);
+                        }
+                    }
+                    la_gemm(la, -1.0, l_rj, false, u_jk, false,
+                            1.0, il::io, a_rk);
+                    for (il::int_t c = 0; c < w; ++c) {
+                        for (il::int_t i = 0; i < n_r; ++i) {
+                            a_k(rows[i], c) = a_rk(i, c);
+                        }
+                    }
+                }
+            }
+
+            // factorization of the panel: rows not yet pivoted
+            // (rows[i] for the row i of a_r), interchanged within a_r
+            std::vector<il::int_t> rows;
+            for (il::int_t r = 0; r < n; ++r) {
+                if (lu.ord[r] == n) {
+                    rows.push_back(r);
+                }
+            }
+            const il::int_t n_r = rows.size();
+            il::Array2D<double> a_r{n_r, w};
+            for (il::int_t c = 0; c < w; ++c) {
+                for (il::int_t i = 0; i < n_r; ++i) {
+                    a_r(i, c) = a_k(rows[i], c);
+                }
+            }
+            for (il::int_t lt = 0; lt < w; ++lt) {
+                const il::int_t t = c0 + lt;
+                il::int_t p = -1;
+                double a_max = 0.0;
+                for (il::int_t i = lt; i < n_r; ++i) {
+                    if (std::fabs(a_r(i, lt)) > a_max) {
+                        a_max = std::fabs(a_r(i, lt));
+                        p = i;
+                    }
+                }
+                if (p < 0) {
+                    status.set_error(il::Error::MatrixSingular);
+                    IL_SET_SOURCE(status);
+                    if (next.valid()) {
+                        next.wait();
+                    }
+                    return lu;
+                }
+                if (p != lt) {
+                    for (il::int_t c = 0; c < w; ++c) {
+                        const double a_t = a_r(lt, c);
+                        a_r(lt, c) = a_r(p, c);
+                        a_r(p, c) = a_t;
+                    }
+                    const il::int_t r_t = rows[lt];
+                    rows[lt] = rows[p];
+                    rows[p] = r_t;
+                }
+                lu.piv[t] = rows[lt];
+                lu.ord[rows[lt]] = t;
+                const double a_pp = a_r(lt, lt);
+                for (il::int_t i = lt + 1; i < n_r; ++i) {
+                    a_r(i, lt) /= a_pp;
+                }
+                for (il::int_t c = lt + 1; c < w; ++c) {
+                    const double u_tc = a_r(lt, c);
+                    for (il::int_t i = lt + 1; i < n_r; ++i) {
+                        a_r(i, c) -= a_r(i, lt) * u_tc;
+                    }
+                }
+            }
+            for (il::int_t c = 0; c < w; ++c) {
+                for (il::int_t i = 0; i < n_r; ++i) {
+                    a_k(rows[i], c) = a_r(i, c);
+                }
+            }
+            matrix.write_panel(k, a_k, il::io, status);
+            if (!status.ok()) {
+                if (next.valid()) {
+                    next.wait();
+                }
+                return lu;
+            }
+        }
+        status.set_ok();
+        return lu;
+    }
+
+    // Solution of the system with LU-decomposed matrix
+    il::Array<double> ooc_lu_solve
+            (const Tiled_Matrix &lu_matrix,
+             const OOC_LU_T &lu,
+             const il::Array<double> &rhs,
+             il::io_t, il::Status &status) {
+        const il::int_t n = lu_matrix.size(0);
+        const il::int_t n_p = lu_matrix.n_panels();
+        IL_EXPECT_FAST(rhs.size() == n);
+
+        // forward substitution (L)
+        il::Array<double> z = rhs;
+        il::Array<double> y{n, 0.0};
+        std::future<il::Array2D<double>> next =
+                lu_matrix.read_panel_async(0);
+        for (il::int_t k = 0; k < n_p; ++k) {
+            il::Array2D<double> a_k = get_panel(next, il::io, status);
+            if (!status.ok()) {
+                return z;
+            }
+            // (the last panel is read first for the backward substitution)
+            next = lu_matrix.read_panel_async(k + 1 < n_p ? k + 1 : n_p - 1);
+            const il::int_t c0 = lu_matrix.panel_col0(k);
+            for (il::int_t lt = 0; lt < a_k.size(1); ++lt) {
+                const il::int_t t = c0 + lt;
+                const double y_t = z[lu.piv[t]];
+                y[t] = y_t;
+                if (y_t == 0.0) continue;
+                for (il::int_t r = 0; r < n; ++r) {
+                    if (lu.ord[r] > t) {
+                        z[r] -= a_k(r, lt) * y_t;
+                    }
+                }
+            }
+        }
+
+        // backward substitution (U)
+        il::Array<double> x{n, 0.0};
+        for (il::int_t k = n_p - 1; k >= 0; --k) {
+            il::Array2D<double> a_k = get_panel(next, il::io, status);
+            if (!status.ok()) {
+                return x;
+            }
+            if (k > 0) {
+                next = lu_matrix.read_panel_async(k - 1);
+            }
+            const il::int_t c0 = lu_matrix.panel_col0(k);
+            for (il::int_t lt = a_k.size(1) - 1; lt >= 0; --lt) {
+                const il::int_t t = c0 + lt;
+                const double x_t = y[t] / a_k(lu.piv[t], lt);
+                x[t] = x_t;
+                if (x_t == 0.0) continue;
+                for (il::int_t r = 0; r < n; ++r) {
+                    if (lu.ord[r] < t) {
+                        y[lu.ord[r]] -= a_k(r, lt) * x_t;
+                    }
+                }
+            }
+        }
+        status.set_ok();
+        return x;
+    }
+
+}
@@ -0,0 +1,105 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Out-of-core dense matrix stored on disk in column panels
+// (assembly, LU decomposition & solution, matrix-vector product
+// streaming one panel at a time with asynchronous prefetching)
+
+#ifndef INC_HFPX3D_TILED_MATRIX_H
+#define INC_HFPX3D_TILED_MATRIX_H
+
+#include <future>
+#include <string>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    class Tiled_Matrix {
+    private:
+        std::string f_name_;
+        int fd_;
+        il::int_t n_row_, n_col_;
+        // (max.) number of columns in a panel
+        il::int_t p_width_;
+
+    public:
+        // creates (overwrites) the file f_name for an n_row * n_col matrix;
+        // the file is removed by the destructor
+        Tiled_Matrix
+                (const std::string &f_name,
+                 il::int_t n_row, il::int_t n_col,
+                 il::int_t p_width,
+                 il::io_t, il::Status &status);
+        ~Tiled_Matrix();
+        Tiled_Matrix(const Tiled_Matrix &) = delete;
+        Tiled_Matrix &operator=(const Tiled_Matrix &) = delete;
+
+        il::int_t size(il::int_t d) const { return d == 0 ? n_row_ : n_col_; }
+        il::int_t n_panels() const {
+            return (n_col_ + p_width_ - 1) / p_width_;
+        }
+        // first column & number of columns of the k-th panel
+        il::int_t panel_col0(il::int_t k) const { return k * p_width_; }
+        il::int_t panel_width(il::int_t k) const {
+            il::int_t w = n_col_ - k * p_width_;
+            return w < p_width_ ? w : p_width_;
+        }
+
+        // panel I/O (n_row * panel_width(k), column-major);
+        // status is set to error if the panel cannot be transferred
+        // (e.g. a full disk); read_panel_async gives an empty panel then
+        void write_panel
+                (il::int_t k, const il::Array2D<double> &panel,
+                 il::io_t, il::Status &status);
+        il::Array2D<double> read_panel
+                (il::int_t k, il::io_t, il::Status &status) const;
+        std::future<il::Array2D<double>> read_panel_async(il::int_t k) const;
+    };
+
+    // LU decomposition data (row pivoting)
+    struct OOC_LU_T {
+        // piv[t]: (physical) row chosen as the pivot for column t
+        il::Array<il::int_t> piv{};
+        // ord[p]: column for which row p has been the pivot
+        il::Array<il::int_t> ord{};
+    };
+
+    // Volume Control matrix assembly directly to disk
+    // (dof_hndl has to be set, e.g. by make_dof_h_crack)
+    void make_3dbem_matrix_vc_ooc
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::io_t, Tiled_Matrix &matrix, il::Status &status);
+
+    // Matrix-vector product
+    il::Array<double> ooc_dot
+            (const Tiled_Matrix &matrix,
+             const il::Array<double> &x,
+             il::io_t, il::Status &status);
+
+    // Left-looking LU decomposition with partial pivoting (in place);
+    // status is set to error for a singular matrix or an I/O error
+    OOC_LU_T ooc_lu
+            (il::io_t, Tiled_Matrix &matrix, il::Status &status);
+
+    // Solution of the system with LU-decomposed matrix
+    il::Array<double> ooc_lu_solve
+            (const Tiled_Matrix &lu_matrix,
+             const OOC_LU_T &lu,
+             const il::Array<double> &rhs,
+             il::io_t, il::Status &status);
+
+}
+
+#endif //INC_HFPX3D_TILED_MATRIX_H
@@ -0,0 +1,702 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "tensor_utilities.h"
+#include "time_stepping.h"
+
+namespace hfp3d {
+
+    // fluid volume injected from t0 to t1
+    double injected_volume
+            (const Load_T &load,
+             double t0, double t1) {
+        IL_EXPECT_FAST(t1 >= t0);
+        const il::int_t n_r = load.inj_rate.size();
+        const il::int_t n_t = load.inj_time.size();
+        double vol = 0.0;
+        if (n_t == 0) {
+            // constant rate(s)
+            for (il::int_t k = 0; k < n_r; ++k) {
+                vol += load.inj_rate[k] * (t1 - t0);
+            }
+            return vol;
+        }
+        IL_EXPECT_FAST(n_t == n_r);
+        for (il::int_t k = 0; k < n_t; ++k) {
+            double a = std::max(t0, load.inj_time[k]);
+            double b = (k + 1 < n_t) ? std::min(t1, load.inj_time[k + 1]) : t1;
+            if (b > a) {
+                vol += load.inj_rate[k] * (b - a);
+            }
+        }
+        return vol;
+    }
+
+    // the next change of the injection rate after t (infinity if none)
+    double next_inj_time
+            (const Load_T &load,
+             double t) {
+        double t_next = std::numeric_limits<double>::infinity();
+        for (il::int_t k = 0; k < load.inj_time.size(); ++k) {
+            if (load.inj_time[k] > t) {
+                t_next = std::min(t_next, load.inj_time[k]);
+            }
+        }
+        return t_next;
+    }
+
+    // DoF handle of the open nodes (the DoF of closed ones are fixed)
+    DoF_Handle_T make_dof_h_open
+            (const DoF_Handle_T &orig_dof_h,
+             const il::Array<bool> &is_closed) {
+        const il::int_t n_el = orig_dof_h.dof_h.size(0);
+        const il::int_t ndpe = orig_dof_h.dof_h.size(1);
+        DoF_Handle_T dof_h;
+        dof_h.dof_h = il::Array2D<il::int_t>{n_el, ndpe, -1};
+        il::int_t n_dof = 0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t n = el * (ndpe / 3) + l / 3;
+                if (orig_dof_h.dof_h(el, l) >= 0 && !is_closed[n]) {
+                    dof_h.dof_h(el, l) = n_dof;
+                    ++n_dof;
+                }
+            }
+        }
+        dof_h.n_dof = n_dof;
+        return dof_h;
+    }
+
+    // Far-field traction, i.e. the right-hand side
+    // of the VC system at zero volume
+    il::Array<double> make_vc_far_field_rhs
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::StaticArray<double, 6> &s_inf,
+             const DoF_Handle_T &dof_h) {
+        const il::int_t n_el = dof_h.dof_h.size(0);
+        const il::int_t nnpe = dof_h.dof_h.size(1) / 3;
+        il::Array<double> rhs{dof_h.n_dof + 1, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            Element_Struct_T el_s = get_mesh_el_struct(mesh, el, n_par.beta);
+            // normal vector (as in the traction vs pressure column)
+            il::StaticArray<double, 3> nv_el;
+            for (int j = 0; j < 3; ++j) {
+                nv_el[j] = -el_s.r_tensor(2, j);
+            }
+            il::StaticArray<double, 3> ti_el = nv_dot_sim(nv_el, s_inf);
+            if (n_par.is_dd_local) {
+                ti_el = il::dot(el_s.r_tensor, ti_el);
+            }
+            for (il::int_t lnn = 0; lnn < nnpe; ++lnn) {
+                for (int i = 0; i < 3; ++i) {
+                    il::int_t dof = dof_h.dof_h(el, lnn * 3 + i);
+                    if (dof >= 0) {
+                        rhs[dof] = -ti_el[i];
+                    }
+                }
+            }
+        }
+        return rhs;
+    }
+
+    // LU factorization of the VC system for the set of closed nodes
+    void factorize_vc_system
+            (const il::Array2D<double> &orig_matrix,
+             const DoF_Handle_T &orig_dof_h,
+             const il::Array<double> &rhs_t,
+             const Dense_LA_T &la,
+             il::io_t, VC_Fact_T &fact, il::Status &status) {
+        const il::int_t n_el = orig_dof_h.dof_h.size(0);
+        const il::int_t ndpe = orig_dof_h.dof_h.size(1);
+        const il::int_t orig_ndof = orig_dof_h.n_dof;
+        DoF_Handle_T dof_h = make_dof_h_open(orig_dof_h, fact.is_closed);
+        const il::int_t used_ndof = dof_h.n_dof;
+        if (used_ndof == 0) {
+            // all nodes closed: the volume can not be matched
+            status.set_error(il::Error::MatrixSingular);
+            IL_SET_SOURCE(status);
+            return;
+        }
+        il::Array<double> delta_t{orig_ndof};
+        for (il::int_t i = 0; i < orig_ndof; ++i) {
+            delta_t[i] = rhs_t[i];
+        }
+        SAE_T vc_sys = mod_3dbem_system_vc
+                (orig_matrix, orig_dof_h, dof_h, delta_t, 0.0);
+        fact.lu = std::move(vc_sys.matrix);
+        la_getrf(la, il::io, fact.lu, fact.piv, status);
+        if (!status.ok()) {
+            return;
+        }
+        // far-field traction (column 0) & unit volume (column 1)
+        il::Array2D<double> b{used_ndof + 1, 2, 0.0};
+        for (il::int_t i = 0; i <= used_ndof; ++i) {
+            b(i, 0) = vc_sys.rhs_v[i];
+        }
+        b(used_ndof, 1) = 1.0;
+        la_getrs(la, fact.lu, fact.piv, il::io, b);
+        fact.x_t = il::Array<double>{orig_ndof + 1, 0.0};
+        fact.x_v = il::Array<double>{orig_ndof + 1, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t u_dof = dof_h.dof_h(el, l);
+                if (u_dof >= 0) {
+                    il::int_t o_dof = orig_dof_h.dof_h(el, l);
+                    fact.x_t[o_dof] = b(u_dof, 0);
+                    fact.x_v[o_dof] = b(u_dof, 1);
+                }
+            }
+        }
+        fact.x_t[orig_ndof] = b(used_ndof, 0);
+        fact.x_v[orig_ndof] = b(used_ndof, 1);
+    }
+
+    // Update of the set of closed nodes for the solution x:
+    // open nodes with negative opening are closed; closed nodes
+    // where the contact traction (residual of the dropped equations)
+    // is tensile are opened. Returns the number of changed nodes
+    il::int_t update_closed_nodes
+            (const il::Array2D<double> &orig_matrix,
+             const DoF_Handle_T &orig_dof_h,
+             const il::Array<double> &rhs_t,
+             const il::Array2D<double> &nrm,
+             bool is_dd_local,
+             const il::Array<double> &x,
+             il::io_t, il::Array<bool> &is_closed) {
+        const il::int_t n_el = orig_dof_h.dof_h.size(0);
+        const il::int_t nnpe = orig_dof_h.dof_h.size(1) / 3;
+        const il::int_t orig_ndof = orig_dof_h.n_dof;
+        // tolerances (relative to the max. DD & traction)
+        double dd_max = 0.0;
+        for (il::int_t i = 0; i < orig_ndof; ++i) {
+            dd_max = std::max(dd_max, std::fabs(x[i]));
+        }
+        double t_max = std::fabs(x[orig_ndof]);
+        for (il::int_t i = 0; i < orig_ndof; ++i) {
+            t_max = std::max(t_max, std::fabs(rhs_t[i]));
+        }
+        const double dd_tol = 1.0E-12 * dd_max;
+        const double t_tol = 1.0E-10 * t_max;
+
+        il::int_t n_chg = 0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t lnn = 0; lnn < nnpe; ++lnn) {
+                il::int_t n = el * nnpe + lnn;
+                if (orig_dof_h.dof_h(el, lnn * 3) < 0) {
+                    // fixed (tip) node
+                    continue;
+                }
+                il::StaticArray<double, 3> v{0.0};
+                if (!is_closed[n]) {
+                    // nodal DD
+                    for (int i = 0; i < 3; ++i) {
+                        v[i] = x[orig_dof_h.dof_h(el, lnn * 3 + i)];
+                    }
+                } else {
+                    // contact traction at the node
+                    for (int i = 0; i < 3; ++i) {
+                        il::int_t o = orig_dof_h.dof_h(el, lnn * 3 + i);
+                        double r = -rhs_t[o];
+                        for (il::int_t j = 0; j <= orig_ndof; ++j) {
+                            r += orig_matrix(o, j) * x[j];
+                        }
+                        v[i] = r;
+                    }
+                }
+                // normal component
+                double v_n = v[2];
+                if (!is_dd_local) {
+                    v_n = 0.0;
+                    for (int i = 0; i < 3; ++i) {
+                        v_n += nrm(i, el) * v[i];
+                    }
+                }
+                if (!is_closed[n] && v_n < -dd_tol) {
+                    is_closed[n] = true;
+                    ++n_chg;
+                } else if (is_closed[n] && v_n < -t_tol) {
+                    is_closed[n] = false;
+                    ++n_chg;
+                }
+            }
+        }
+        return n_chg;
+    }
+
+    // Lagrange extrapolation of the solution to time t
+    // from the last (order + 1) states
+    il::Array<double> extrapolate_state
+            (const std::vector<double> &h_t,
+             const std::vector<il::Array<double>> &h_x,
+             int order,
+             double t) {
+        const il::int_t n_h = h_t.size();
+        IL_EXPECT_FAST(n_h >= 1 && h_x.size() == h_t.size());
+        const il::int_t q = std::min(static_cast<il::int_t>(order), n_h - 1);
+        const il::int_t n = h_x[n_h - 1].size();
+        il::Array<double> x_p{n, 0.0};
+        for (il::int_t k = n_h - 1 - q; k < n_h; ++k) {
+            double w = 1.0;
+            for (il::int_t m = n_h - 1 - q; m < n_h; ++m) {
+                if (m != k) {
+                    w *= (t - h_t[m]) / (h_t[k] - h_t[m]);
+                }
+            }
+            for (il::int_t i = 0; i < n; ++i) {
+                x_p[i] += w * h_x[k][i];
+            }
+        }
+        return x_p;
+    }
+
+    // writing the solution to mesh data
+    void write_vc_state
+            (const il::Array<double> &x,
+             const DoF_Handle_T &orig_dof_h,
+             const il::Array<bool> &is_closed,
+             double t,
+             il::io_t, Mesh_Data_T &m_data) {
+        const il::int_t orig_ndof = orig_dof_h.n_dof;
+        il::Array<double> x_dd{orig_ndof};
+        for (il::int_t i = 0; i < orig_ndof; ++i) {
+            x_dd[i] = x[i];
+        }
+        write_dd_vector_to_md(x_dd, orig_dof_h, false, orig_dof_h,
+                              il::io, m_data);
+        for (il::int_t n = 0; n < m_data.pp.size(); ++n) {
+            m_data.pp[n] = x[orig_ndof];
+        }
+        m_data.time = t;
+        m_data.dof_h_dd = make_dof_h_open(orig_dof_h, is_closed);
+        m_data.ae_set = get_act_el_set(m_data.dof_h_dd);
+    }
+
+    // opening at the nodes (node-wise, zero at fixed nodes)
+    // by the weights & indices of VC_Stepper_T
+    void get_nodal_opening
+            (const il::Array<double> &x,
+             const il::Array<il::int_t> &op_ind,
+             const il::Array<double> &op_wt,
+             il::io_t, il::Array<double> &opening) {
+        const il::int_t n_nod = opening.size();
+        IL_EXPECT_FAST(op_ind.size() == 3 * n_nod);
+        IL_EXPECT_FAST(op_wt.size() == 3 * n_nod);
+        const double *x_d = x.data();
+        const il::int_t *i_0 = op_ind.data();
+        const il::int_t *i_1 = i_0 + n_nod;
+        const il::int_t *i_2 = i_1 + n_nod;
+        const double *w_0 = op_wt.data();
+        const double *w_1 = w_0 + n_nod;
+        const double *w_2 = w_1 + n_nod;
+        double *w = opening.data();
+#pragma omp simd
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            w[n] = w_0[n] * x_d[i_0[n]] + w_1[n] * x_d[i_1[n]] +
+                   w_2[n] * x_d[i_2[n]];
+        }
+    }
+
+    // far-field solution (x_t) of a stored factorization
+    // for new far-field traction
+    void solve_vc_far_field
+            (const DoF_Handle_T &orig_dof_h,
+             const il::Array<double> &rhs_t,
+             const Dense_LA_T &la,
+             il::io_t, VC_Fact_T &fact) {
+        const il::int_t n_el = orig_dof_h.dof_h.size(0);
+        const il::int_t ndpe = orig_dof_h.dof_h.size(1);
+        const il::int_t orig_ndof = orig_dof_h.n_dof;
+        DoF_Handle_T dof_h = make_dof_h_open(orig_dof_h, fact.is_closed);
+        const il::int_t used_ndof = dof_h.n_dof;
+        il::Array<double> b{used_ndof + 1, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t u_dof = dof_h.dof_h(el, l);
+                if (u_dof >= 0) {
+                    b[u_dof] = rhs_t[orig_dof_h.dof_h(el, l)];
+                }
+            }
+        }
+        il::Array<double> x_u = la_getrs(la, fact.lu, fact.piv, b);
+        fact.x_t = il::Array<double>{orig_ndof + 1, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                il::int_t u_dof = dof_h.dof_h(el, l);
+                if (u_dof >= 0) {
+                    fact.x_t[orig_dof_h.dof_h(el, l)] = x_u[u_dof];
+                }
+            }
+        }
+        fact.x_t[orig_ndof] = x_u[used_ndof];
+    }
+
+    // Assembly of the VC system (for zero stress at infinity)
+    VC_Stepper_T make_vc_stepper
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par) {
+        const il::int_t n_el = mesh.conn.size(1);
+        VC_Stepper_T vc_st;
+        // all DoF but the ones fixed at the tip
+        vc_st.orig_dof_h = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        vc_st.orig_matrix = make_3dbem_matrix_vc
+                (mu, nu, mesh, n_par, il::io, vc_st.orig_dof_h);
+        vc_st.rhs_t = make_vc_far_field_rhs
+                (mesh, n_par, vc_st.s_inf, vc_st.orig_dof_h);
+        vc_st.nrm = il::Array2D<double>{3, n_el};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            Element_Struct_T el_s = get_mesh_el_struct(mesh, el, n_par.beta);
+            for (int j = 0; j < 3; ++j) {
+                vc_st.nrm(j, el) = el_s.r_tensor(2, j);
+            }
+        }
+        // normal opening: DD component 2 (local DD) or the projection
+        // on the normal (global DD); index 0 & zero weight if fixed
+        const il::int_t n_nod = 6 * n_el;
+        vc_st.op_ind = il::Array<il::int_t>{3 * n_nod, 0};
+        vc_st.op_wt = il::Array<double>{3 * n_nod, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (il::int_t lnn = 0; lnn < 6; ++lnn) {
+                il::int_t n = el * 6 + lnn;
+                if (vc_st.orig_dof_h.dof_h(el, lnn * 3) < 0) {
+                    continue;
+                }
+                for (int i = 0; i < 3; ++i) {
+                    vc_st.op_ind[i * n_nod + n] =
+                            vc_st.orig_dof_h.dof_h(el, lnn * 3 + i);
+                    vc_st.op_wt[i * n_nod + n] = n_par.is_dd_local ?
+                            (i == 2 ? 1.0 : 0.0) : vc_st.nrm(i, el);
+                }
+            }
+        }
+        vc_st.is_closed = il::Array<bool>{n_nod, false};
+        return vc_st;
+    }
+
+    // Adaptive time stepping with the stored system
+    void vc_advance
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Time_Step_Param_T &ts_par,
+             il::io_t,
+             VC_Stepper_T &vc_st,
+             Mesh_Data_T &m_data,
+             Leak_Off_T &leak_off,
+             Time_Step_Stat_T &ts_stat,
+             il::Status &status) {
+        IL_EXPECT_FAST(ts_par.dt_min > 0.0);
+        IL_EXPECT_FAST(ts_par.dt_ini >= ts_par.dt_min);
+        IL_EXPECT_FAST(ts_par.dt_max >= ts_par.dt_ini);
+        IL_EXPECT_FAST(ts_par.n_iter_max >= 1 && ts_par.n_iter_target >= 1);
+        IL_EXPECT_FAST(ts_par.dt_shrink > 0.0 && ts_par.dt_shrink < 1.0);
+        IL_EXPECT_FAST(ts_par.dt_grow_max >= 1.0);
+        IL_EXPECT_FAST(ts_par.pred_order >= 0 && ts_par.pred_order <= 2);
+        IL_EXPECT_FAST(ts_par.n_fact_max >= 1);
+
+        const il::int_t n_el = mesh.conn.size(1);
+        const il::int_t n_nod = 6 * n_el;
+        IL_EXPECT_FAST(vc_st.orig_dof_h.dof_h.size(0) == n_el);
+        const DoF_Handle_T &orig_dof_h = vc_st.orig_dof_h;
+        const il::Array2D<double> &orig_matrix = vc_st.orig_matrix;
+        const il::Array2D<double> &nrm = vc_st.nrm;
+        const il::int_t orig_ndof = orig_dof_h.n_dof;
+
+        // far-field traction (the stored solutions are updated
+        // if the stress at infinity has changed)
+        bool is_new_s = false;
+        for (il::int_t k = 0; k < 6; ++k) {
+            is_new_s = is_new_s || (load.s_inf[k] != vc_st.s_inf[k]);
+        }
+        if (is_new_s) {
+            vc_st.s_inf = load.s_inf;
+            vc_st.rhs_t = make_vc_far_field_rhs
+                    (mesh, n_par, vc_st.s_inf, orig_dof_h);
+            const il::int_t n_fact = vc_st.fact.size();
+            for (il::int_t k = 0; k < n_fact; ++k) {
+                solve_vc_far_field(orig_dof_h, vc_st.rhs_t, ts_par.la,
+                                   il::io, vc_st.fact[k]);
+                ++ts_stat.n_solves;
+            }
+        }
+        const il::Array<double> &rhs_t = vc_st.rhs_t;
+
+        // initial state (DD & pressure, uniform in the VC scheme)
+        if (m_data.dd.size(0) != n_nod || m_data.dd.size(1) != 3) {
+            m_data.dd = il::Array2D<double>{n_nod, 3, 0.0};
+        }
+        if (m_data.pp.size() != n_nod) {
+            m_data.pp = il::Array<double>{n_nod, 0.0};
+        }
+        il::Array<double> x_dd =
+                get_dd_vector_from_md(m_data, orig_dof_h, false, orig_dof_h);
+        il::Array<double> x{orig_ndof + 1};
+        for (il::int_t i = 0; i < orig_ndof; ++i) {
+            x[i] = x_dd[i];
+        }
+        x[orig_ndof] = m_data.pp[0];
+        for (il::int_t n = 1; n < n_nod; ++n) {
+            x[orig_ndof] = std::max(x[orig_ndof], m_data.pp[n]);
+        }
+        // volume at the beginning of the stage
+        const double t_0 = m_data.time;
+        double vol_0 = 0.0;
+        for (il::int_t j = 0; j < orig_ndof; ++j) {
+            vol_0 += orig_matrix(orig_ndof, j) * x[j];
+        }
+        // closed nodes, the accepted states & the step size are kept
+        // if the stage continues the previous one
+        il::Array<bool> &is_closed = vc_st.is_closed;
+        std::vector<double> &h_t = vc_st.h_t;
+        std::vector<il::Array<double>> &h_x = vc_st.h_x;
+        if (h_t.empty() || h_t.back() != t_0) {
+            is_closed = il::Array<bool>{n_nod, false};
+            h_t.clear();
+            h_x.clear();
+            h_t.push_back(t_0);
+            h_x.push_back(x);
+            vc_st.dt_next = 0.0;
+        }
+
+        // leak-off: nodes open at the beginning are exposed
+        const bool is_leak_off = leak_off.area_w.size() > 0;
+        il::Array<double> opening{n_nod, 0.0};
+        double vol_lost = 0.0;
+        if (is_leak_off) {
+            get_nodal_opening(x, vc_st.op_ind, vc_st.op_wt,
+                              il::io, opening);
+            update_leak_off_exposure(opening, t_0, il::io, leak_off);
+        }
+
+        // stored factorizations
+        std::vector<VC_Fact_T> &fact = vc_st.fact;
+        il::int_t &n_use = vc_st.n_use;
+
+        const double t_eps = 1.0E-12 *
+                std::max(std::fabs(ts_par.t_end), ts_par.dt_min);
+        double t = t_0;
+        double dt = (vc_st.dt_next > 0.0) ?
+                    std::min(std::max(vc_st.dt_next, ts_par.dt_min),
+                             ts_par.dt_max) :
+                    ts_par.dt_ini;
+        status.set_ok();
+        while (t < ts_par.t_end - t_eps) {
+            // step limited by the end of the stage & the change of the rate
+            double t_brk = std::min(ts_par.t_end, next_inj_time(load, t));
+            double dt_s = std::min(dt, t_brk - t);
+            if (t_brk - t - dt_s < ts_par.dt_min) {
+                dt_s = t_brk - t;
+            }
+            const double t_new = t + dt_s;
+            // sought volume (the leaked volume is limited by the fluid
+            // in the fracture; computed once per step)
+            const double vol_f = vol_0 + injected_volume(load, t_0, t_new) -
+                                 vol_lost;
+            const double d_leak = std::min
+                    (carter_leak_off_volume(leak_off, t, t_new),
+                     std::max(vol_f, 0.0));
+            const double vol = vol_f - d_leak;
+
+            // predictor & the initial set of closed nodes
+            il::Array<double> x_p =
+                    extrapolate_state(h_t, h_x, ts_par.pred_order, t_new);
+            // (the fixed nodes, of zero opening, are never closed)
+            il::Array<double> w_p{n_nod};
+            get_nodal_opening(x_p, vc_st.op_ind, vc_st.op_wt, il::io, w_p);
+            il::Array<bool> is_cl_it{n_nod, false};
+            for (il::int_t n = 0; n < n_nod; ++n) {
+                is_cl_it[n] = w_p[n] < 0.0 || (is_closed[n] && w_p[n] <= 0.0);
+            }
+
+            // contact iterations (none if the fracture is drained
+            // by leak-off: zero DD & pressure, no node in contact)
+            il::Array<double> x_n{orig_ndof + 1, 0.0};
+            bool is_conv = false;
+            il::int_t n_it = 0;
+            if (vol <= 0.0) {
+                for (il::int_t n = 0; n < n_nod; ++n) {
+                    is_cl_it[n] = false;
+                }
+                is_conv = true;
+                n_it = 1;
+            }
+            while (!is_conv && n_it < ts_par.n_iter_max) {
+                ++n_it;
+                // factorization for the set of closed nodes (stored or new)
+                il::int_t k_f = -1;
+                for (il::int_t k = 0; k < static_cast<il::int_t>(fact.size());
+                     ++k) {
+                    bool is_same = true;
+                    for (il::int_t n = 0; n < n_nod && is_same; ++n) {
+                        is_same = fact[k].is_closed[n] == is_cl_it[n];
+                    }
+                    if (is_same) {
+                        k_f = k;
+                        break;
+                    }
+                }
+                if (k_f == -1) {
+                    if (static_cast<il::int_t>(fact.size()) <
+                        ts_par.n_fact_max) {
+                        fact.emplace_back();
+                        k_f = fact.size() - 1;
+                    } else {
+                        k_f = 0;
+                        for (il::int_t k = 1;
+                             k < static_cast<il::int_t>(fact.size()); ++k) {
+                            if (fact[k].last_use < fact[k_f].last_use) {
+                                k_f = k;
+                            }
+                        }
+                    }
+                    fact[k_f].is_closed = is_cl_it;
+                    factorize_vc_system(orig_matrix, orig_dof_h, rhs_t,
+                                        ts_par.la,
+                                        il::io, fact[k_f], status);
+                    if (!status.ok()) {
+                        fact.erase(fact.begin() + k_f);
+                        break;
+                    }
+                    ++ts_stat.n_fact;
+                    ts_stat.n_solves += 2;
+                }
+                ++n_use;
+                fact[k_f].last_use = n_use;
+                // solution for the sought volume
+                for (il::int_t i = 0; i <= orig_ndof; ++i) {
+                    x_n[i] = fact[k_f].x_t[i] + vol * fact[k_f].x_v[i];
+                }
+                il::int_t n_chg = update_closed_nodes
+                        (orig_matrix, orig_dof_h, rhs_t, nrm,
+                         n_par.is_dd_local, x_n, il::io, is_cl_it);
+                is_conv = (n_chg == 0);
+            }
+            ts_stat.n_iter += n_it;
+            if (!status.ok()) {
+                return;
+            }
+
+            // relative change of DD & pressure (not defined from zero DD)
+            double d_dd = 0.0, n_dd = 0.0, n_dd_0 = 0.0;
+            for (il::int_t i = 0; i < orig_ndof; ++i) {
+                d_dd += (x_n[i] - x[i]) * (x_n[i] - x[i]);
+                n_dd += x_n[i] * x_n[i];
+                n_dd_0 += x[i] * x[i];
+            }
+            double rate = 0.0;
+            if (n_dd_0 > 0.0 && n_dd > 0.0) {
+                rate = std::sqrt(d_dd / n_dd);
+                if (x_n[orig_ndof] != 0.0) {
+                    rate = std::max(rate,
+                                    std::fabs(x_n[orig_ndof] - x[orig_ndof]) /
+                                    std::fabs(x_n[orig_ndof]));
+                }
+            }
+
+            // rejection of the step
+            if (!is_conv || rate > 2.0 * ts_par.rate_target) {
+                if (dt_s <= ts_par.dt_min) {
+                    if (is_conv) {
+                        // the step can not be reduced further: accepted
+                        rate = 0.0;
+                    } else {
+                        status.set_error(il::Error::Undefined);
+                        IL_SET_SOURCE(status);
+                        return;
+                    }
+                } else {
+                    ++ts_stat.n_rejected;
+                    dt = std::max(dt_s * ts_par.dt_shrink, ts_par.dt_min);
+                    continue;
+                }
+            }
+
+            // accepted
+            ++ts_stat.n_steps;
+            t = t_new;
+            x = x_n;
+            is_closed = is_cl_it;
+            if (is_leak_off) {
+                vol_lost += d_leak;
+                leak_off.vol_lost += d_leak;
+                get_nodal_opening(x, vc_st.op_ind, vc_st.op_wt,
+                                  il::io, opening);
+                update_leak_off_exposure(opening, t, il::io, leak_off);
+            }
+            if (vol <= 0.0) {
+                // (no extrapolation across the drained state)
+                h_t.clear();
+                h_x.clear();
+            }
+            h_t.push_back(t);
+            h_x.push_back(x);
+            if (h_t.size() > 3) {
+                h_t.erase(h_t.begin());
+                h_x.erase(h_x.begin());
+            }
+            write_vc_state(x, orig_dof_h, is_closed, t, il::io, m_data);
+
+            // next step
+            double f = ts_par.dt_grow_max;
+            f = std::min(f, static_cast<double>(ts_par.n_iter_target) /
+                            static_cast<double>(n_it));
+            if (rate > 0.0) {
+                f = std::min(f, ts_par.rate_target / rate);
+            }
+            f = std::max(f, ts_par.dt_shrink);
+            dt = std::min(std::max(dt_s * f, ts_par.dt_min), ts_par.dt_max);
+            vc_st.dt_next = dt;
+        }
+    }
+
+    // Adaptive time stepping
+    void vc_time_stepping
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Time_Step_Param_T &ts_par,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             Time_Step_Stat_T &ts_stat,
+             il::Status &status) {
+        // (no leak-off)
+        Leak_Off_T leak_off{};
+        vc_time_stepping(mu, nu, mesh, n_par, load, ts_par,
+                         il::io, m_data, leak_off, ts_stat, status);
+    }
+
+    void vc_time_stepping
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Time_Step_Param_T &ts_par,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             Leak_Off_T &leak_off,
+             Time_Step_Stat_T &ts_stat,
+             il::Status &status) {
+        VC_Stepper_T vc_st = make_vc_stepper(mu, nu, mesh, n_par);
+        vc_advance(mesh, n_par, load, ts_par, il::io, vc_st, m_data,
+                   leak_off, ts_stat, status);
+    }
+
+}
@@ -0,0 +1,182 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Adaptive time stepping of the Volume Control scheme:
+// the injected volume follows the schedule of Load_T (inj_rate, inj_time);
+// at each step the VC system is solved with the nodes that would
+// interpenetrate being closed (zero DD), the set of closed nodes
+// being updated iteratively (contact iterations).
+// The step size is adapted from the number of iterations
+// and the relative change of the solution per step;
+// the DD predictor (extrapolated from the previous steps) gives
+// the initial set of closed nodes, and the LU factorizations
+// of the system (for the recent sets of closed nodes) are reused
+// across iterations & steps, and across stages if the stepper
+// (VC_Stepper_T) is kept, e.g. when coupled with another simulator
+
+#ifndef INC_HFPX3D_TIME_STEPPING_H
+#define INC_HFPX3D_TIME_STEPPING_H
+
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/Status.h>
+#include "mesh_utilities.h"
+#include "dense_la.h"
+#include "leak_off.h"
+
+namespace hfp3d {
+
+    // time stepping parameters
+    struct Time_Step_Param_T {
+        // end of the stage (it starts at m_data.time)
+        double t_end = 1.0;
+        // initial, min. & max. time step
+        double dt_ini = 1.0E-2;
+        double dt_min = 1.0E-8;
+        double dt_max = 1.0;
+        // max. & target number of contact iterations per step
+        il::int_t n_iter_max = 20;
+        il::int_t n_iter_target = 3;
+        // target relative change of DD (and pressure) per step
+        double rate_target = 0.1;
+        // bounds of the ratio of the next step to the current one
+        double dt_grow_max = 2.0;
+        double dt_shrink = 0.5;
+        // order (0, 1, or 2) of the DD predictor (extrapolation in time)
+        int pred_order = 2;
+        // max. number of stored LU factorizations
+        // (for different sets of closed nodes)
+        il::int_t n_fact_max = 2;
+        // dense LU (backend & threads)
+        Dense_LA_T la{};
+    };
+
+    // statistics of the stage
+    struct Time_Step_Stat_T {
+        // accepted & rejected steps
+        il::int_t n_steps = 0;
+        il::int_t n_rejected = 0;
+        // contact iterations (all steps)
+        il::int_t n_iter = 0;
+        // LU factorizations & solutions (right-hand sides)
+        il::int_t n_fact = 0;
+        il::int_t n_solves = 0;
+    };
+
+    // LU factorization of the Volume Control system for a set of closed
+    // nodes and the solutions for the far-field traction & a unit volume
+    // (on the original DoF, pressure last)
+    struct VC_Fact_T {
+        il::Array<bool> is_closed{};
+        il::Array2D<double> lu{};
+        il::Array<il::int_t> piv{};
+        il::Array<double> x_t{}, x_v{};
+        // for the replacement of the least recently used one
+        il::int_t last_use = 0;
+    };
+
+    // VC system (all DoF but the ones fixed at the tip),
+    // stored factorizations & the state of the stepping
+    struct VC_Stepper_T {
+        DoF_Handle_T orig_dof_h{};
+        il::Array2D<double> orig_matrix{};
+        // stress at infinity & far-field traction (listed by orig_dof_h)
+        il::StaticArray<double, 6> s_inf{0.0};
+        il::Array<double> rhs_t{};
+        // element normals (3 * n_el)
+        il::Array2D<double> nrm{};
+        // normal opening at the nodes (node-wise) as
+        // sum_i op_wt[i * n_nod + n] * x[op_ind[i * n_nod + n]]
+        // (zero weights at the fixed nodes)
+        il::Array<il::int_t> op_ind{};
+        il::Array<double> op_wt{};
+        // stored factorizations & the counter of their use
+        std::vector<VC_Fact_T> fact{};
+        il::int_t n_use = 0;
+        // closed nodes (node-wise), accepted states (time & solution,
+        // for the predictor; the latest last) & the next step size
+        il::Array<bool> is_closed{};
+        std::vector<double> h_t{};
+        std::vector<il::Array<double>> h_x{};
+        double dt_next = 0.0;
+    };
+
+    // fluid volume injected from t0 to t1
+    double injected_volume
+            (const Load_T &load,
+             double t0, double t1);
+
+    // Far-field traction (to be compensated by DD & pressure)
+    // listed by dof_h (the last entry, volume, is zero)
+    il::Array<double> make_vc_far_field_rhs
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::StaticArray<double, 6> &s_inf,
+             const DoF_Handle_T &dof_h);
+
+    // Assembly of the VC system (no factorization yet)
+    VC_Stepper_T make_vc_stepper
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par);
+
+    // Adaptive time stepping from m_data.time to ts_par.t_end
+    // with the stored system; the factorizations are kept for the next
+    // stages (re-solved if load.s_inf changes), as well as the closed
+    // nodes, the predictor & the step size if the next stage starts
+    // at the end of this one
+    void vc_advance
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Time_Step_Param_T &ts_par,
+             il::io_t,
+             VC_Stepper_T &vc_st,
+             Mesh_Data_T &m_data,
+             Leak_Off_T &leak_off,
+             Time_Step_Stat_T &ts_stat,
+             il::Status &status);
+
+    // Adaptive time stepping from m_data.time to ts_par.t_end
+    // (m_data.dd, m_data.pp & m_data.time are updated;
+    // m_data.dof_h_dd & m_data.ae_set list the DoF & elements
+    // of the open nodes at the end of the stage)
+    void vc_time_stepping
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Time_Step_Param_T &ts_par,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             Time_Step_Stat_T &ts_stat,
+             il::Status &status);
+
+    // (same, with fluid leak-off: the leaked volume is subtracted
+    // from the injected one, i.e. it reduces the sought volume delta_v
+    // of the VC system, and the nodes opened at the end of a step
+    // are exposed to the fluid; if the leak-off exceeds the fluid
+    // in the fracture, the fracture is drained, i.e. closed)
+    void vc_time_stepping
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const Load_T &load,
+             const Time_Step_Param_T &ts_par,
+             il::io_t,
+             Mesh_Data_T &m_data,
+             Leak_Off_T &leak_off,
+             Time_Step_Stat_T &ts_stat,
+             il::Status &status);
+
+}
+
+#endif //INC_HFPX3D_TIME_STEPPING_H
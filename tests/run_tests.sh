@@ -0,0 +1,99 @@
+#!/bin/sh
+#
+# This file is part of HFPx3D.
+#
+# Created by agent on 10/17/2026.
+# Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+# Geo-Energy Laboratory, 2026.  All rights reserved.
+# See the LICENSE.TXT file for more details.
+#
+
+# Builds & runs the regression tests (from the repository root):
+#   IL_INCLUDE_DIR=<il> sh tests/run_tests.sh
+# CXX & CXXFLAGS (default "-O2 -fopenmp -Wall") are passed to the compiler;
+# the Python module is built & its smoke test run if pybind11 & numpy
+# are installed.
+# Exits with a non-zero status if a test fails
+
+if [ -z "$IL_INCLUDE_DIR" ]; then
+    echo "IL_INCLUDE_DIR (the directory containing il/) is not set"
+    exit 2
+fi
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -fopenmp -Wall}
+BUILD_DIR=${BUILD_DIR:-_test_build}
+mkdir -p "$BUILD_DIR" || exit 2
+BUILD_DIR=$(cd "$BUILD_DIR" && pwd)
+
+# the sources all tests depend on
+BEM="system_assembly element_utilities tensor_utilities h_potential
+    elasticity_kernel_integration mesh_utilities mesh_file_io
+    congruent_pairs near_field_cache el2el_cache dense_la"
+
+# test name & the additional sources it depends on
+build_and_run() {
+    name=$1
+    shift
+    srcs=""
+    for f in $BEM "$@"; do
+        srcs="$srcs src/$f.cpp"
+    done
+    echo "== $name"
+    if ! $CXX -std=c++11 $CXXFLAGS -I"$IL_INCLUDE_DIR" -Isrc \
+            "tests/$name.cpp" $srcs -o "$BUILD_DIR/$name"; then
+        echo "$name: build failed"
+        n_failed=$((n_failed + 1))
+        return
+    fi
+    if ! "$BUILD_DIR/$name" Mesh_Files/; then
+        n_failed=$((n_failed + 1))
+    fi
+}
+
+n_failed=0
+build_and_run test_lazy_bem_matrix lazy_bem_matrix
+build_and_run test_block_matrix block_matrix
+build_and_run test_congruent_pairs
+build_and_run test_symmetry
+build_and_run test_ooc_lu tiled_matrix
+build_and_run test_task_lu task_lu
+build_and_run test_aca hodlr_solver
+build_and_run test_hodlr hodlr_solver
+build_and_run test_gcro_dr hodlr_solver
+build_and_run test_lubrication lubrication time_stepping leak_off
+build_and_run test_leak_off leak_off
+
+# the C API test is linked against the shared library (build_c_api.sh)
+echo "== test_c_api"
+if CXXFLAGS="$CXXFLAGS" sh build_c_api.sh "$BUILD_DIR" > /dev/null &&
+        $CXX -std=c++11 $CXXFLAGS -I"$IL_INCLUDE_DIR" -Isrc \
+        tests/test_c_api.cpp src/mesh_file_io.cpp -L"$BUILD_DIR" -lhfp3d \
+        -Wl,-rpath,"$BUILD_DIR" -o "$BUILD_DIR/test_c_api"; then
+    if ! "$BUILD_DIR/test_c_api" Mesh_Files/; then
+        n_failed=$((n_failed + 1))
+    fi
+else
+    echo "test_c_api: build failed"
+    n_failed=$((n_failed + 1))
+fi
+
+# the Python module is built (setup.py) if pybind11 & numpy are installed
+if python3 -c "import pybind11, numpy" 2>/dev/null; then
+    echo "== test_python_bindings"
+    if IL_INCLUDE_DIR="$IL_INCLUDE_DIR" python3 setup.py -q build_ext \
+            --build-lib "$BUILD_DIR/python" \
+            --build-temp "$BUILD_DIR/python_tmp" > /dev/null; then
+        if ! PYTHONPATH="$BUILD_DIR/python" \
+                python3 tests/test_python_bindings.py; then
+            n_failed=$((n_failed + 1))
+        fi
+    else
+        echo "test_python_bindings: build failed"
+        n_failed=$((n_failed + 1))
+    fi
+else
+    echo "== test_python_bindings skipped (pybind11 or numpy not installed)"
+fi
+
+echo "$n_failed test(s) failed"
+[ "$n_failed" -eq 0 ]
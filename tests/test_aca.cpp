@@ -0,0 +1,71 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the ACA compression of the VC matrix
+// (see make_3dbem_hodlr_vc): the product of the HODLR matrix
+// with a vector vs the one of the dense matrix (make_3dbem_matrix_vc)
+// for a decreasing ACA tolerance; build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "system_assembly.h"
+#include "hodlr_solver.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+    const il::int_t n = dof_hndl.n_dof + 1;
+    il::Array<double> x = test_vector(n, 1.7);
+    il::Array<double> b = test_dense_dot(a, x);
+
+    // the error of the product follows the ACA tolerance
+    const double aca_tol[3] = {1.0E-2, 1.0E-4, 1.0E-8};
+    const double max_err[3] = {1.0E-5, 1.0E-7, 1.0E-10};
+    il::int_t n_entries_prev = 0;
+    for (int k = 0; k < 3; ++k) {
+        HODLR_Param_T h_par;
+        h_par.aca_tol = aca_tol[k];
+        h_par.max_rank = 200;
+        HODLR_Matrix_T hm = make_3dbem_hodlr_vc
+                (1.0, 0.35, mesh, n_par, h_par, dof_hndl);
+        double err = test_rel_diff(hodlr_dot(hm, x), b);
+        std::printf("aca_tol %.0e: max rank %ld, %.1f%% of dense\n",
+                    aca_tol[k], static_cast<long>(hodlr_max_rank(hm)),
+                    100.0 * hodlr_n_entries(hm) / (n * n));
+        test_check(err < max_err[k], "HODLR x vs dense x", err,
+                   il::io, count);
+        test_check(hodlr_max_rank(hm) <= h_par.max_rank,
+                   "ranks within max_rank",
+                   static_cast<double>(hodlr_max_rank(hm)), il::io, count);
+        test_check(hodlr_n_entries(hm) >= n_entries_prev,
+                   "storage grows as the tolerance decreases",
+                   static_cast<double>(hodlr_n_entries(hm)), il::io, count);
+        n_entries_prev = hodlr_n_entries(hm);
+    }
+
+    // ranks are truncated at max_rank
+    HODLR_Param_T h_par;
+    h_par.aca_tol = 1.0E-12;
+    h_par.max_rank = 4;
+    HODLR_Matrix_T hm = make_3dbem_hodlr_vc
+            (1.0, 0.35, mesh, n_par, h_par, dof_hndl);
+    test_check(hodlr_max_rank(hm) <= 4, "rank truncated at max_rank",
+               static_cast<double>(hodlr_max_rank(hm)), il::io, count);
+
+    return test_result("test_aca", count);
+}
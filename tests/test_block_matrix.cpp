@@ -0,0 +1,71 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the BSR storage of the VC matrix
+// (see block_matrix.h): the dense conversion & the products (bsr_dot)
+// vs the dense VC matrix for all DoF & for half of the elements active;
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "system_assembly.h"
+#include "block_matrix.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    const il::int_t n_el = mesh.conn.size(1);
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+
+    // all DoF & the DoF of the first half of the elements
+    DoF_Handle_T dof_h[2] = {dof_hndl, make_test_dof_h_act(dof_hndl,
+                                                            n_el / 2)};
+    for (int k = 0; k < 2; ++k) {
+        std::printf("%ld DoF\n", static_cast<long>(dof_h[k].n_dof));
+        il::Array2D<double> a_d = a;
+        if (k > 0) {
+            a_d = mod_3dbem_system_vc
+                    (a, dof_hndl, dof_h[k],
+                     il::Array<double>{dof_h[k].n_dof, 0.0}, 0.0).matrix;
+        }
+        BSR_Matrix_T bsr = make_3dbem_matrix_vc_bsr
+                (1.0, 0.35, mesh, n_par, dof_h[k]);
+
+        double err = test_matrix_diff(bsr_to_dense(bsr, dof_h[k]), a_d);
+        test_check(err < 1.0E-14, "dense conversion vs dense matrix", err,
+                   il::io, count);
+
+        const il::int_t n = dof_h[k].n_dof + 1;
+        il::Array<double> x = test_vector(n, 0.9);
+        il::Array<double> y_d = test_dense_dot(a_d, x);
+        err = test_rel_diff(bsr_dot(bsr, dof_h[k], x), y_d);
+        test_check(err < 1.0E-13, "product vs dense product", err,
+                   il::io, count);
+
+        // block (element-wise) layout
+        il::Array<double> x_b = get_bsr_vector(bsr, dof_h[k], x);
+        err = test_rel_diff(get_dof_vector(bsr, dof_h[k], x_b), x);
+        test_check(err == 0.0, "block layout round trip", err,
+                   il::io, count);
+        il::Array<double> y_b = bsr_dot(bsr, x_b);
+        err = test_rel_diff(get_dof_vector(bsr, dof_h[k], y_b), y_d);
+        test_check(err < 1.0E-13, "block layout product vs dense product",
+                   err, il::io, count);
+    }
+
+    return test_result("test_block_matrix", count);
+}
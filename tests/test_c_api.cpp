@@ -0,0 +1,178 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the C API (see hfp3d_c_api.h): a round trip
+// create - parameters - assemble - injection increments - results;
+// the volume balance, the reuse of the stress matrix, the error codes
+// and the same solution with DD in the reference coordinate system;
+// build & run with run_tests.sh
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "hfp3d_c_api.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    // the mesh as plain arrays (numbered from 0)
+    const int nods_dim = static_cast<int>(mesh.nods.size(0));
+    const int conn_dim = static_cast<int>(mesh.conn.size(0));
+    const int64_t n_nods = mesh.nods.size(1);
+    const int64_t n_el = mesh.conn.size(1);
+    std::vector<double> nods(nods_dim * n_nods);
+    std::vector<int64_t> conn(conn_dim * n_el);
+    for (int64_t n = 0; n < n_nods; ++n) {
+        for (int j = 0; j < nods_dim; ++j) {
+            nods[nods_dim * n + j] = mesh.nods(j, n);
+        }
+    }
+    for (int64_t el = 0; el < n_el; ++el) {
+        for (int j = 0; j < conn_dim; ++j) {
+            conn[conn_dim * el + j] = mesh.conn(j, el);
+        }
+    }
+
+    // invalid connectivity
+    hfp3d_model *model = nullptr;
+    std::vector<int64_t> bad_conn = conn;
+    bad_conn[0] = n_nods;
+    int rc = hfp3d_create(nods.data(), nods_dim, n_nods, bad_conn.data(),
+                          conn_dim, n_el, 0, 1.0, 0.35, &model);
+    test_check(rc == HFP3D_ERR_ARGUMENT && model == nullptr,
+               "invalid connectivity rejected", rc, il::io, count);
+
+    rc = hfp3d_create(nods.data(), nods_dim, n_nods, conn.data(),
+                      conn_dim, n_el, 0, 1.0, 0.35, &model);
+    test_check(rc == HFP3D_OK, "model created", rc, il::io, count);
+    if (rc != HFP3D_OK) {
+        return test_result("test_c_api", count);
+    }
+    const double s_inf[6] = {-1.0, -1.0, -1.0, 0.0, 0.0, 0.0};
+    rc = hfp3d_step(model, s_inf, 1.0, 1.0);
+    test_check(rc == HFP3D_ERR_STATE, "step before assembly rejected", rc,
+               il::io, count);
+    rc = hfp3d_set_time_step_param(model, 1.0E-2, 1.0E-8, 0.1, 20);
+    test_check(rc == HFP3D_OK, "time stepping parameters", rc,
+               il::io, count);
+    rc = hfp3d_set_leak_off(model, 0.02);
+    test_check(rc == HFP3D_OK, "leak-off coefficient", rc, il::io, count);
+    rc = hfp3d_assemble(model);
+    test_check(rc == HFP3D_OK, "assembly", rc, il::io, count);
+
+    // injection at the unit rate: fracture + leaked-off volume
+    int64_t n_el_m = 0, n_nodes = 0;
+    hfp3d_get_size(model, &n_el_m, &n_nodes);
+    test_check(n_el_m == n_el && n_nodes == 6 * n_el, "model size",
+               static_cast<double>(n_nodes), il::io, count);
+    std::vector<double> pp(n_nodes), dd(3 * n_nodes);
+    double max_err = 0.0;
+    for (int k = 1; k <= 5; ++k) {
+        rc = hfp3d_step(model, s_inf, 1.0, 1.0);
+        if (rc != HFP3D_OK) {
+            break;
+        }
+        double vol = 0.0, vol_lost = 0.0;
+        hfp3d_get_volume(model, &vol, &vol_lost);
+        max_err = std::fmax(max_err, std::fabs(vol + vol_lost - k) / k);
+    }
+    test_check(rc == HFP3D_OK, "injection increments", rc, il::io, count);
+    test_check(max_err < 1.0E-8, "volume balance", max_err, il::io, count);
+    double time = 0.0;
+    hfp3d_get_time(model, &time);
+    test_check(std::fabs(time - 5.0) < 1.0E-12, "time", time,
+               il::io, count);
+    rc = hfp3d_get_pressure(model, pp.data());
+    test_check(rc == HFP3D_OK && pp[0] > 0.0 && std::isfinite(pp[0]),
+               "pressure", pp[0], il::io, count);
+    rc = hfp3d_get_dd(model, dd.data());
+    test_check(rc == HFP3D_OK, "DD", rc, il::io, count);
+
+    // stress: the same at repeated & interleaved calls
+    const double pts[6] = {0.0, 0.0, 0.5, 0.3, 0.2, -0.4};
+    const double pts_2[3] = {0.1, 0.1, 0.2};
+    double s_1[12], s_2[12], s_3[6];
+    rc = hfp3d_get_stress(model, pts, 2, s_1);
+    test_check(rc == HFP3D_OK && std::isfinite(s_1[0]), "stress", s_1[0],
+               il::io, count);
+    hfp3d_get_stress(model, pts_2, 1, s_3);
+    hfp3d_get_stress(model, pts, 2, s_2);
+    double d_s = 0.0;
+    for (int i = 0; i < 12; ++i) {
+        d_s = std::fmax(d_s, std::fabs(s_2[i] - s_1[i]));
+    }
+    test_check(d_s == 0.0, "stress at repeated calls", d_s, il::io, count);
+
+    // parameters changed: assembly required again
+    rc = hfp3d_set_num_param(model, 0.3, 1, 1);
+    test_check(rc == HFP3D_OK, "numerical parameters", rc, il::io, count);
+    rc = hfp3d_step(model, s_inf, 1.0, 1.0);
+    test_check(rc == HFP3D_ERR_STATE, "step before re-assembly rejected",
+               rc, il::io, count);
+    test_check(hfp3d_last_error(model)[0] != '\0', "error message", 0.0,
+               il::io, count);
+    rc = hfp3d_assemble(model);
+    if (rc == HFP3D_OK) {
+        rc = hfp3d_step(model, s_inf, 1.0, 1.0);
+    }
+    double vol = 0.0, vol_lost = 0.0;
+    hfp3d_get_volume(model, &vol, &vol_lost);
+    test_check(rc == HFP3D_OK && std::fabs(vol + vol_lost - 6.0) < 1.0E-8,
+               "volume balance after re-assembly",
+               std::fabs(vol + vol_lost - 6.0), il::io, count);
+
+    hfp3d_destroy(model);
+
+    // DD in the reference coordinate system: the same solution
+    hfp3d_model *model_g = nullptr;
+    rc = hfp3d_create(nods.data(), nods_dim, n_nods, conn.data(),
+                      conn_dim, n_el, 0, 1.0, 0.35, &model_g);
+    if (rc == HFP3D_OK) {
+        hfp3d_set_time_step_param(model_g, 1.0E-2, 1.0E-8, 0.1, 20);
+        hfp3d_set_leak_off(model_g, 0.02);
+        rc = hfp3d_set_num_param(model_g, 0.125, 1, 0);
+    }
+    if (rc == HFP3D_OK) {
+        rc = hfp3d_assemble(model_g);
+    }
+    for (int k = 1; k <= 5 && rc == HFP3D_OK; ++k) {
+        rc = hfp3d_step(model_g, s_inf, 1.0, 1.0);
+    }
+    test_check(rc == HFP3D_OK, "global DD: injection increments", rc,
+               il::io, count);
+    if (rc != HFP3D_OK) {
+        hfp3d_destroy(model_g);
+        return test_result("test_c_api", count);
+    }
+    std::vector<double> pp_g(n_nodes);
+    hfp3d_get_pressure(model_g, pp_g.data());
+    double d_p = 0.0;
+    for (int64_t n = 0; n < n_nodes; ++n) {
+        d_p = std::fmax(d_p, std::fabs(pp_g[n] - pp[n]));
+    }
+    test_check(d_p < 1.0E-8 * std::fabs(pp[0]), "global DD: pressure",
+               d_p, il::io, count);
+    rc = hfp3d_get_stress(model_g, pts, 2, s_2);
+    d_s = 0.0;
+    double s_max = 0.0;
+    for (int i = 0; i < 12; ++i) {
+        d_s = std::fmax(d_s, std::fabs(s_2[i] - s_1[i]));
+        s_max = std::fmax(s_max, std::fabs(s_1[i]));
+    }
+    test_check(rc == HFP3D_OK && d_s < 1.0E-8 * s_max,
+               "global DD: stress", d_s, il::io, count);
+    hfp3d_destroy(model_g);
+
+    return test_result("test_c_api", count);
+}
@@ -0,0 +1,105 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the congruent-pair reuse (see congruent_pairs.h):
+// the VC matrix assembled with is_cp_reuse vs the uncached one,
+// and the blocks of a rigidly moved mesh taken from the cache filled
+// by the original one vs the rotated original blocks;
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray2D.h>
+#include "system_assembly.h"
+#include "congruent_pairs.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    const il::int_t n_el = mesh.conn.size(1);
+    const double mu = 1.0, nu = 0.35;
+
+    // assembly with & without reuse
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (mu, nu, mesh, n_par, il::io, dof_hndl);
+    n_par.is_cp_reuse = true;
+    il::Array2D<double> a_cp = make_3dbem_matrix_vc
+            (mu, nu, mesh, n_par, il::io, dof_hndl);
+    // (the influence of adjacent elements is reproducible to ~1e-6
+    // of the block in different local coordinates)
+    double err = test_matrix_diff(a_cp, a);
+    test_check(err < 1.0E-7, "VC matrix with reuse vs uncached", err,
+               il::io, count);
+
+    // a rigidly moved copy of the mesh: every pair is congruent
+    // to the one of the original mesh, its block is taken from the cache
+    // and equals the rotated block of the original pair
+    Mesh_Geom_T moved = move_test_mesh(mesh, 1.0);
+    const double l_scale = get_mesh_length_scale(mesh);
+    const il::int_t n_pairs = 24;
+    for (int dd_loc = 1; dd_loc >= 0; --dd_loc) {
+        const bool is_dd_local = (dd_loc == 1);
+        Congr_Pair_Cache cache{mu, nu, n_par.cp_tol, l_scale,
+                               n_par.cp_max_size};
+        il::Array<il::StaticArray2D<double, 18, 18>> blk_0{n_pairs};
+        double max_err = 0.0;
+        for (il::int_t p = 0; p < n_pairs; ++p) {
+            Element_Struct_T src_el = get_mesh_el_struct
+                    (mesh, (7 * p) % n_el, n_par.beta);
+            Element_Struct_T trg_el = get_mesh_el_struct
+                    (mesh, (11 * p + 3) % n_el, n_par.beta);
+            blk_0[p] = cache.el2el(src_el, trg_el, is_dd_local);
+            max_err = std::fmax(max_err, test_block_diff
+                    (blk_0[p], make_el2el_3dbem_submatrix
+                            (mu, nu, src_el, trg_el, is_dd_local)));
+        }
+        std::printf("%s DD\n", is_dd_local ? "local" : "global");
+        test_check(max_err < 1.0E-6, "blocks vs uncached", max_err,
+                   il::io, count);
+
+        const il::int_t n_misses = cache.n_misses();
+        max_err = 0.0;
+        for (il::int_t p = 0; p < n_pairs; ++p) {
+            il::StaticArray2D<double, 18, 18> blk = cache.el2el
+                    (get_mesh_el_struct(moved, (7 * p) % n_el, n_par.beta),
+                     get_mesh_el_struct(moved, (11 * p + 3) % n_el,
+                                        n_par.beta),
+                     is_dd_local);
+            max_err = std::fmax(max_err, test_block_diff
+                    (blk, rotate_test_block(blk_0[p], is_dd_local)));
+        }
+        test_check(cache.n_misses() == n_misses,
+                   "moved mesh: all blocks from the cache",
+                   static_cast<double>(cache.n_misses() - n_misses),
+                   il::io, count);
+        test_check(max_err < 1.0E-12,
+                   "moved mesh: blocks vs rotated original ones",
+                   max_err, il::io, count);
+    }
+
+    // bounded cache
+    Congr_Pair_Cache small{mu, nu, n_par.cp_tol, l_scale, 10};
+    for (il::int_t p = 0; p < n_pairs; ++p) {
+        small.el2el(get_mesh_el_struct(mesh, p, n_par.beta),
+                    get_mesh_el_struct(mesh, n_el - 1 - p, n_par.beta),
+                    true);
+    }
+    test_check(small.size() <= small.max_size(),
+               "number of stored blocks within the limit",
+               static_cast<double>(small.size()), il::io, count);
+
+    return test_result("test_congruent_pairs", count);
+}
@@ -0,0 +1,101 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of GCRO-DR (see krylov_solvers.h): a sequence of
+// slowly changing systems (perturbed VC matrix & right-hand side,
+// as in time stepping) with a coarse HODLR preconditioner,
+// solved with & without the recycled subspace;
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "hodlr_solver.h"
+#include "krylov_solvers.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+    const il::int_t n = dof_hndl.n_dof + 1;
+
+    // a poor preconditioner, so that the recycling matters
+    HODLR_Param_T h_par;
+    h_par.aca_tol = 1.0E-1;
+    h_par.max_rank = 4;
+    h_par.leaf_size = 4;
+    HODLR_Matrix_T hm = make_3dbem_hodlr_vc
+            (1.0, 0.35, mesh, n_par, h_par, dof_hndl);
+    il::Status status{};
+    hodlr_factorize(h_par, il::io, hm, status);
+    status.abort_on_error();
+    HODLR_Prec_T prec{&hm};
+
+    // diagonal perturbation (none in the volume row)
+    il::Array<double> d_diag = test_vector(n, 2.3);
+    d_diag[n - 1] = 0.0;
+    il::Array<double> b_0 = test_vector(n, 0.7);
+    il::Array<double> b_1 = test_vector(n, 3.1);
+
+    const double tol = 1.0E-10;
+    Krylov_Recycle_T rec;
+    rec.k_max = 10;
+    il::int_t n_it_gmres = 0, n_it_gcro = 0;
+    double max_res = 0.0;
+    for (int step = 0; step < 8; ++step) {
+        const double eps = 0.02 * step;
+        auto op = [&](const il::Array<double> &v) {
+            il::Array<double> y = test_dense_dot(a, v);
+            for (il::int_t i = 0; i < n; ++i) {
+                y[i] += eps * d_diag[i] * v[i];
+            }
+            return y;
+        };
+        il::Array<double> b{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            b[i] = (1.0 + 0.1 * step) * b_0[i] + 0.05 * step * b_1[i];
+        }
+        il::int_t n_it = 0;
+        double res = 0.0;
+        gmres(op, prec, b, 20, tol, 3000, il::io, n_it, res);
+        n_it_gmres += n_it;
+        il::Array<double> x = gcro_dr(op, prec, b, 20, tol, 3000,
+                                      il::io, rec, n_it, res);
+        n_it_gcro += n_it;
+        // true residual
+        double res_t = test_rel_diff(op(x), b);
+        if (res_t > max_res) {
+            max_res = res_t;
+        }
+        std::printf("step %d: GCRO-DR %ld iterations, residual %.2e\n",
+                    step, static_cast<long>(n_it), res_t);
+    }
+    test_check(max_res < 1.0E-9, "GCRO-DR true residual", max_res,
+               il::io, count);
+    test_check(rec.z.size(1) > 0 && rec.z.size(1) <= rec.k_max,
+               "recycled subspace dimension",
+               static_cast<double>(rec.z.size(1)), il::io, count);
+    std::printf("total iterations: GMRES %ld, GCRO-DR %ld\n",
+                static_cast<long>(n_it_gmres),
+                static_cast<long>(n_it_gcro));
+    test_check(n_it_gcro < n_it_gmres, "recycling saves iterations",
+               static_cast<double>(n_it_gcro) / n_it_gmres,
+               il::io, count);
+
+    return test_result("test_gcro_dr", count);
+}
@@ -0,0 +1,81 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the HODLR factorization of the VC matrix
+// (see hodlr_solver.h): direct solution vs the dense one
+// and the HODLR preconditioner of GMRES with the dense operator;
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "hodlr_solver.h"
+#include "krylov_solvers.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+    const il::int_t n = dof_hndl.n_dof + 1;
+    il::Array<double> x = test_vector(n, 0.9);
+    il::Array<double> b = test_dense_dot(a, x);
+    auto dense_dot = [&a](const il::Array<double> &v) {
+        return test_dense_dot(a, v);
+    };
+
+    // direct solution (accurate compression)
+    HODLR_Param_T h_par;
+    h_par.aca_tol = 1.0E-8;
+    h_par.max_rank = 200;
+    HODLR_Matrix_T hm = make_3dbem_hodlr_vc
+            (1.0, 0.35, mesh, n_par, h_par, dof_hndl);
+    il::Status status{};
+    hodlr_factorize(h_par, il::io, hm, status);
+    test_check(status.ok(), "factorization", 0.0, il::io, count);
+    if (!status.ok()) {
+        return test_result("test_hodlr", count);
+    }
+    il::Array<double> x_h = hodlr_solve(hm, b);
+    double err = test_rel_diff(x_h, x);
+    test_check(err < 1.0E-3, "HODLR solution vs exact", err,
+               il::io, count);
+    err = test_rel_diff(hodlr_dot(hm, x_h), b);
+    test_check(err < 1.0E-4, "HODLR residual of the solution", err,
+               il::io, count);
+
+    // preconditioner of GMRES (coarse compression)
+    h_par.aca_tol = 1.0E-4;
+    HODLR_Matrix_T hm_p = make_3dbem_hodlr_vc
+            (1.0, 0.35, mesh, n_par, h_par, dof_hndl);
+    hodlr_factorize(h_par, il::io, hm_p, status);
+    status.abort_on_error();
+    HODLR_Prec_T prec{&hm_p};
+    il::int_t n_it = 0;
+    double res = 0.0;
+    il::Array<double> x_g = gmres(dense_dot, prec, b, 50, 1.0E-10, 500,
+                                  il::io, n_it, res);
+    test_check(res <= 1.0E-10, "preconditioned GMRES converged", res,
+               il::io, count);
+    test_check(n_it < 30, "preconditioned GMRES iterations",
+               static_cast<double>(n_it), il::io, count);
+    err = test_rel_diff(x_g, x);
+    test_check(err < 1.0E-6, "GMRES solution vs exact", err,
+               il::io, count);
+
+    return test_result("test_hodlr", count);
+}
@@ -0,0 +1,93 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the lazily assembled VC operator
+// (see lazy_bem_matrix.h): the product (dot) & the truncated system
+// (make_trc_system) vs the dense VC matrix, with all blocks cached
+// and with a memory limit of a few row panels;
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "system_assembly.h"
+#include "lazy_bem_matrix.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    const il::int_t n_el = mesh.conn.size(1);
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+    DoF_Handle_T dof_h_act = make_test_dof_h_act(dof_hndl, n_el / 2);
+
+    // unlimited cache & a limit of ~5 row panels
+    const il::int_t blk_mem = 2 * sizeof(il::StaticArray2D<double, 18, 18>);
+    const il::int_t max_mem[2] = {n_el * n_el * blk_mem, 5 * n_el * blk_mem};
+    for (int k = 0; k < 2; ++k) {
+        Lazy_BEM_Matrix lazy{1.0, 0.35, mesh, n_par, max_mem[k]};
+        std::printf("max. %ld blocks\n",
+                    static_cast<long>(lazy.max_blocks()));
+
+        // product for all DoF, twice (the 2nd pass hits the cache)
+        const il::int_t n = dof_hndl.n_dof + 1;
+        il::Array<double> x = test_vector(n, 0.7);
+        il::Array<double> y_d = test_dense_dot(a, x);
+        il::Array<double> y_l = lazy.dot(dof_hndl, x);
+        double err = test_rel_diff(y_l, y_d);
+        test_check(err < 1.0E-13, "dot vs dense product", err,
+                   il::io, count);
+        il::int_t n_hits = lazy.n_hits();
+        y_l = lazy.dot(dof_hndl, x);
+        err = test_rel_diff(y_l, y_d);
+        test_check(err < 1.0E-13, "repeated dot vs dense product", err,
+                   il::io, count);
+        test_check(lazy.n_hits() > n_hits, "cache hits on repeated dot",
+                   static_cast<double>(lazy.n_hits() - n_hits),
+                   il::io, count);
+        test_check(lazy.n_blocks() <= lazy.max_blocks(),
+                   "number of cached blocks within the limit",
+                   static_cast<double>(lazy.n_blocks()), il::io, count);
+
+        // truncated system (half of the elements active)
+        il::Array<double> delta_t = test_vector(dof_h_act.n_dof, 1.9);
+        SAE_T sys_d = mod_3dbem_system_vc
+                (a, dof_hndl, dof_h_act, delta_t, 0.25);
+        SAE_T sys_l = lazy.make_trc_system(dof_h_act, delta_t, 0.25);
+        test_check(sys_l.n_dof == sys_d.matrix.size(0),
+                   "truncated system size",
+                   static_cast<double>(sys_l.n_dof), il::io, count);
+        err = test_matrix_diff(sys_l.matrix, sys_d.matrix);
+        test_check(err < 1.0E-13, "truncated matrix vs dense", err,
+                   il::io, count);
+        err = test_rel_diff(sys_l.rhs_v, sys_d.rhs_v);
+        test_check(err == 0.0, "truncated RHS vs dense", err,
+                   il::io, count);
+
+        // truncated product vs the truncated dense matrix
+        il::Array<double> x_act = test_vector(dof_h_act.n_dof + 1, 2.3);
+        y_l = lazy.dot(dof_h_act, x_act);
+        err = test_rel_diff(y_l, test_dense_dot(sys_d.matrix, x_act));
+        test_check(err < 1.0E-13, "truncated dot vs dense product", err,
+                   il::io, count);
+
+        lazy.clear();
+        test_check(lazy.n_blocks() == 0 && lazy.n_panels() == 0,
+                   "cache cleared", static_cast<double>(lazy.n_blocks()),
+                   il::io, count);
+    }
+
+    return test_result("test_lazy_bem_matrix", count);
+}
@@ -0,0 +1,117 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of Carter's leak-off (see leak_off.h): the nodal areas
+// vs the element areas and the leaked volume vs the closed-form
+// 4 * c_l * area * sqrt(t - t_exp) law (2 faces) for the nodes exposed
+// at different times; build & run with run_tests.sh
+
+#include <cmath>
+#include <cstdio>
+#include <il/Array.h>
+#include "mesh_utilities.h"
+#include "leak_off.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    const il::int_t n_el = mesh.conn.size(1);
+    Num_Param_T n_par;
+    const double c_l = 0.02;
+
+    // area of the (flat) elements
+    il::Array<double> el_area{n_el};
+    double area = 0.0;
+    for (il::int_t el = 0; el < n_el; ++el) {
+        double a[3], b[3];
+        for (il::int_t j = 0; j < 3; ++j) {
+            const double x_0 = mesh.nods(j, mesh.conn(0, el));
+            a[j] = mesh.nods(j, mesh.conn(1, el)) - x_0;
+            b[j] = mesh.nods(j, mesh.conn(2, el)) - x_0;
+        }
+        const double c_0 = a[1] * b[2] - a[2] * b[1];
+        const double c_1 = a[2] * b[0] - a[0] * b[2];
+        const double c_2 = a[0] * b[1] - a[1] * b[0];
+        el_area[el] = 0.5 * std::sqrt(c_0 * c_0 + c_1 * c_1 + c_2 * c_2);
+        area += el_area[el];
+    }
+
+    // the nodal areas add up to the element areas
+    Leak_Off_T leak_off = make_leak_off(mesh, n_par, il::Array<il::int_t>{},
+                                        c_l);
+    double d_a = 0.0;
+    for (il::int_t el = 0; el < n_el; ++el) {
+        double a_el = 0.0;
+        for (il::int_t n = 0; n < 6; ++n) {
+            a_el += leak_off.area_w[6 * el + n];
+        }
+        d_a = std::fmax(d_a, std::fabs(a_el - el_area[el]) / el_area[el]);
+    }
+    test_check(d_a < 1.0E-12, "nodal areas vs element area", d_a,
+               il::io, count);
+    test_check(carter_leak_off_volume(leak_off, 0.0, 1.0) == 0.0,
+               "no leak-off before the exposure", 0.0, il::io, count);
+
+    // elements of the first half exposed at t = 0, the rest at t = 1
+    const il::int_t n_el_0 = n_el / 2;
+    double area_0 = 0.0;
+    il::Array<double> opening{6 * n_el, 0.0};
+    for (il::int_t el = 0; el < n_el_0; ++el) {
+        area_0 += el_area[el];
+        for (il::int_t n = 0; n < 6; ++n) {
+            opening[6 * el + n] = 1.0;
+        }
+    }
+    update_leak_off_exposure(opening, 0.0, il::io, leak_off);
+    for (il::int_t n = 0; n < opening.size(); ++n) {
+        opening[n] = 1.0;
+    }
+    update_leak_off_exposure(opening, 1.0, il::io, leak_off);
+    // (not exposed again later)
+    update_leak_off_exposure(opening, 2.0, il::io, leak_off);
+
+    const double t[3] = {0.5, 2.0, 5.0};
+    double d_v = 0.0;
+    for (int k = 0; k < 3; ++k) {
+        const double v_exact = 4.0 * c_l *
+                (area_0 * std::sqrt(t[k]) +
+                 (area - area_0) * std::sqrt(std::fmax(t[k] - 1.0, 0.0)));
+        const double v = carter_leak_off_volume(leak_off, 0.0, t[k]);
+        d_v = std::fmax(d_v, std::fabs(v - v_exact) / v_exact);
+    }
+    test_check(d_v < 1.0E-12, "leaked volume vs the sqrt(t) law", d_v,
+               il::io, count);
+    const double v_05 = carter_leak_off_volume(leak_off, 0.0, 0.5) +
+                        carter_leak_off_volume(leak_off, 0.5, 2.0) +
+                        carter_leak_off_volume(leak_off, 2.0, 5.0);
+    const double v_5 = carter_leak_off_volume(leak_off, 0.0, 5.0);
+    test_check(std::fabs(v_05 - v_5) < 1.0E-14 * v_5,
+               "leaked volume additive in time",
+               std::fabs(v_05 - v_5) / v_5, il::io, count);
+
+    // a subset of the elements (fe_set)
+    il::Array<il::int_t> fe_set{n_el_0};
+    for (il::int_t k = 0; k < n_el_0; ++k) {
+        fe_set[k] = k;
+    }
+    Leak_Off_T leak_off_s = make_leak_off(mesh, n_par, fe_set, c_l);
+    update_leak_off_exposure(opening, 0.0, il::io, leak_off_s);
+    const double v_s = carter_leak_off_volume(leak_off_s, 0.0, 4.0);
+    const double v_s_exact = 4.0 * c_l * area_0 * 2.0;
+    test_check(leak_off_s.nod.size() == 6 * n_el_0 &&
+               std::fabs(v_s - v_s_exact) < 1.0E-12 * v_s_exact,
+               "leaked volume of the filled elements",
+               std::fabs(v_s - v_s_exact) / v_s_exact, il::io, count);
+
+    return test_result("test_leak_off", count);
+}
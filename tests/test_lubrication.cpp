@@ -0,0 +1,128 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the coupled elasticity-lubrication Newton solver
+// (see lubrication.h): injection at the central element of
+// a penny-shaped fracture; the fracture volume has to follow
+// the injected one, the pressure has to be the highest at the
+// injection; an invalid injection location has to be reported
+// without changing the solution; build & run with run_tests.sh
+
+#include <cmath>
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "lubrication.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    const il::int_t n_el = mesh.conn.size(1);
+    Num_Param_T n_par;
+
+    // the element closest to the centre
+    il::int_t inj_el = 0;
+    double d_min = 0.0;
+    for (il::int_t el = 0; el < n_el; ++el) {
+        double d = 0.0;
+        for (il::int_t j = 0; j < 3; ++j) {
+            double x_c = 0.0;
+            for (il::int_t k = 0; k < 3; ++k) {
+                x_c += mesh.nods(j, mesh.conn(k, el)) / 3.0;
+            }
+            d += x_c * x_c;
+        }
+        if (el == 0 || d < d_min) {
+            d_min = d;
+            inj_el = el;
+        }
+    }
+    Load_T load;
+    load.inj_loc = il::Array2D<il::int_t>{1, 7, 0};
+    load.inj_loc(0, 0) = inj_el;
+    load.inj_rate = il::Array<double>{1, 1.0};
+
+    Mesh_Data_T m_data;
+    m_data.mesh = &mesh;
+    m_data.fe_set = il::Array<il::int_t>{n_el};
+    for (il::int_t el = 0; el < n_el; ++el) {
+        m_data.fe_set[el] = el;
+    }
+    Flow_Param_T fl_par;
+    fl_par.visc = 1.0;
+    fl_par.w_min = 1.0E-6;
+    il::Status status{};
+    Hydro_Frac_Sys_T hf_sys = make_hydro_frac_system
+            (1.0, 0.35, mesh, n_par, load, fl_par, il::io, m_data, status);
+    test_check(status.ok(), "system assembly", 0.0, il::io, count);
+    if (!status.ok()) {
+        return test_result("test_lubrication", count);
+    }
+
+    const double dt = 0.2;
+    for (int step = 0; step < 5; ++step) {
+        il::int_t n_newton = 0, n_krylov = 0;
+        lubrication_step(hf_sys, load, fl_par, dt, il::io, m_data,
+                         n_newton, n_krylov, status);
+        test_check(status.ok(), "Newton iterations converged",
+                   static_cast<double>(n_newton), il::io, count);
+        if (!status.ok()) {
+            return test_result("test_lubrication", count);
+        }
+        // fracture volume (sum of the cell volumes)
+        il::Array<double> dd = get_dd_vector_from_md
+                (m_data, hf_sys.dof_h_dd, false, hf_sys.dof_h_pp);
+        il::Array<double> v_c = csr_dot(hf_sys.b, dd);
+        double vol = 0.0;
+        for (il::int_t c = 0; c < v_c.size(); ++c) {
+            vol += v_c[c];
+        }
+        const double vol_inj = load.inj_rate[0] * dt * (step + 1);
+        test_check(std::fabs(vol - vol_inj) < 1.0E-8 * vol_inj,
+                   "fracture volume = injected volume",
+                   std::fabs(vol - vol_inj) / vol_inj, il::io, count);
+    }
+    test_check(std::fabs(m_data.time - 1.0) < 1.0E-12, "time", m_data.time,
+               il::io, count);
+    double p_max = m_data.pp[6 * inj_el];
+    bool is_max = true;
+    for (il::int_t el = 0; el < n_el; ++el) {
+        if (m_data.pp[6 * el] > p_max) {
+            is_max = false;
+        }
+    }
+    test_check(is_max && p_max > 0.0, "highest pressure at the injection",
+               p_max, il::io, count);
+
+    // invalid injection location: error, no change
+    Load_T bad_load = load;
+    bad_load.inj_loc(0, 0) = n_el + 5;
+    il::Array2D<double> dd_0 = m_data.dd;
+    il::int_t n_newton = 0, n_krylov = 0;
+    lubrication_step(hf_sys, bad_load, fl_par, dt, il::io, m_data,
+                     n_newton, n_krylov, status);
+    test_check(!status.ok(), "invalid injection location reported", 0.0,
+               il::io, count);
+    double d_dd = 0.0;
+    for (il::int_t j = 0; j < dd_0.size(1); ++j) {
+        for (il::int_t i = 0; i < dd_0.size(0); ++i) {
+            d_dd += std::fabs(m_data.dd(i, j) - dd_0(i, j));
+        }
+    }
+    test_check(d_dd == 0.0 && m_data.time == 1.0, "solution not changed",
+               d_dd, il::io, count);
+
+    return test_result("test_lubrication", count);
+}
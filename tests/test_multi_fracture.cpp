@@ -0,0 +1,164 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the block-structured system for multiple fractures
+// (see multi_fracture.h): the product (mf_dot) & the block Gauss-Seidel
+// solution vs the monolithic system (the static matrix of all fractures
+// with a volume row & a pressure column per fracture) solved by LU,
+// with dense and with low-rank cross-interaction blocks;
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "element_utilities.h"
+#include "dense_la.h"
+#include "multi_fracture.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+// copies of the mesh shifted by shift(:, f) (fracture f)
+Mesh_Geom_T make_test_mf_mesh
+        (const Mesh_Geom_T &mesh,
+         const il::Array2D<double> &shift) {
+    const il::int_t n_nod = mesh.nods.size(1);
+    const il::int_t n_el = mesh.conn.size(1);
+    const il::int_t n_frac = shift.size(1);
+    Mesh_Geom_T mf_mesh;
+    mf_mesh.nods = il::Array2D<double>{3, n_frac * n_nod};
+    mf_mesh.conn = il::Array2D<il::int_t>{3, n_frac * n_el};
+    mf_mesh.frac_id = il::Array<il::int_t>{n_frac * n_el};
+    for (il::int_t f = 0; f < n_frac; ++f) {
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            for (int k = 0; k < 3; ++k) {
+                mf_mesh.nods(k, f * n_nod + n) = mesh.nods(k, n) +
+                                                 shift(k, f);
+            }
+        }
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (int j = 0; j < 3; ++j) {
+                mf_mesh.conn(j, f * n_el + el) = f * n_nod + mesh.conn(j, el);
+            }
+            mf_mesh.frac_id[f * n_el + el] = f;
+        }
+    }
+    return mf_mesh;
+}
+
+// monolithic system in the layout of mf_sys ([DD_1; p_1; DD_2; ...])
+il::Array2D<double> make_test_mf_monolithic
+        (double mu, double nu,
+         const Mesh_Geom_T &mesh,
+         const Num_Param_T &n_par,
+         const Multi_Frac_System_T &mf_sys) {
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a_s = make_3dbem_matrix_s
+            (mu, nu, mesh, n_par, il::io, dof_hndl);
+    const il::int_t n_el = mesh.conn.size(1);
+    const il::int_t n = mf_sys.offset[mf_sys.n_frac];
+    // position of each DoF in the layout of mf_sys
+    il::Array<il::int_t> pos{dof_hndl.n_dof, -1};
+    for (il::int_t el = 0; el < n_el; ++el) {
+        il::int_t f = mesh.frac_id[el];
+        for (int l = 0; l < 18; ++l) {
+            pos[dof_hndl.dof_h(el, l)] = mf_sys.offset[f] +
+                                         mf_sys.dof_h[f].dof_h(el, l);
+        }
+    }
+    il::Array2D<double> m{n, n, 0.0};
+    for (il::int_t j = 0; j < dof_hndl.n_dof; ++j) {
+        for (il::int_t i = 0; i < dof_hndl.n_dof; ++i) {
+            m(pos[i], pos[j]) = a_s(i, j);
+        }
+    }
+    // volume vs DD & traction vs pressure of each fracture
+    for (il::int_t el = 0; el < n_el; ++el) {
+        il::int_t f = mesh.frac_id[el];
+        il::int_t v_row = mf_sys.offset[f + 1] - 1;
+        il::StaticArray2D<double, 2, 18> vc = make_el_vc_submatrix
+                (get_mesh_el_struct(mesh, el, n_par.beta), n_par.is_dd_local);
+        for (int l = 0; l < 18; ++l) {
+            il::int_t p = pos[dof_hndl.dof_h(el, l)];
+            m(v_row, p) = vc(0, l);
+            m(p, v_row) = vc(1, l);
+        }
+    }
+    return m;
+}
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh24el");
+    const double mu = 1.0, nu = 0.35;
+    // two parallel close fractures & a distant one
+    il::Array2D<double> shift{3, 3, 0.0};
+    shift(2, 1) = 0.75;
+    shift(0, 2) = 12.0;
+    Mesh_Geom_T mf_mesh = make_test_mf_mesh(mesh, shift);
+    Num_Param_T n_par;
+    n_par.tip_type = 0;
+    DoF_Handle_T dof_hndl = make_dof_h_crack(mf_mesh, 2, 0);
+
+    // all cross-interaction blocks dense; low-rank blocks if admissible
+    const double eta[2] = {1.0E6, 2.0};
+    for (int k = 0; k < 2; ++k) {
+        Multi_Frac_Param_T mf_par;
+        mf_par.eta = eta[k];
+        mf_par.skip_tol = 0.0;
+        Multi_Frac_System_T mf_sys = make_3dbem_system_mf
+                (mu, nu, mf_mesh, n_par, mf_par, dof_hndl);
+        il::Array2D<double> m = make_test_mf_monolithic
+                (mu, nu, mf_mesh, n_par, mf_sys);
+        const il::int_t n = m.size(0);
+        int n_low_rank = 0;
+        for (il::int_t b = 0; b < mf_sys.cross.size(); ++b) {
+            n_low_rank += (mf_sys.cross[b].type == 1) ? 1 : 0;
+        }
+        std::printf("eta = %g: %ld fractures, %d low-rank blocks\n", eta[k],
+                    static_cast<long>(mf_sys.n_frac), n_low_rank);
+        test_check((k == 0) == (n_low_rank == 0), "block types", n_low_rank,
+                   il::io, count);
+        // (ACA tolerance for the low-rank blocks)
+        const double tol = (k == 0) ? 1.0E-13 : 1.0E-5;
+
+        il::Array<double> x = test_vector(n, 0.8);
+        double err = test_rel_diff(mf_dot(mf_sys, x),
+                                   test_dense_dot(m, x));
+        test_check(err < tol, "product vs monolithic product", err,
+                   il::io, count);
+
+        // block Gauss-Seidel vs LU of the monolithic system
+        il::Array<double> rhs = test_vector(n, 2.1);
+        il::int_t n_iter = 0;
+        il::Status status{};
+        il::Array<double> x_gs = solve_3dbem_system_mf
+                (mf_sys, mf_par, rhs, il::io, n_iter, status);
+        test_check(status.ok() && n_iter < mf_par.gs_max_iter,
+                   "Gauss-Seidel converged", static_cast<double>(n_iter),
+                   il::io, count);
+        if (!status.ok()) {
+            continue;
+        }
+        const Dense_LA_T la{};
+        il::Array<il::int_t> piv{};
+        la_getrf(la, il::io, m, piv, status);
+        status.abort_on_error();
+        il::Array<double> x_lu = la_getrs(la, m, piv, rhs);
+        err = test_rel_diff(x_gs, x_lu);
+        test_check(err < std::fmax(tol, 1.0E-8),
+                   "Gauss-Seidel vs monolithic LU solution", err,
+                   il::io, count);
+    }
+
+    return test_result("test_multi_fracture", count);
+}
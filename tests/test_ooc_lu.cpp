@@ -0,0 +1,93 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the out-of-core VC matrix (see tiled_matrix.h):
+// the product & the LU solution vs the in-core dense ones
+// (la_getrf & la_getrs) for panel widths dividing & not dividing
+// the matrix size; the temporary files are written to $TMPDIR (/tmp);
+// build & run with run_tests.sh
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "dense_la.h"
+#include "tiled_matrix.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+    const il::int_t n = dof_hndl.n_dof + 1;
+    il::Array<double> x = test_vector(n, 1.1);
+    il::Array<double> b = test_dense_dot(a, x);
+
+    // in-core dense LU
+    const Dense_LA_T la{};
+    il::Array<il::int_t> piv{};
+    il::Status status{};
+    il::Array2D<double> a_lu = a;
+    la_getrf(la, il::io, a_lu, piv, status);
+    status.abort_on_error();
+    il::Array<double> x_d = la_getrs(la, a_lu, piv, b);
+
+    const char *tmp_dir = std::getenv("TMPDIR");
+    const std::string f_name = std::string(tmp_dir ? tmp_dir : "/tmp") +
+                               "/hfp3d_test_ooc_lu.bin";
+    const il::int_t p_width[2] = {100, 700};
+    for (int k = 0; k < 2; ++k) {
+        std::printf("panel width %ld\n", static_cast<long>(p_width[k]));
+        Tiled_Matrix matrix{f_name, n, n, p_width[k], il::io, status};
+        test_check(status.ok(), "file created", 0.0, il::io, count);
+        if (!status.ok()) {
+            return test_result("test_ooc_lu", count);
+        }
+        make_3dbem_matrix_vc_ooc(1.0, 0.35, mesh, n_par, dof_hndl,
+                                 il::io, matrix, status);
+        test_check(status.ok(), "out-of-core assembly", 0.0, il::io, count);
+        if (!status.ok()) {
+            return test_result("test_ooc_lu", count);
+        }
+        il::Array<double> y = ooc_dot(matrix, x, il::io, status);
+        double err = status.ok() ? test_rel_diff(y, b) : 1.0;
+        test_check(err < 1.0E-14, "out-of-core vs dense product", err,
+                   il::io, count);
+
+        OOC_LU_T lu = ooc_lu(il::io, matrix, status);
+        test_check(status.ok(), "out-of-core LU decomposition", 0.0,
+                   il::io, count);
+        if (!status.ok()) {
+            return test_result("test_ooc_lu", count);
+        }
+        il::Array<double> x_o = ooc_lu_solve(matrix, lu, b, il::io, status);
+        err = status.ok() ? test_rel_diff(x_o, x_d) : 1.0;
+        test_check(err < 1.0E-10, "out-of-core vs dense LU solution", err,
+                   il::io, count);
+        err = status.ok() ? test_rel_diff(x_o, x) : 1.0;
+        test_check(err < 1.0E-8, "out-of-core vs exact solution", err,
+                   il::io, count);
+    }
+
+    // a file that cannot be created
+    Tiled_Matrix matrix{"/nonexistent_dir/hfp3d_test_ooc_lu.bin", n, n, 100,
+                        il::io, status};
+    test_check(!status.ok(), "file error reported", 0.0, il::io, count);
+
+    return test_result("test_ooc_lu", count);
+}
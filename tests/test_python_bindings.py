@@ -0,0 +1,118 @@
+#
+# This file is part of HFPx3D.
+#
+# Created by agent on 10/17/2026.
+# Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+# Geo-Energy Laboratory, 2026.  All rights reserved.
+# See the LICENSE.TXT file for more details.
+#
+
+# Smoke test of the Python module (build it first, see setup.py):
+#   python3 tests/test_python_bindings.py
+# exits with a non-zero status if a check fails
+
+import math
+import os
+import sys
+
+import numpy as np
+import hfp3d
+
+MESH_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                        os.pardir, "Mesh_Files")
+
+
+def load_mesh(name):
+    conn = np.load(os.path.join(MESH_DIR, "Elems_%s_64.npy" % name))
+    nods = np.load(os.path.join(MESH_DIR, "Nodes_%s_64.npy" % name))
+    return hfp3d.Mesh(nods, conn, is_matlab=True)
+
+
+def expect_value_error(f):
+    try:
+        f()
+    except ValueError:
+        return
+    raise AssertionError("ValueError expected")
+
+
+def main():
+    mu, nu = 1.0, 0.35
+    mesh = load_mesh("pennymesh24el")
+    n_par = hfp3d.NumParam()
+    assert mesh.n_el == 24
+
+    # the connectivity is checked & read-only
+    assert not mesh.conn.flags.writeable
+    bad = np.array(mesh.conn, dtype=np.int64)
+    bad[0, 0] = mesh.nods.shape[1]
+    expect_value_error(lambda: hfp3d.Mesh(mesh.nods, bad))
+    expect_value_error(lambda: hfp3d.Mesh(mesh.nods, mesh.conn,
+                                          is_matlab=True))
+
+    # VC matrix: (DoF + 1)^2, zero in the pressure-volume corner
+    a, dof_h = hfp3d.assemble_vc(mu, nu, mesh, n_par)
+    n_dof = a.shape[0] - 1
+    assert a.shape == (n_dof + 1, n_dof + 1) and dof_h.shape == (24, 18)
+    assert a[n_dof, n_dof] == 0.0 and np.all(np.isfinite(a))
+
+    # injection arrays are copies (a setter does not invalidate them)
+    load = hfp3d.Load()
+    load.s_inf = np.array([-1.0, -1.0, -1.0, 0.0, 0.0, 0.0])
+    load.inj_rate = np.array([1.0])
+    rate = load.inj_rate
+    load.inj_rate = np.array([1.0])
+    rate[0] = 2.0
+    assert load.inj_rate[0] == 1.0
+
+    # invalid parameters raise instead of aborting
+    md = hfp3d.MeshData(mesh)
+    ts_par = hfp3d.TimeStepParam()
+    ts_par.t_end = 1.0
+    ts_par.dt_min = 0.0
+    expect_value_error(lambda: hfp3d.vc_time_stepping
+                       (mu, nu, n_par, load, ts_par, md))
+    ts_par.dt_min = 1.0E-8
+    ts_par.pred_order = 3
+    expect_value_error(lambda: hfp3d.vc_time_stepping
+                       (mu, nu, n_par, load, ts_par, md))
+    ts_par.pred_order = 2
+    load.inj_time = np.array([0.0, 0.5])
+    expect_value_error(lambda: hfp3d.vc_time_stepping
+                       (mu, nu, n_par, load, ts_par, md))
+    load.inj_time = np.array([], dtype=np.float64)
+    expect_value_error(lambda: md.set_leak_off(
+        n_par, np.array([24], dtype=np.int64), 0.01))
+
+    # unit volume injected in 1 s: positive pressure & opening
+    stat = hfp3d.vc_time_stepping(mu, nu, n_par, load, ts_par, md)
+    assert stat["n_steps"] > 0
+    assert abs(md.time - 1.0) < 1.0E-12
+    assert md.pp[0] > 0.0 and math.isfinite(md.pp[0])
+    assert np.max(md.dd[:, 2]) > 0.0
+
+    # stress at the points (3, n_pts) above the fracture
+    pts = np.array([[0.0, 0.0], [0.0, 0.1], [0.5, 1.0]])
+    s = hfp3d.stress(mu, nu, n_par, md, pts)
+    assert s.shape == (6, 2) and np.all(np.isfinite(s))
+    s_m = hfp3d.stress_matrix(mu, nu, mesh, n_par, pts)
+    assert s_m.shape == (12, 18 * 24)
+    expect_value_error(lambda: hfp3d.stress(mu, nu, n_par, md, pts[:2]))
+
+    # DD in the reference coordinate system: the same solution & stress
+    n_par_g = hfp3d.NumParam()
+    n_par_g.is_dd_local = False
+    md_g = hfp3d.MeshData(mesh)
+    hfp3d.vc_time_stepping(mu, nu, n_par_g, load, ts_par, md_g)
+    assert abs(md_g.pp[0] - md.pp[0]) < 1.0E-8 * abs(md.pp[0])
+    s_g = hfp3d.stress(mu, nu, n_par_g, md_g, pts)
+    assert np.allclose(s_g, s, rtol=1.0E-8, atol=1.0E-8 * np.abs(s).max())
+    s_m_g = hfp3d.stress_matrix(mu, nu, mesh, n_par_g, pts)
+    assert s_m_g.shape == (12, 18 * 24) and np.all(np.isfinite(s_m_g))
+
+    print("python bindings: OK")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
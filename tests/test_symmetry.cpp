@@ -0,0 +1,218 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the symmetry-plane reduction of the VC matrix
+// (make_3dbem_matrix_vc_sym): the product of the reduced matrix
+// vs the one of the matrix of the explicitly mirrored full mesh
+// for symmetric DD (1/2 & 1/4 of a penny-shaped crack,
+// local & global DD); build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "system_assembly.h"
+#include "element_utilities.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+// elements of mesh with all vertices at x_k >= 0 for the planes
+// x_k = 0 of sym (3 nodes per element, no tip marks)
+Mesh_Geom_T make_test_sym_part
+        (const Mesh_Geom_T &mesh,
+         const Mesh_Sym_T &sym) {
+    il::Array<il::int_t> el_list{};
+    for (il::int_t el = 0; el < mesh.conn.size(1); ++el) {
+        bool is_in = true;
+        for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                is_in = is_in && (!sym.is_mirror[k] ||
+                                  mesh.nods(k, mesh.conn(j, el)) >= 0.0);
+            }
+        }
+        if (is_in) {
+            el_list.append(el);
+        }
+    }
+    Mesh_Geom_T part;
+    part.nods = il::Array2D<double>{3, mesh.nods.size(1)};
+    for (il::int_t n = 0; n < mesh.nods.size(1); ++n) {
+        for (int k = 0; k < 3; ++k) {
+            part.nods(k, n) = mesh.nods(k, n);
+        }
+    }
+    part.conn = il::Array2D<il::int_t>{3, el_list.size()};
+    for (il::int_t e = 0; e < el_list.size(); ++e) {
+        for (int j = 0; j < 3; ++j) {
+            part.conn(j, e) = mesh.conn(j, el_list[e]);
+        }
+    }
+    return part;
+}
+
+// reflections (diagonals of the reflection tensors) of sym,
+// the identity first
+il::Array<il::StaticArray<double, 3>> make_test_reflections
+        (const Mesh_Sym_T &sym) {
+    il::Array<il::StaticArray<double, 3>> refl{};
+    for (int mask = 0; mask < 8; ++mask) {
+        bool is_valid = true;
+        il::StaticArray<double, 3> m_diag{1.0};
+        for (int k = 0; k < 3; ++k) {
+            if (mask & (1 << k)) {
+                is_valid = is_valid && sym.is_mirror[k];
+                m_diag[k] = -1.0;
+            }
+        }
+        if (is_valid) {
+            refl.append(m_diag);
+        }
+    }
+    return refl;
+}
+
+// the full mesh: copy c of the part reflected by refl[c]
+// (vertices 2 & 3 swapped for an odd number of reflections)
+Mesh_Geom_T make_test_full_mesh
+        (const Mesh_Geom_T &part,
+         const il::Array<il::StaticArray<double, 3>> &refl) {
+    const il::int_t n_nod = part.nods.size(1);
+    const il::int_t n_el = part.conn.size(1);
+    const il::int_t n_cp = refl.size();
+    Mesh_Geom_T full;
+    full.nods = il::Array2D<double>{3, n_cp * n_nod};
+    full.conn = il::Array2D<il::int_t>{3, n_cp * n_el};
+    for (il::int_t c = 0; c < n_cp; ++c) {
+        bool is_odd = refl[c][0] * refl[c][1] * refl[c][2] < 0.0;
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            for (int k = 0; k < 3; ++k) {
+                full.nods(k, c * n_nod + n) = refl[c][k] * part.nods(k, n);
+            }
+        }
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (int j = 0; j < 3; ++j) {
+                int v = is_odd ? (3 - j) % 3 : j;
+                full.conn(j, c * n_el + el) = c * n_nod + part.conn(v, el);
+            }
+        }
+    }
+    return full;
+}
+
+// symmetric DD & pressure of the full mesh from the ones of the part
+il::Array<double> make_test_sym_vector
+        (const Mesh_Geom_T &part,
+         const Mesh_Geom_T &full,
+         const il::Array<il::StaticArray<double, 3>> &refl,
+         const DoF_Handle_T &dof_part,
+         const DoF_Handle_T &dof_full,
+         const Num_Param_T &n_par,
+         const il::Array<double> &x) {
+    const il::int_t n_el = part.conn.size(1);
+    il::Array<double> x_f{dof_full.n_dof + 1, 0.0};
+    x_f[dof_full.n_dof] = x[dof_part.n_dof];
+    for (il::int_t c = 0; c < refl.size(); ++c) {
+        bool is_odd = refl[c][0] * refl[c][1] * refl[c][2] < 0.0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            il::int_t el_f = c * n_el + el;
+            Element_Struct_T el_s = get_mesh_el_struct
+                    (part, el, n_par.beta);
+            Element_Struct_T el_i = get_mesh_el_struct
+                    (full, el_f, n_par.beta);
+            // image DD vs source DD: M (global) or R_i.M.R_s^T (local)
+            il::StaticArray2D<double, 3, 3> dd_tr{0.0};
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    if (!n_par.is_dd_local) {
+                        dd_tr(i, j) = (i == j) ? refl[c][i] : 0.0;
+                        continue;
+                    }
+                    for (int k = 0; k < 3; ++k) {
+                        dd_tr(i, j) += el_i.r_tensor(i, k) * refl[c][k] *
+                                       el_s.r_tensor(j, k);
+                    }
+                }
+            }
+            for (int n_i = 0; n_i < 6; ++n_i) {
+                int n_s = (is_odd && n_i % 3 != 0) ?
+                          n_i + (n_i % 3 == 1 ? 1 : -1) : n_i;
+                for (int i = 0; i < 3; ++i) {
+                    double x_i = 0.0;
+                    for (int j = 0; j < 3; ++j) {
+                        x_i += dd_tr(i, j) *
+                               x[dof_part.dof_h(el, 3 * n_s + j)];
+                    }
+                    x_f[dof_full.dof_h(el_f, 3 * n_i + i)] = x_i;
+                }
+            }
+        }
+    }
+    return x_f;
+}
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    const double mu = 1.0, nu = 0.35;
+
+    for (int n_planes = 1; n_planes <= 2; ++n_planes) {
+        Mesh_Sym_T sym;
+        for (int k = 0; k < n_planes; ++k) {
+            sym.is_mirror[k] = true;
+        }
+        Mesh_Geom_T part = make_test_sym_part(mesh, sym);
+        il::Array<il::StaticArray<double, 3>> refl =
+                make_test_reflections(sym);
+        Mesh_Geom_T full = make_test_full_mesh(part, refl);
+        const il::int_t n_el = part.conn.size(1);
+        std::printf("1/%ld of the mesh (%ld elements)\n",
+                    static_cast<long>(refl.size()),
+                    static_cast<long>(n_el));
+        test_check(is_mesh_sym_valid(part, sym), "part of the mesh valid",
+                   0.0, il::io, count);
+
+        for (int dd_loc = 1; dd_loc >= 0; --dd_loc) {
+            Num_Param_T n_par;
+            n_par.tip_type = 0;
+            n_par.is_dd_local = (dd_loc == 1);
+            DoF_Handle_T dof_part = make_dof_h_crack(part, 2, 0);
+            DoF_Handle_T dof_full = make_dof_h_crack(full, 2, 0);
+            il::Array2D<double> a_sym = make_3dbem_matrix_vc_sym
+                    (mu, nu, part, sym, n_par, il::io, dof_part);
+            il::Array2D<double> a_full = make_3dbem_matrix_vc
+                    (mu, nu, full, n_par, il::io, dof_full);
+
+            il::Array<double> x = test_vector(dof_part.n_dof + 1, 1.1);
+            il::Array<double> y_f = test_dense_dot
+                    (a_full, make_test_sym_vector(part, full, refl,
+                                                  dof_part, dof_full,
+                                                  n_par, x));
+            // the rows of the part (1st copy) & the volume
+            il::Array<double> y_p{dof_part.n_dof + 1};
+            for (il::int_t el = 0; el < n_el; ++el) {
+                for (int l = 0; l < 18; ++l) {
+                    y_p[dof_part.dof_h(el, l)] = y_f[dof_full.dof_h(el, l)];
+                }
+            }
+            y_p[dof_part.n_dof] = y_f[dof_full.n_dof];
+
+            double err = test_rel_diff(test_dense_dot(a_sym, x), y_p);
+            test_check(err < 1.0E-11,
+                       n_par.is_dd_local ?
+                       "reduced vs full product (local DD)" :
+                       "reduced vs full product (global DD)",
+                       err, il::io, count);
+        }
+    }
+
+    return test_result("test_symmetry", count);
+}
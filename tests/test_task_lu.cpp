@@ -0,0 +1,69 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Regression test of the task-pipelined assembly & LU decomposition
+// of the VC matrix (see task_lu.h): the solution (panel_lu_solve)
+// vs the one of the dense LU (la_getrf & la_getrs) for panel widths
+// dividing & not dividing the matrix size; build & run with run_tests.sh
+
+#include <cstdio>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include "system_assembly.h"
+#include "dense_la.h"
+#include "task_lu.h"
+#include "test_utilities.h"
+
+using namespace hfp3d;
+
+int main(int argc, char **argv) {
+    Test_Count_T count;
+    Mesh_Geom_T mesh = load_test_mesh(test_mesh_dir(argc, argv),
+                                      "pennymesh121el");
+    Num_Param_T n_par;
+    DoF_Handle_T dof_hndl;
+    il::Array2D<double> a = make_3dbem_matrix_vc
+            (1.0, 0.35, mesh, n_par, il::io, dof_hndl);
+    const il::int_t n = dof_hndl.n_dof + 1;
+    il::Array<double> x = test_vector(n, 1.3);
+    il::Array<double> b = test_dense_dot(a, x);
+
+    // dense LU
+    const Dense_LA_T la{};
+    il::Array<il::int_t> piv{};
+    il::Status status{};
+    la_getrf(la, il::io, a, piv, status);
+    status.abort_on_error();
+    il::Array<double> x_d = la_getrs(la, a, piv, b);
+
+    const il::int_t p_width[3] = {100, 700, n};
+    for (int k = 0; k < 3; ++k) {
+        Panel_LU_T lu = make_3dbem_lu_vc_tasks
+                (1.0, 0.35, mesh, n_par, dof_hndl, p_width[k],
+                 il::io, status);
+        std::printf("panel width %ld (%ld panels)\n",
+                    static_cast<long>(p_width[k]),
+                    static_cast<long>(lu.panel.size()));
+        test_check(status.ok(), "task LU decomposition", 0.0,
+                   il::io, count);
+        if (!status.ok()) {
+            continue;
+        }
+        il::Array<double> x_t = panel_lu_solve(lu, b);
+        double err = test_rel_diff(x_t, x_d);
+        test_check(err < 1.0E-10, "task LU vs dense LU solution", err,
+                   il::io, count);
+        err = test_rel_diff(x_t, x);
+        test_check(err < 1.0E-8, "task LU vs exact solution", err,
+                   il::io, count);
+    }
+
+    return test_result("test_task_lu", count);
+}
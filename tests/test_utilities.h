@@ -0,0 +1,233 @@
+//
+// This file is part of HFPx3D.
+//
+// Created by agent on 10/17/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Common utilities of the regression tests (see run_tests.sh):
+// each test is a program taking the mesh directory (Mesh_Files/)
+// as the 1st argument and returning non-zero if a check fails
+
+#ifndef INC_HFPX3D_TEST_UTILITIES_H
+#define INC_HFPX3D_TEST_UTILITIES_H
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+#include "mesh_file_io.h"
+
+namespace hfp3d {
+
+    // number of failed checks
+    struct Test_Count_T {
+        int n_checks = 0;
+        int n_failed = 0;
+    };
+
+    inline void test_check
+            (bool is_ok,
+             const char *what,
+             double value,
+             il::io_t, Test_Count_T &count) {
+        ++count.n_checks;
+        if (!is_ok) {
+            ++count.n_failed;
+        }
+        std::printf("%s %s (%.3e)\n", is_ok ? "  ok  " : "FAILED", what,
+                    value);
+    }
+
+    inline int test_result
+            (const char *name,
+             const Test_Count_T &count) {
+        std::printf("%s: %d of %d checks failed\n", name, count.n_failed,
+                    count.n_checks);
+        return count.n_failed == 0 ? 0 : 1;
+    }
+
+    // penny-shaped crack mesh (e.g. "pennymesh121el") of mesh_dir
+    inline Mesh_Geom_T load_test_mesh
+            (const std::string &mesh_dir,
+             const std::string &name) {
+        Mesh_Geom_T mesh;
+        load_mesh_from_numpy_64(mesh_dir, "Elems_" + name + "_64.npy",
+                                "Nodes_" + name + "_64.npy", true,
+                                il::io, mesh);
+        return mesh;
+    }
+
+    inline std::string test_mesh_dir
+            (int argc, char **argv) {
+        std::string dir = (argc > 1) ? argv[1] : "Mesh_Files";
+        if (dir.back() != '/') {
+            dir += '/';
+        }
+        return dir;
+    }
+
+    // dense matrix-vector product
+    inline il::Array<double> test_dense_dot
+            (const il::Array2D<double> &a,
+             const il::Array<double> &x) {
+        il::Array<double> y{a.size(0), 0.0};
+        for (il::int_t j = 0; j < a.size(1); ++j) {
+            for (il::int_t i = 0; i < a.size(0); ++i) {
+                y[i] += a(i, j) * x[j];
+            }
+        }
+        return y;
+    }
+
+    // relative difference |a - b| / |b|
+    inline double test_rel_diff
+            (const il::Array<double> &a,
+             const il::Array<double> &b) {
+        double d = 0.0, n = 0.0;
+        for (il::int_t i = 0; i < b.size(); ++i) {
+            d += (a[i] - b[i]) * (a[i] - b[i]);
+            n += b[i] * b[i];
+        }
+        return std::sqrt(d / n);
+    }
+
+    // DoF handle keeping the DoF of the first n_act elements of dof_hndl
+    inline DoF_Handle_T make_test_dof_h_act
+            (const DoF_Handle_T &dof_hndl,
+             il::int_t n_act) {
+        DoF_Handle_T dof_h_act;
+        const il::int_t n_el = dof_hndl.dof_h.size(0);
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        dof_h_act.dof_h = il::Array2D<il::int_t>{n_el, ndpe, -1};
+        for (il::int_t el = 0; el < n_act; ++el) {
+            for (il::int_t l = 0; l < ndpe; ++l) {
+                if (dof_hndl.dof_h(el, l) >= 0) {
+                    dof_h_act.dof_h(el, l) = dof_h_act.n_dof;
+                    ++dof_h_act.n_dof;
+                }
+            }
+        }
+        return dof_h_act;
+    }
+
+    // max. |a - b| / max. |b|
+    inline double test_matrix_diff
+            (const il::Array2D<double> &a,
+             const il::Array2D<double> &b) {
+        double d = 0.0, n = 0.0;
+        for (il::int_t j = 0; j < b.size(1); ++j) {
+            for (il::int_t i = 0; i < b.size(0); ++i) {
+                d = std::fmax(d, std::fabs(a(i, j) - b(i, j)));
+                n = std::fmax(n, std::fabs(b(i, j)));
+            }
+        }
+        return d / n;
+    }
+
+    // max. |a - b| / max. |b| for fixed-size blocks
+    template <il::int_t n0, il::int_t n1>
+    double test_block_diff
+            (const il::StaticArray2D<double, n0, n1> &a,
+             const il::StaticArray2D<double, n0, n1> &b) {
+        double d = 0.0, n = 0.0;
+        for (il::int_t j = 0; j < n1; ++j) {
+            for (il::int_t i = 0; i < n0; ++i) {
+                d = std::fmax(d, std::fabs(a(i, j) - b(i, j)));
+                n = std::fmax(n, std::fabs(b(i, j)));
+            }
+        }
+        return d / n;
+    }
+
+    // rotation by 0.7 rad about (1, 2, 3) (Rodrigues' formula)
+    inline il::StaticArray2D<double, 3, 3> make_test_rotation() {
+        const double a[3] = {1.0 / std::sqrt(14.0), 2.0 / std::sqrt(14.0),
+                             3.0 / std::sqrt(14.0)};
+        const double c = std::cos(0.7), s = std::sin(0.7);
+        il::StaticArray2D<double, 3, 3> r;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                r(i, j) = (1.0 - c) * a[i] * a[j] + (i == j ? c : 0.0);
+            }
+        }
+        r(0, 1) -= s * a[2];
+        r(0, 2) += s * a[1];
+        r(1, 0) += s * a[2];
+        r(1, 2) -= s * a[0];
+        r(2, 0) -= s * a[1];
+        r(2, 1) += s * a[0];
+        return r;
+    }
+
+    // copy of the mesh rotated (make_test_rotation), scaled by scale
+    // & translated
+    inline Mesh_Geom_T move_test_mesh
+            (const Mesh_Geom_T &mesh,
+             double scale) {
+        const il::StaticArray2D<double, 3, 3> r = make_test_rotation();
+        const double shift[3] = {0.3, -1.2, 2.0};
+        Mesh_Geom_T moved = mesh;
+        for (il::int_t n = 0; n < mesh.nods.size(1); ++n) {
+            for (int i = 0; i < 3; ++i) {
+                double x_i = 0.0;
+                for (int j = 0; j < 3; ++j) {
+                    x_i += r(i, j) * mesh.nods(j, n);
+                }
+                moved.nods(i, n) = scale * x_i + shift[i];
+            }
+        }
+        return moved;
+    }
+
+    // element-to-element block (traction vs DD) of the pair
+    // rotated by make_test_rotation (DD components are rotated
+    // unless is_dd_local)
+    inline il::StaticArray2D<double, 18, 18> rotate_test_block
+            (const il::StaticArray2D<double, 18, 18> &blk,
+             bool is_dd_local) {
+        const il::StaticArray2D<double, 3, 3> r = make_test_rotation();
+        il::StaticArray2D<double, 18, 18> r_blk{0.0}, rot{0.0};
+        for (int n = 0; n < 6; ++n) {
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 18; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        r_blk(3 * n + i, j) += r(i, k) * blk(3 * n + k, j);
+                    }
+                }
+            }
+        }
+        if (is_dd_local) {
+            return r_blk;
+        }
+        for (int n = 0; n < 6; ++n) {
+            for (int i = 0; i < 18; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        rot(i, 3 * n + j) += r_blk(i, 3 * n + k) * r(j, k);
+                    }
+                }
+            }
+        }
+        return rot;
+    }
+
+    // reproducible test vector
+    inline il::Array<double> test_vector
+            (il::int_t n,
+             double seed) {
+        il::Array<double> x{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            x[i] = std::sin(seed * (i + 1) + 0.3);
+        }
+        return x;
+    }
+
+}
+
+#endif //INC_HFPX3D_TEST_UTILITIES_H